@@ -0,0 +1,278 @@
+/**
+ * @file GF2nX.hpp
+ * @brief packed elements of GF(2^n), n <= NTL_BITS_PER_LONG, and polynomials
+ *        of small degree over GF(2^n)
+ */
+
+#ifndef ANTL_GF2NX_H
+#define ANTL_GF2NX_H
+
+#include <iostream>
+#include <cstring>
+
+#include <NTL/ZZ.h>
+#include <NTL/GF2X.h>
+#include <NTL/GF2E.h>
+#include <NTL/GF2EX.h>
+
+#ifdef __PCLMUL__
+#include <immintrin.h>
+#endif
+
+// maximal number of coefficients of a GF2nX (degree < GF2NX_MAX_LEN)
+#ifndef GF2NX_MAX_LEN
+#define GF2NX_MAX_LEN 32
+#endif
+
+NTL_CLIENT
+
+// GF2n and GF2nX are base types like the NTL ones, so they (and their
+// functions) are in the global namespace, next to NTL's (see NTL_CLIENT), and
+// found by the templates in the same way.
+
+/**
+ * @brief Element of GF(2^n) = GF(2)[t]/(P(t)), n <= NTL_BITS_PER_LONG,
+ *        stored as a single word (bit i = coefficient of t^i).
+ * @remarks The modulus is global (as for NTL's GF2E) and is set with
+ * GF2n::init(), which also initializes GF2E with the same modulus (used by
+ * the conversions to and from GF2E and GF2EX).
+ *
+ * Products are computed with one carry-less multiplication (PCLMULQDQ if
+ * the compiler targets it, i.e., __PCLMUL__ is defined, e.g. with -mpclmul
+ * or -march=native; a portable shift-and-add version otherwise), followed
+ * by reduction modulo P.  The reduction folds the high part back with
+ * carry-less multiplications by P - t^n, so sparse moduli (as returned by
+ * BuildSparseIrred) need only two folds.
+ */
+class GF2n
+{
+public:
+  unsigned long rep;
+
+  GF2n () : rep(0) {}
+  explicit GF2n (unsigned long r) : rep(r) {}
+
+  // modulus
+  static long n;                // degree of P
+  static unsigned long low;     // P - t^n
+  static unsigned long mask;    // t^n - 1
+
+  static void init (const GF2X & P);
+  static void init (long n);    // sparse irreducible P of degree n
+  static long degree () { return n; }
+};
+
+//
+// clmul()
+//
+// Task:
+//      (hi, lo) = a b (carry-less)
+//
+
+inline void clmul (unsigned long & hi, unsigned long & lo, unsigned long a, unsigned long b)
+{
+#ifdef __PCLMUL__
+  __m128i r = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long) a), _mm_cvtsi64_si128((long long) b), 0);
+  lo = (unsigned long) _mm_cvtsi128_si64(r);
+  hi = (unsigned long) _mm_cvtsi128_si64(_mm_unpackhi_epi64(r, r));
+#else
+  unsigned long h = 0, l = 0;
+  for (long i = 0; i < NTL_BITS_PER_LONG; ++i)
+    if ((b >> i) & 1) {
+      l ^= a << i;
+      if (i)
+        h ^= a >> (NTL_BITS_PER_LONG - i);
+    }
+  hi = h;
+  lo = l;
+#endif
+}
+
+//
+// GF2n_reduce()
+//
+// Task:
+//      returns (hi, lo) mod P
+//
+
+inline unsigned long GF2n_reduce (unsigned long hi, unsigned long lo)
+{
+  const long n = GF2n::n;
+  unsigned long t;
+
+  if (n == NTL_BITS_PER_LONG) {
+    while (hi) {
+      t = hi;
+      clmul(hi, t, t, GF2n::low);
+      lo ^= t;
+    }
+    return lo;
+  }
+
+  while (hi || (lo >> n)) {
+    t = (hi << (NTL_BITS_PER_LONG - n)) | (lo >> n);
+    lo &= GF2n::mask;
+    clmul(hi, t, t, GF2n::low);
+    lo ^= t;
+  }
+  return lo;
+}
+
+// arithmetic
+inline void clear (GF2n & x) { x.rep = 0; }
+inline void set (GF2n & x) { x.rep = 1; }
+inline bool IsZero (const GF2n & a) { return a.rep == 0; }
+inline bool IsOne (const GF2n & a) { return a.rep == 1; }
+
+inline void add (GF2n & x, const GF2n & a, const GF2n & b) { x.rep = a.rep ^ b.rep; }
+inline void sub (GF2n & x, const GF2n & a, const GF2n & b) { x.rep = a.rep ^ b.rep; }
+inline void negate (GF2n & x, const GF2n & a) { x.rep = a.rep; }
+
+inline void mul (GF2n & x, const GF2n & a, const GF2n & b)
+{
+  unsigned long hi, lo;
+  clmul(hi, lo, a.rep, b.rep);
+  x.rep = GF2n_reduce(hi, lo);
+}
+
+inline void sqr (GF2n & x, const GF2n & a) { mul(x, a, a); }
+
+void inv (GF2n & x, const GF2n & a);
+void div (GF2n & x, const GF2n & a, const GF2n & b);
+void SqrRoot (GF2n & x, const GF2n & a);
+bool SolveArtinSchreier (GF2n & z, const GF2n & c);   // z^2 + z = c
+void random (GF2n & x);
+
+inline GF2n inv (const GF2n & a) { GF2n x; inv(x, a); return x; }
+
+inline GF2n operator + (const GF2n & a, const GF2n & b) { return GF2n(a.rep ^ b.rep); }
+inline GF2n operator - (const GF2n & a, const GF2n & b) { return GF2n(a.rep ^ b.rep); }
+inline GF2n operator - (const GF2n & a) { return a; }
+inline GF2n operator * (const GF2n & a, const GF2n & b) { GF2n x; mul(x, a, b); return x; }
+inline GF2n operator / (const GF2n & a, const GF2n & b) { GF2n x; div(x, a, b); return x; }
+inline bool operator == (const GF2n & a, const GF2n & b) { return a.rep == b.rep; }
+inline bool operator != (const GF2n & a, const GF2n & b) { return a.rep != b.rep; }
+
+// conversions
+void conv (GF2n & x, const GF2X & a);
+void conv (GF2X & x, const GF2n & a);
+void conv (GF2n & x, const GF2E & a);
+void conv (GF2E & x, const GF2n & a);
+
+std::ostream & operator << (std::ostream & out, const GF2n & a);
+
+
+
+/**
+ * @brief Polynomial over GF(2^n) of degree < GF2NX_MAX_LEN with packed
+ *        coefficients, intended for low genus hyperelliptic curves.
+ * @remarks The coefficients are stored in a fixed array of words (no heap
+ * allocation), rep[i] for i < len, and len = deg + 1 (0 for the zero
+ * polynomial).  Products accumulate unreduced carry-less products and
+ * reduce once per coefficient; squaring only squares the coefficients.
+ * Results of degree >= GF2NX_MAX_LEN raise a LogicError.
+ *
+ * The interface follows NTL's GF2EX (deg, add, mul, sqr, DivRem, div, rem,
+ * MulMod, MakeMonic, LeadCoeff, ...), so that the generic characteristic 2
+ * code for quadratic orders (NUCOMP, NUDUPL, NUCUBE, fast reduction) and
+ * the XGCD routines can be used with T = GF2nX.  For genus g, the
+ * intermediate results of these algorithms have degree about 4g, so the
+ * default GF2NX_MAX_LEN = 32 suffices for g <= 4 (reduced inputs).
+ */
+class GF2nX
+{
+public:
+  long len;
+  unsigned long rep[GF2NX_MAX_LEN];
+
+  GF2nX () : len(0) {}
+  GF2nX (INIT_SIZE_TYPE, long) : len(0) {}
+  GF2nX (const GF2nX & a) : len(a.len) { std::memcpy(rep, a.rep, len*sizeof(unsigned long)); }
+  explicit GF2nX (const GF2n & c) : len(0) { if (!IsZero(c)) { len = 1; rep[0] = c.rep; } }
+
+  GF2nX & operator = (const GF2nX & a)
+  {
+    if (this != &a) {
+      len = a.len;
+      std::memcpy(rep, a.rep, len*sizeof(unsigned long));
+    }
+    return *this;
+  }
+
+  void SetLength (long n)
+  {
+    if (n > GF2NX_MAX_LEN)
+      LogicError("GF2nX: degree too large (increase GF2NX_MAX_LEN)");
+    len = n;
+  }
+
+  void normalize ()
+  {
+    while (len > 0 && rep[len-1] == 0)
+      --len;
+  }
+
+  void kill () { len = 0; }
+};
+
+// basic functions
+inline long deg (const GF2nX & a) { return a.len - 1; }
+inline bool IsZero (const GF2nX & a) { return a.len == 0; }
+inline bool IsOne (const GF2nX & a) { return a.len == 1 && a.rep[0] == 1; }
+inline void clear (GF2nX & x) { x.len = 0; }
+inline void set (GF2nX & x) { x.len = 1; x.rep[0] = 1; }
+void SetX (GF2nX & x);
+
+inline GF2n coeff (const GF2nX & a, long i) { return (i >= 0 && i < a.len) ? GF2n(a.rep[i]) : GF2n(); }
+inline GF2n LeadCoeff (const GF2nX & a) { return coeff(a, a.len - 1); }
+inline GF2n ConstTerm (const GF2nX & a) { return coeff(a, 0); }
+void SetCoeff (GF2nX & x, long i, const GF2n & c);
+void SetCoeff (GF2nX & x, long i);
+
+inline void swap (GF2nX & x, GF2nX & y) { GF2nX t(x); x = y; y = t; }
+
+// arithmetic
+void add (GF2nX & x, const GF2nX & a, const GF2nX & b);
+inline void sub (GF2nX & x, const GF2nX & a, const GF2nX & b) { add(x, a, b); }
+inline void negate (GF2nX & x, const GF2nX & a) { x = a; }
+
+void mul (GF2nX & x, const GF2nX & a, const GF2nX & b);
+void mul (GF2nX & x, const GF2nX & a, const GF2n & b);
+inline void mul (GF2nX & x, const GF2n & a, const GF2nX & b) { mul(x, b, a); }
+void sqr (GF2nX & x, const GF2nX & a);
+
+void DivRem (GF2nX & q, GF2nX & r, const GF2nX & a, const GF2nX & b);
+void div (GF2nX & q, const GF2nX & a, const GF2nX & b);
+void div (GF2nX & q, const GF2nX & a, const GF2n & b);
+void rem (GF2nX & r, const GF2nX & a, const GF2nX & b);
+void MulMod (GF2nX & x, const GF2nX & a, const GF2nX & b, const GF2nX & f);
+void MakeMonic (GF2nX & x);
+
+void GCD (GF2nX & d, const GF2nX & a, const GF2nX & b);
+void eval (GF2n & y, const GF2nX & f, const GF2n & a);
+void random (GF2nX & x, long n);
+
+// conversions (GF2E has to be initialized with the modulus of GF2n)
+void conv (GF2nX & x, const GF2EX & a);
+void conv (GF2EX & x, const GF2nX & a);
+
+// operators
+bool operator == (const GF2nX & a, const GF2nX & b);
+inline bool operator != (const GF2nX & a, const GF2nX & b) { return !(a == b); }
+
+inline GF2nX operator + (const GF2nX & a, const GF2nX & b) { GF2nX x; add(x, a, b); return x; }
+inline GF2nX operator - (const GF2nX & a, const GF2nX & b) { GF2nX x; add(x, a, b); return x; }
+inline GF2nX operator - (const GF2nX & a) { return a; }
+inline GF2nX operator * (const GF2nX & a, const GF2nX & b) { GF2nX x; mul(x, a, b); return x; }
+inline GF2nX operator * (const GF2nX & a, const GF2n & b) { GF2nX x; mul(x, a, b); return x; }
+inline GF2nX operator / (const GF2nX & a, const GF2nX & b) { GF2nX x; div(x, a, b); return x; }
+inline GF2nX operator % (const GF2nX & a, const GF2nX & b) { GF2nX x; rem(x, a, b); return x; }
+
+inline GF2nX & operator += (GF2nX & x, const GF2nX & a) { add(x, x, a); return x; }
+inline GF2nX & operator -= (GF2nX & x, const GF2nX & a) { add(x, x, a); return x; }
+inline GF2nX & operator *= (GF2nX & x, const GF2nX & a) { mul(x, x, a); return x; }
+inline GF2nX & operator *= (GF2nX & x, const GF2n & a) { mul(x, x, a); return x; }
+
+std::ostream & operator << (std::ostream & out, const GF2nX & a);
+
+#endif // guard
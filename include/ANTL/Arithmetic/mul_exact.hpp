@@ -15,6 +15,7 @@
 #include <NTL/lzz_pEX.h>
 #include <NTL/ZZ.h>
 #include <ANTL/thresholds.hpp>
+#include <ANTL/Arithmetic/GF2nX.hpp>
 
 NTL_CLIENT
 
@@ -50,6 +51,10 @@ template <> void PlainSqrExact(zz_pEX & x, const zz_pEX & a, long n);
 
 //template <> void SqrExact(GF2EX & x, const GF2EX & a, long n);
 
+// GF2nX: full products (the degrees are small)
+template <> void MulExact(GF2nX & x, const GF2nX & a, const GF2nX & b, long n);
+template <> void SqrExact(GF2nX & x, const GF2nX & a, long n);
+
 
 // Unspecialized template definitions.
 #include "../src/Arithmetic/mul_exact_impl.hpp"
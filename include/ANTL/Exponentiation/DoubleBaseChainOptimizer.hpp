@@ -0,0 +1,68 @@
+/**
+ * @file DoubleBaseChainOptimizer.hpp
+ * @brief search for double base (2,3) chains of minimal weighted cost
+ */
+
+#ifndef DOUBLE_BASE_CHAIN_OPTIMIZER_H
+#define DOUBLE_BASE_CHAIN_OPTIMIZER_H
+
+#include <vector>
+#include <ANTL/common.hpp>
+#include <ANTL/Exponentiation/ExponentRecoding.hpp>
+
+namespace ANTL
+{
+
+  /**
+   * @brief search for double base (2,3) chains of minimal weighted cost
+   * @remarks A double base chain for n computes A^n from A with squarings
+   * (m -> 2m), cubings (m -> 3m) and multiplications by A or A^-1
+   * (m -> m +- 1).  Read backwards from n, every value in the chain lies in
+   *     m(a, b, delta) = floor(n / (2^a 3^b)) + delta,   delta in {-1, .., 2},
+   * if no two multiplications are adjacent (dividing by 2 or 3 maps these
+   * values to delta in {0, 1}, and a multiplication changes delta by 1).
+   * The optimizer computes, by dynamic programming over the O(log(n)^2)
+   * states (a, b, delta), the chain of minimal cost S (#squarings) +
+   * C (#cubings) + M (#multiplications) for the given costs S, C and M,
+   * e.g., measured with ExponentiationAuto::calibrate().
+   * The greedy strict chain of ExponentiationDoubleBaseStrictChain lies in
+   * this search space, so the optimized chain is never more expensive.
+   *
+   * The time is O(log(n)^2) word operations plus O(log(n)) divisions by 3,
+   * and the memory about 2 log(n)^2 / 3 bytes (11 MB for 4096-bit exponents).
+   * The result is an ExponentRecoding of type STRICT_CHAIN, which can be
+   * replayed against any base, written to a file, or handed to
+   * ExponentiationDoubleBaseStrictChain::setChain().
+   */
+  class DoubleBaseChainOptimizer
+  {
+  protected:
+    double M;
+    double S;
+    double C;
+
+  public:
+    DoubleBaseChainOptimizer () : M(1.0), S(1.0), C(1.0) {};
+    DoubleBaseChainOptimizer (double inM, double inS, double inC) : M(inM), S(inS), C(inC) {};
+    ~DoubleBaseChainOptimizer () {};
+
+    /**
+     * @brief sets the costs of a multiplication, squaring and cubing
+     */
+    void setCosts (double inM, double inS, double inC) { M = inM; S = inS; C = inC; }
+
+    /**
+     * @brief computes a chain for n (n != 0) of minimal cost, and returns its
+     * cost
+     */
+    double optimize (ExponentRecoding & R, const ZZ & n) const;
+
+    /**
+     * @brief returns the cost of the recoding R with the current costs
+     */
+    double cost (const ExponentRecoding & R) const;
+  };
+
+} // ANTL
+
+#endif // DOUBLE_BASE_CHAIN_OPTIMIZER_H
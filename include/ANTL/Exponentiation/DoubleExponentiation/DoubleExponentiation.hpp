@@ -8,6 +8,7 @@
 #define DOUBLEEXPONENTIATION_H
 
 #include <ANTL/common.hpp>
+#include <ANTL/Exponentiation/InversionFree.hpp>
 
 namespace ANTL 
 {
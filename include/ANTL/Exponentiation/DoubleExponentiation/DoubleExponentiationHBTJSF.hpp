@@ -12,7 +12,7 @@
 #define DOUBLEEXPONENTIATION_HBTJSF_H
 
 #include <vector>
-#include <ANTL/DoubleExponentiation/DoubleExponentiation.hpp>
+#include <ANTL/Exponentiation/DoubleExponentiation/DoubleExponentiation.hpp>
 
 namespace ANTL
 {
@@ -30,6 +30,8 @@ namespace ANTL
    *   - cub(T &C, const T &A): computes C = AAA
    *   - inv(T &C, const T &A): computes C = inverse of A
    *   - equals(const T &C, const T &A): returns true if C == A 
+   * The inverses of the precomputed values are also precomputed, unless
+   * is_inversion_free<T>, in which case they are computed on the fly.
    */
   template < class T >
   class DoubleExponentiationHBTJSF : public DoubleExponentiation<T> 
@@ -42,6 +44,7 @@ namespace ANTL
     ZZ initM;           /**< value currently held in em */
     ZZ initN;           /**< value currently held in en */
     T precomps[16];     /**< array of templated class containing the precomputations for this algorithm */
+    vector<T> precompsInv;  /**< inverses of precomps (empty if T is inversion free) */
     
     
     void readPrecomps(T &C, short mDigit, short nDigit);  /**<helper function used to read precomps array>*/
@@ -84,7 +87,7 @@ namespace ANTL
 } // ANTL
 
 // Unspecialized template definitions.
-#include "../../../src/DoubleExponentiation/DoubleExponentiationHBTJSF_impl.hpp"
+#include "../../../../src/DoubleExponentiation/DoubleExponentiationHBTJSF_impl.hpp"
 
 #endif // DOUBLEEXPONENTIATION_HBTJSF_H
 
@@ -8,7 +8,7 @@
 #define DOUBLEEXPONENTIATION_IL_H
 
 #include <vector>
-#include <ANTL/DoubleExponentiation/DoubleExponentiation.hpp>
+#include <ANTL/Exponentiation/DoubleExponentiation/DoubleExponentiation.hpp>
 
 namespace ANTL
 {
@@ -75,7 +75,7 @@ namespace ANTL
 } // ANTL
 
 // Unspecialized template definitions.
-#include "../../../src/DoubleExponentiation/DoubleExponentiationIL_impl.hpp"
+#include "../../../../src/DoubleExponentiation/DoubleExponentiationIL_impl.hpp"
 
 #endif // DOUBLEEXPONENTIATION_IL_H
 
@@ -8,7 +8,7 @@
 #define DOUBLEEXPONENTIATION_JSF_H
 
 #include <vector>
-#include <ANTL/DoubleExponentiation/DoubleExponentiation.hpp>
+#include <ANTL/Exponentiation/DoubleExponentiation/DoubleExponentiation.hpp>
 
 namespace ANTL
 {
@@ -24,6 +24,8 @@ namespace ANTL
    *   - mul(T &C, const T &A, const T &B): computes C = AB
    *   - sqr(T &C, const T &A): computes C = AA
    *   - inv(T &C, const T &A): computes C = inverse of A
+   * If is_inversion_free<T>, only AB and AB^-1 are precomputed, and the other
+   * products are inverted on the fly.
    */
   template < class T >
   class DoubleExponentiationJSF : public DoubleExponentiation<T> 
@@ -32,12 +34,12 @@ namespace ANTL
   protected:
     vector<short> em;  /**< vector containing a NAF expansion of m */
     vector<short> en;  /**< vector containing a NAF expansion of n */
-    T AInv;	       /**< templated class containing the inverse of A */
-    T BInv;	       /**< templated class containing the inverse of B */
+    T AInv;	       /**< templated class containing the inverse of A (scratch if T is inversion free) */
+    T BInv;	       /**< templated class containing the inverse of B (unused if T is inversion free) */
     T AB; 	       /**< templated class containing the product of A and B */
     T ABInv;           /**< templated class containing the product of A and BInv */
-    T AInvB;           /**< templated class containing the product of AInv and B */
-    T AInvBInv;        /**< templated class containing the product of AInv and BInv */
+    T AInvB;           /**< templated class containing the product of AInv and B (unused if T is inversion free) */
+    T AInvBInv;        /**< templated class containing the product of AInv and BInv (unused if T is inversion free) */
 
   public:
     DoubleExponentiationJSF() {};
@@ -72,7 +74,7 @@ namespace ANTL
 } // ANTL
 
 // Unspecialized template definitions.
-#include "../../../src/DoubleExponentiation/DoubleExponentiationJSF_impl.hpp"
+#include "../../../../src/DoubleExponentiation/DoubleExponentiationJSF_impl.hpp"
 
 #endif // DOUBLEEXPONENTIATION_JSF_H
 
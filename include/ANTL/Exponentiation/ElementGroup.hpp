@@ -0,0 +1,41 @@
+/**
+ * @file ElementGroup.hpp
+ * @brief trait giving the group operations on reduced representatives
+ */
+
+#ifndef ELEMENT_GROUP_H
+#define ELEMENT_GROUP_H
+
+#include <ANTL/Exponentiation/InversionFree.hpp>
+
+namespace ANTL
+{
+
+  /**
+   * @brief group operations on the elements of T, on reduced representatives
+   * @remarks Algorithms that compare group elements (ElementOrder) need
+   * products that are again in a unique, reduced form, so that A^n = 1 can be
+   * tested with equal() and the elements can be hashed.  The generic
+   * definition uses the free functions mul(), sqr(), inv() and operator==
+   * of T, and computes the identity as A A^-1, which is right for types whose
+   * arithmetic is exact (e.g. zz_p, ZZ_p).  Types whose products must be
+   * reduced (ideals) specialize the trait next to their definition:
+   *   - identity(C, A):  C = the identity of the group of A
+   *   - multiply(C, A, B):  C = AB, reduced (C may be A or B)
+   *   - square(C, A):  C = AA, reduced (C may be A)
+   *   - reduce(C):  replaces C by its reduced representative
+   *   - equal(A, B):  returns true if A and B are the same group element
+   */
+  template < class T >
+  struct element_group
+  {
+    static void identity (T &C, const T &A) { T scratch(A); mulinv(C, A, A, scratch); }
+    static void multiply (T &C, const T &A, const T &B) { mul(C, A, B); }
+    static void square (T &C, const T &A) { sqr(C, A); }
+    static void reduce (T &) {}
+    static bool equal (const T &A, const T &B) { return A == B; }
+  };
+
+} // ANTL
+
+#endif // ELEMENT_GROUP_H
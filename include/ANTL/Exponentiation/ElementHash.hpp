@@ -0,0 +1,33 @@
+/**
+ * @file ElementHash.hpp
+ * @brief trait hashing group elements for baby-step giant-step tables
+ */
+
+#ifndef ELEMENT_HASH_H
+#define ELEMENT_HASH_H
+
+#include <cstddef>
+
+namespace ANTL
+{
+
+  /**
+   * @brief hash of the elements of T
+   * @remarks Baby-step giant-step searches (ElementOrder) store the baby
+   * steps in a hash table keyed by element_hash<T>()(A), which must agree
+   * for equal elements.  There is no generic definition:  specialize the
+   * trait next to the definition of the operations of T, e.g.
+   *
+   *   template <> struct element_hash<zz_p>
+   *   {
+   *     std::size_t operator() (const zz_p &A) const { return rep(A); }
+   *   };
+   *
+   * Only the baby-step giant-step methods require it.
+   */
+  template < class T >
+  struct element_hash;
+
+} // ANTL
+
+#endif // ELEMENT_HASH_H
@@ -0,0 +1,133 @@
+/**
+ * @file ElementOrder.hpp
+ * @brief class for computing the orders of group elements and the exponent
+ * of the group they generate
+ */
+
+#ifndef ELEMENT_ORDER_H
+#define ELEMENT_ORDER_H
+
+#include <vector>
+#include <unordered_map>
+#include <ANTL/Exponentiation/Exponentiation.hpp>
+#include <ANTL/Exponentiation/ElementGroup.hpp>
+#include <ANTL/Exponentiation/ElementHash.hpp>
+
+namespace ANTL
+{
+
+  /**
+   * @brief class for computing element orders and group exponents
+   * @remarks This class computes the order of an element A from a multiple
+   * N of it (A^N = 1), and the exponent of the group generated by a set of
+   * elements (the lcm of their orders).  N is factored (trial division, then
+   * Pollard-Brent rho), unless its prime divisors are given, and the order is
+   * reduced with a product tree:  if N = N_L N_R, where N_L and N_R are the
+   * products of the prime powers of the first and the second half of the
+   * primes, the orders of A^(N_R) and A^(N_L) divide N_L and N_R, and are
+   * computed recursively.  This takes O(log N log k) group operations for k
+   * prime divisors, instead of O(k log N) for removing one prime at a time.
+   * The exponent is accumulated as e = e ord(A[i]^e), so each order is
+   * reduced from the smaller multiple N/e.
+   *
+   * If no multiple is known (N = 0), the order is found with a baby-step
+   * giant-step search, whose table has at most getMaxBabySteps() entries and
+   * is keyed by element_hash<T>.
+   *
+   * The group operations are those of element_group<T>:  products are
+   * reduced, and A^n = 1 is tested with element_group<T>::equal().  Without
+   * a specialization of element_group, T must have the functions
+   *   - mul(T &C, const T &A, const T &B): computes C = AB
+   *   - sqr(T &C, const T &A): computes C = AA
+   *   - inv(T &C, const T &A): computes C = inverse of A
+   *   - operator==(const T &A, const T &B): returns true if A = B
+   * as zz_p and ZZ_p do; in any case T must be copy constructible and
+   * assignable.  QuadraticIdealBase<T> specializes element_group with
+   * reduced products (in QuadraticIdealBase.hpp).  Cubic ideals do not:  their
+   * classes have no invariant cheaper than the cycle of reduced ideals.  T
+   * need not be default constructible:  temporaries are copies of the
+   * arguments, and the identity is obtained from the element itself, so
+   * elements of different groups (e.g. ideals of different orders) can be
+   * handled by the same instance.
+   *
+   * The exponentiations are left-to-right binary with the operations of
+   * element_group<T>, or are done by any Exponentiation<T> set with
+   * setExponentiation() (e.g. ExponentiationAuto or ExponentiationBatch),
+   * whose results are then reduced with element_group<T>::reduce().  The
+   * BSGS search also requires element_hash<T>, which must agree on elements
+   * that element_group<T>::equal() identifies.
+   */
+  template < class T >
+  class ElementOrder
+  {
+
+  protected:
+    Exponentiation<T> *E;       /**< exponentiation used (NULL:  binary) */
+    long maxBabySteps;          /**< largest BSGS table */
+
+    void power (T &C, const T &A, const ZZ &n, const T &one);
+    void reduce (ZZ &ord, const T &B, const T &one, const std::vector<ZZ> &p,
+                 const std::vector<long> &e, const long first, const long last);
+
+    static void pollardBrent (ZZ &f, const ZZ &n);
+
+  public:
+    ElementOrder() : E(NULL), maxBabySteps(1L << 20) {};
+    ~ElementOrder() {};
+
+    /**
+     * @brief uses inE for all exponentiations
+     */
+    void setExponentiation (Exponentiation<T> &inE) { E = &inE; }
+
+    /**
+     * @brief sets the largest baby-step table (the BSGS search finds orders
+     * up to about m^2 in O(m) operations with m baby steps)
+     */
+    void setMaxBabySteps (long m) { maxBabySteps = (m > 1) ? m : 2; }
+    long getMaxBabySteps () const { return maxBabySteps; }
+
+    /**
+     * @brief computes the distinct prime divisors of n, in increasing order
+     */
+    static void factor (std::vector<ZZ> &primes, const ZZ &n);
+
+    /**
+     * @brief Computes the order of A from a multiple N
+     * @param[out] ord the order of A
+     * @param[in] A the element
+     * @param[in] N a multiple of the order of A, or 0 if none is known (BSGS)
+     */
+    void order (ZZ &ord, const T &A, const ZZ &N);
+
+    /**
+     * @brief Computes the order of A from a multiple N with prime divisors primes
+     * @pre every prime divisor of N is in primes
+     */
+    void order (ZZ &ord, const T &A, const ZZ &N, const std::vector<ZZ> &primes);
+
+    /**
+     * @brief Baby-step giant-step search for the order of A
+     * @return false if the order of A is larger than bound
+     */
+    bool orderBSGS (ZZ &ord, const T &A, const ZZ &bound);
+
+    /**
+     * @brief Computes the exponent of the group generated by A (the lcm of
+     * the orders of the A[i]) from a multiple N of it (0:  BSGS)
+     */
+    void exponent (ZZ &e, const std::vector<T> &A, const ZZ &N);
+
+    /**
+     * @brief Computes the exponent of the group generated by A from a
+     * multiple N with prime divisors primes
+     */
+    void exponent (ZZ &e, const std::vector<T> &A, const ZZ &N, const std::vector<ZZ> &primes);
+  };
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../src/Exponentiation/ElementOrder_impl.hpp"
+
+#endif // ELEMENT_ORDER_H
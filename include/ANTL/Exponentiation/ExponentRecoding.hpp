@@ -0,0 +1,179 @@
+/**
+ * @file ExponentRecoding.hpp
+ * @brief recoded exponents that can be replayed against any base, and a
+ *        cache of recodings keyed by exponent
+ */
+
+#ifndef EXPONENT_RECODING_H
+#define EXPONENT_RECODING_H
+
+#include <vector>
+#include <map>
+#include <iostream>
+#include <ANTL/common.hpp>
+
+namespace ANTL
+{
+
+  class DoubleBaseChainOptimizer;
+
+  /**
+   * @brief a recoded exponent (NAF, WNAF, SB3, signed greedy (2,3)
+   * representation or double base strict chain)
+   * @remarks The recoding of n is stored as a sequence of steps
+   * (d, s, t, k), each of which updates the result C by
+   *     C = C^(2^s 3^t) * A^(d 3^k),
+   * where the first step initializes C to A^(d 3^k).  The digits d are odd
+   * (or 0 for steps that only square and cube), and k > 0 only occurs with
+   * d = +-1 (the terms of a (2,3) representation).  A step takes 8 bytes, and
+   * there is one step per nonzero digit.
+   *
+   * The recoding depends only on the exponent, so it is computed once and
+   * can be applied to any number of bases with power().  Negative exponents
+   * are recoded with negated digits.  power() requires T to have the
+   * following functions defined:
+   *   - assign(T &C, const T &A): sets C = A
+   *   - mul(T &C, const T &A, const T &B): computes C = AB
+   *   - sqr(T &C, const T &A): computes C = AA
+   *   - cub(T &C, const T &A): computes C = AAA (SB3, DBNS and strict chains)
+   *   - inv(T &C, const T &A): computes C = inverse of A (negative digits)
+   */
+  class ExponentRecoding
+  {
+    friend class DoubleBaseChainOptimizer;
+
+  public:
+    /**
+     * @brief the recodings:  NAF (width 2), WNAF (width w), balanced
+     * ternary (SB3), signed greedy (2,3) representation (DBNS) and double
+     * base strict chain
+     */
+    enum Type { NAF, WNAF, SB3, DBNS, STRICT_CHAIN };
+
+    struct Step {
+      short digit;
+      unsigned short twos;
+      unsigned short threes;
+      unsigned short basethrees;
+    };
+
+  protected:
+    ZZ exponent;
+    Type type;
+    long param;               // window width (WNAF) or bound on the powers of 3 (DBNS)
+    std::vector<Step> steps;
+    long maxDigit;            // largest |d|
+    long maxBaseThrees;       // largest k
+    bool negative;            // some d < 0
+
+    void push (long digit, long twos, long threes, long basethrees);
+    void recodeNAF (const ZZ & n, long w);
+    void recodeSB3 (const ZZ & n);
+    void recodeDBNS (const ZZ & n, long threeBound);
+    void recodeStrictChain (const ZZ & n);
+
+  public:
+    ExponentRecoding ();
+    ExponentRecoding (const ZZ & n, Type t, long inparam = 0);
+    ~ExponentRecoding () {};
+
+    /**
+     * @brief recodes n.  For WNAF, inparam is the window width (default 4);
+     * for DBNS, it bounds the powers of 3 (default NumBits(n)/2).
+     */
+    void recode (const ZZ & n, Type t, long inparam = 0);
+
+    /**
+     * @brief computes C = A^n by replaying the recoding
+     * @pre n != 0
+     */
+    template <class T> void power (T & C, const T & A) const;
+
+    /**
+     * @brief writes the recoding (type, parameter, exponent and steps)
+     */
+    void write (std::ostream & out) const;
+
+    /**
+     * @brief reads a recoding written by write()
+     */
+    void read (std::istream & in);
+
+    const ZZ & getExponent () const { return exponent; }
+    Type getType () const { return type; }
+    long getParameter () const { return param; }
+    const std::vector<Step> & getSteps () const { return steps; }
+    long length () const { return steps.size(); }
+    long getMaxDigit () const { return maxDigit; }
+    long getMaxBaseThrees () const { return maxBaseThrees; }
+    bool hasNegativeDigits () const { return negative; }
+
+    // operations used by power() (excluding the tables of powers of A)
+    long squarings () const;
+    long cubings () const;
+    long multiplications () const;
+  };
+
+
+
+  /**
+   * @brief cache of exponent recodings keyed by (exponent, type, parameter)
+   * @remarks References returned by get() remain valid until the cache is
+   * cleared, which happens when it is full and a new exponent is recoded.
+   * The cache is not synchronized; the recodings it returns can be shared
+   * read-only by several threads.
+   */
+  class ExponentRecodingCache
+  {
+  protected:
+    struct Key {
+      ZZ n;
+      int type;
+      long param;
+    };
+
+    struct KeyLess {
+      bool operator() (const Key & x, const Key & y) const
+      {
+        if (x.type != y.type)
+          return x.type < y.type;
+        if (x.param != y.param)
+          return x.param < y.param;
+        return x.n < y.n;
+      }
+    };
+
+    std::map<Key, ExponentRecoding, KeyLess> cache;
+    long maxEntries;
+    long hits;
+    long misses;
+
+  public:
+    ExponentRecodingCache (long inmax = 1024) : maxEntries(inmax), hits(0), misses(0) {};
+    ~ExponentRecodingCache () {};
+
+    /**
+     * @brief returns the recoding of n, computing it if it is not cached
+     */
+    const ExponentRecoding & get (const ZZ & n, ExponentRecoding::Type t, long inparam = 0);
+
+    /**
+     * @brief computes C = A^n with the (cached) recoding of n
+     */
+    template <class T> void power (T & C, const T & A, const ZZ & n, ExponentRecoding::Type t, long inparam = 0)
+    {
+      get(n, t, inparam).power(C, A);
+    }
+
+    void clear () { cache.clear(); }
+    long size () const { return cache.size(); }
+    long getHits () const { return hits; }
+    long getMisses () const { return misses; }
+  };
+
+} // ANTL
+
+// Template definitions.
+#include "../../../src/Exponentiation/ExponentRecoding_impl.hpp"
+
+#endif // EXPONENT_RECODING_H
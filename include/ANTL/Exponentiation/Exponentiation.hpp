@@ -8,6 +8,7 @@
 #define EXPONENTIATION_H
 
 #include <ANTL/common.hpp>
+#include <ANTL/Exponentiation/InversionFree.hpp>
 
 namespace ANTL
 {
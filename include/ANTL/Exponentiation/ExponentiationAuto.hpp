@@ -0,0 +1,179 @@
+/**
+ * @file ExponentiationAuto.hpp
+ * @brief class for exponentiation with the method chosen from a cost model
+ */
+
+#ifndef EXPONENTIATION_AUTO_H
+#define EXPONENTIATION_AUTO_H
+
+#include <vector>
+#include <iostream>
+#include <ANTL/Exponentiation/Exponentiation.hpp>
+#include <ANTL/Exponentiation/ExponentiationBinary.hpp>
+#include <ANTL/Exponentiation/ExponentiationNAF.hpp>
+#include <ANTL/Exponentiation/ExponentiationWNAF.hpp>
+#include <ANTL/Exponentiation/ExponentiationSB3.hpp>
+#include <ANTL/Exponentiation/ExponentiationDoubleBaseStrictChain.hpp>
+
+namespace ANTL
+{
+
+  /**
+   * @brief class for exponentiation with the method chosen from a cost model
+   * @remarks This concrete class predicts the cost of computing A^n with each
+   * of the available methods (binary, NAF, WNAF with widths 3 to 6, SB3 and
+   * the double base strict chain) and uses the cheapest one.  The prediction
+   * counts the squarings, cubings, multiplications and inversions required by
+   * the recoding of n, weighted with the costs of these operations.  For
+   * types with is_inversion_free<T> (ideals), the signed-digit methods
+   * conjugate once per negative digit instead of inverting a table, and the
+   * inversions are counted that way.  The costs are either timed for a
+   * sample element with calibrate() (for ideals, the relative cost of
+   * NUDUPL, NUCUBE and NUCOMP depends on the discriminant, so a
+   * representative ideal of the order should be used), or set directly
+   * (setCosts(), readCosts()).  Without calibration, all
+   * operations are assumed to have the same cost, except for inversion,
+   * which is assumed to be free.
+   *
+   * Every call to power() appends the predicted costs and the method used to
+   * a trace, which can be inspected with getTrace().
+   *
+   * The methods with a (2,3) greedy representation and Yao's method are not
+   * candidates:  computing the greedy representation is about as expensive
+   * as the exponentiation it would predict.
+   *
+   * The base type is templated, and must have the following
+   * functions defined:
+   *   - assign(T &C, const T &A): sets C = A
+   *   - mul(T &C, const T &A, const T &B): computes C = AB
+   *   - sqr(T &C, const T &A): computes C = AA
+   *   - cub(T &C, const T &A): computes C = AAA
+   *   - inv(T &C, const T &A): computes C = inverse of A
+   */
+  template < class T >
+  class ExponentiationAuto : public Exponentiation<T>
+  {
+
+  public:
+    /**
+     * @brief the candidate methods
+     */
+    enum Method { BINARY, NAF, WNAF3, WNAF4, WNAF5, WNAF6, SB3, STRICT_CHAIN, NUM_METHODS };
+
+    /**
+     * @brief relative costs of the group operations
+     */
+    struct Costs {
+      double mul;
+      double sqr;
+      double cub;
+      double inv;
+    };
+
+    /**
+     * @brief operation counts of a method for one exponent
+     */
+    struct OperationCount {
+      long mul;
+      long sqr;
+      long cub;
+      long inv;
+    };
+
+    /**
+     * @brief one entry of the trace:  the predicted cost of every method and
+     * the method used
+     */
+    struct Decision {
+      long bits;
+      double predicted[NUM_METHODS];
+      Method method;
+    };
+
+  protected:
+    Costs costs;
+    bool tracing;
+    std::vector<Decision> trace;
+
+    void countBinary (OperationCount &ops, const ZZ &n) const;
+    void countNAF (OperationCount &ops, const ZZ &n, short w) const;
+    void countSB3 (OperationCount &ops, const ZZ &n) const;
+    void countStrictChain (OperationCount &ops, const ZZ &n) const;
+
+  public:
+    ExponentiationAuto() : tracing(true) { setCosts(1.0, 1.0, 1.0, 0.0); };
+    ~ExponentiationAuto() {};
+
+    /**
+     * @brief Sets the costs of a multiplication, squaring, cubing and inversion.
+     */
+    void setCosts (double M, double S, double C, double I);
+
+    /**
+     * @brief Times the group operations for the sample element A.  Each
+     * operation is repeated until at least minTime seconds have elapsed.
+     * @param[in] A sample element (e.g. a reduced ideal of the order)
+     * @param[in] minTime minimal time per operation, in seconds
+     */
+    void calibrate (const T &A, double minTime = 0.02);
+
+    /**
+     * @brief Reads the costs written by writeCosts() (four numbers: M S C I).
+     */
+    void readCosts (std::istream &in);
+
+    /**
+     * @brief Writes the costs (four numbers: M S C I).
+     */
+    void writeCosts (std::ostream &out) const;
+
+    const Costs & getCosts () const { return costs; }
+
+    /**
+     * @brief Counts the operations used by method m to compute A^n.
+     */
+    void count (OperationCount &ops, Method m, const ZZ &n) const;
+
+    /**
+     * @brief Returns the predicted cost of method m for the exponent n.
+     */
+    double predict (Method m, const ZZ &n) const;
+
+    /**
+     * @brief Returns the method with the smallest predicted cost for n.
+     * @param[out] predicted if not NULL, the predicted costs of all methods
+     */
+    Method choose (const ZZ &n, double *predicted = NULL) const;
+
+    /**
+     * @brief Computes A^n with the method of smallest predicted cost.
+     * @param[out] C result of computing A^n
+     * @param[in] A base for exponentiation
+     * @param[in] n exponent
+     *
+     * @pre n > 0
+     */
+    void power (T &C, const T &A, const ZZ &n);
+
+    /**
+     * @brief Computes A^n with method m.
+     */
+    void power (T &C, const T &A, const ZZ &n, Method m);
+
+    void setTracing (bool flag) { tracing = flag; }
+    const std::vector<Decision> & getTrace () const { return trace; }
+    void clearTrace () { trace.clear(); }
+
+    /**
+     * @brief Returns the name of method m.
+     */
+    static const char * methodName (Method m);
+
+  };
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../src/Exponentiation/ExponentiationAuto_impl.hpp"
+
+#endif // EXPONENTIATION_AUTO_H
@@ -0,0 +1,129 @@
+/**
+ * @file ExponentiationBatch.hpp
+ * @brief class for raising many bases to the same exponent
+ */
+
+#ifndef EXPONENTIATION_BATCH_H
+#define EXPONENTIATION_BATCH_H
+
+#include <vector>
+#include <thread>
+#include <ANTL/Exponentiation/Exponentiation.hpp>
+#include <ANTL/Exponentiation/ExponentRecoding.hpp>
+#include <ANTL/Exponentiation/ThreadContext.hpp>
+
+namespace ANTL
+{
+
+  /**
+   * @brief class for batch exponentiation (many bases, one exponent)
+   * @remarks This concrete class computes C[i] = A[i]^n for many bases A[i],
+   * as in the computation of the exponent or order of random elements of a
+   * class group.  The exponent is recoded once (by default in WNAF, or with
+   * any ExponentRecoding, e.g. an optimized double base chain), and the
+   * recoded digits are walked in lockstep across blocks of bases:  each step
+   * squares, cubes and multiplies every base of the block before moving to
+   * the next step, so the steps are decoded once per block, and the tables of
+   * odd powers (and their inverses) of a block are computed together.
+   * Unless is_inversion_free<T>, the inverses of all the tables of a block are
+   * computed with a single inversion (Montgomery's trick).
+   *
+   * power(C, A, n) only recodes n if it differs from the exponent of the last
+   * call, so repeated single-base calls with the same exponent also reuse the
+   * recoding.  With set_threads(t), the bases are split between t threads.
+   * Each thread walks its own blocks with its own tables, so the threads
+   * share only the (read-only) recoding and the thread local context of the
+   * caller (e.g., the modulus of zz_p), which every thread restores before
+   * its first block.  The base type is templated, and must have the
+   * following functions defined:
+   *   - assign(T &C, const T &A): sets C = A
+   *   - mul(T &C, const T &A, const T &B): computes C = AB
+   *   - sqr(T &C, const T &A): computes C = AA
+   *   - cub(T &C, const T &A): computes C = AAA
+   *   - inv(T &C, const T &A): computes C = inverse of A
+   */
+  template < class T >
+  class ExponentiationBatch : public Exponentiation<T>
+  {
+
+  protected:
+    static const long blockSize = 64;   /**< bases walked in lockstep */
+
+    ExponentRecoding::Type type;        /**< recoding of new exponents */
+    long param;                         /**< its parameter (see ExponentRecoding::recode()) */
+    ExponentRecoding recoding;          /**< recoding of the current exponent */
+    long threads;                       /**< worker threads */
+
+    void powerRange (vector<T> &C, const vector<T> &A, const long first, const long last) const;
+
+  public:
+    ExponentiationBatch(ExponentRecoding::Type t = ExponentRecoding::WNAF, long inparam = 0)
+      : type(t), param(inparam), threads(1) {};
+    ~ExponentiationBatch() {};
+
+    /**
+     * @brief sets the recoding used for new exponents (and discards the
+     * current one)
+     */
+    void setRecoding (ExponentRecoding::Type t, long inparam = 0)
+    {
+      type = t;
+      param = inparam;
+      recoding = ExponentRecoding();
+    }
+
+    /**
+     * @brief sets the number of worker threads
+     */
+    void set_threads(long n) { threads = (n > 0) ? n : 1; }
+    long get_threads() const { return threads; }
+
+    /**
+     * @brief Recodes the exponent n
+     */
+    void initialize (const ZZ &n) { recoding.recode(n, type, param); }
+
+    /**
+     * @brief Uses the given recoding of the exponent
+     */
+    void initialize (const ExponentRecoding &r) { recoding = r; }
+
+    const ExponentRecoding & getRecoding () const { return recoding; }
+
+    /**
+     * @brief Computes C[i] = A[i]^n with the exponent of the last initialize()
+     * @param[out] C vector of results
+     * @param[in] A vector of bases
+     *
+     * @pre the exponent is nonzero
+     */
+    void power (vector<T> &C, const vector<T> &A) const;
+
+    /**
+     * @brief Computes C[i] = A[i]^n, recoding n unless it is the current exponent
+     * @param[out] C vector of results
+     * @param[in] A vector of bases
+     * @param[in] n exponent
+     *
+     * @pre n != 0
+     */
+    void power (vector<T> &C, const vector<T> &A, const ZZ &n);
+
+    /**
+     * @brief Computes A^n, recoding n unless it is the current exponent
+     * @param[out] C result of computing A^n
+     * @param[in] A base for exponentiation
+     * @param[in] n exponent
+     *
+     * @pre n != 0
+     */
+    void power (T &C, const T &A, const ZZ &n);
+
+  };
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../src/Exponentiation/ExponentiationBatch_impl.hpp"
+
+#endif // EXPONENTIATION_BATCH_H
@@ -104,7 +104,8 @@ namespace ANTL
     */
     void setBounds(long twoBound, long threeBound) {
           powerOfTwoBound = twoBound; 
-          powerOfThreeBound = threeBound; 
+          powerOfThreeBound = threeBound;
+          boundsSet = true;
     }
 
 
@@ -9,6 +9,7 @@
 
 #include <vector>
 #include <ANTL/Exponentiation/Exponentiation.hpp>
+#include <ANTL/Exponentiation/ExponentRecoding.hpp>
 
 namespace ANTL
 {
@@ -18,7 +19,9 @@ namespace ANTL
    * @remarks This concrete class defines a method for double base exponentiation using the 
    * strict chain (2,3) representation  The method first computes the double base representation 
    * of the exponent using the basic right-to-left method, and then applies it to the base
-   * left-to-right. The base type is templated, and must have the following
+   * left-to-right. A precomputed chain (e.g., from DoubleBaseChainOptimizer)
+   * can be set with setChain(); it is used whenever power() is called with
+   * its exponent. The base type is templated, and must have the following
    * functions defined:
    *   - assign(T &C, const T &A): sets C = A
    *   - mul(T &C, const T &A, const T &B): computes C = AB
@@ -33,6 +36,8 @@ namespace ANTL
   protected:
     
     T Ainv;           /**< inverse of the base element */
+    ExponentRecoding chain;   /**< precomputed chain */
+    bool useChain;            /**< true if chain is set */
 
     struct chainElement{
           short sign;
@@ -41,7 +46,7 @@ namespace ANTL
     };
 
   public:
-    ExponentiationDoubleBaseStrictChain() {};
+    ExponentiationDoubleBaseStrictChain() : useChain(false) {};
     ~ExponentiationDoubleBaseStrictChain() {};
 
     /**
@@ -51,6 +56,17 @@ namespace ANTL
      */
     void initialize(const T &A);
 
+    /**
+     * @brief Sets a precomputed chain, used by power() for its exponent
+     * @param[in] R recoding of type STRICT_CHAIN
+     */
+    void setChain(const ExponentRecoding &R);
+
+    /**
+     * @brief Removes the precomputed chain
+     */
+    void clearChain() { useChain = false; }
+
     /**
      * @brief Computes A^n.
      * @param[out] C result of computing A^n using double base strict chain
@@ -0,0 +1,134 @@
+/**
+ * @file ExponentiationFixedBase.hpp
+ * @brief class for fixed-base exponentiation with the Lim-Lee comb method
+ */
+
+#ifndef EXPONENTIATION_FIXED_BASE_H
+#define EXPONENTIATION_FIXED_BASE_H
+
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <ANTL/Exponentiation/Exponentiation.hpp>
+
+namespace ANTL
+{
+
+  /**
+   * @brief class for fixed-base exponentiation with the Lim-Lee comb method
+   * @remarks This concrete class computes A^n for a fixed base A and many
+   * different exponents n of at most l bits.  The exponent is written as an
+   * h x a bit matrix (a = ceil(l/h), row i holds bits i*a .. i*a + a - 1),
+   * whose columns are split into v blocks of b = ceil(a/v) columns.  The
+   * precomputed tables are
+   *     G[s][u] = prod_{i : bit i of u is set} A^(2^(i*a + s*b)),
+   * for 0 <= s < v and 0 < u < 2^h, so that A^n is evaluated with b - 1
+   * squarings and at most v*b multiplications.  The tables hold
+   * v*(2^h - 1) elements; h and v trade memory for time, either directly or
+   * by giving a bound on the table size (see initialize()).
+   *
+   * The tables depend only on the base and are built once.  The const
+   * power(C, n) does not modify the object, so an initialized instance can
+   * be shared read-only by several threads.  The tables can be written to
+   * and read from a stream (write(), read()), provided T supports the
+   * stream operators.
+   *
+   * The base type is templated, and must have the following functions
+   * defined:
+   *   - assign(T &C, const T &A): sets C = A
+   *   - mul(T &C, const T &A, const T &B): computes C = AB
+   *   - sqr(T &C, const T &A): computes C = AA
+   *   - equals(const T &C, const T &A): returns true of C == A, false otherwise.
+   */
+  template < class T >
+  class ExponentiationFixedBase : public Exponentiation<T>
+  {
+
+  protected:
+    T base;             /**< the fixed base A */
+    long l;             /**< maximal bit length of the exponents */
+    long h;             /**< number of rows (the tables have 2^h entries) */
+    long v;             /**< number of tables */
+    long a;             /**< number of columns, ceil(l/h) */
+    long b;             /**< number of columns per table, ceil(a/v) */
+    std::vector<T> G;   /**< G[s*2^h + u] = G[s][u] (u = 0 is unused) */
+
+    /**
+     * @brief chooses h and v minimizing the evaluation cost for tables of at
+     * most maxTable elements
+     */
+    void chooseParameters(long bits, long maxTable);
+
+    /**
+     * @brief builds the tables for the current base and parameters
+     */
+    void precompute();
+
+  public:
+    ExponentiationFixedBase() : l(0), h(0), v(0), a(0), b(0) {};
+    ~ExponentiationFixedBase() {};
+
+    /**
+     * @brief Builds the tables for the base A and exponents of at most bits
+     * bits, with 2^rows entries per table and numTables tables.
+     * @param[in] A base for exponentiation
+     * @param[in] bits maximal bit length of the exponents
+     * @param[in] rows number of rows of the comb (1 <= rows <= 20)
+     * @param[in] numTables number of tables
+     */
+    void initialize(const T &A, long bits, long rows, long numTables);
+
+    /**
+     * @brief Builds the tables for the base A and exponents of at most bits
+     * bits, choosing the parameters with the fewest group operations per
+     * exponentiation among those with at most maxTable table elements.
+     * @param[in] A base for exponentiation
+     * @param[in] bits maximal bit length of the exponents
+     * @param[in] maxTable bound on the number of precomputed elements (>= 1)
+     */
+    void initialize(const T &A, long bits, long maxTable = 256);
+
+    /**
+     * @brief Computes A^n for the base the tables were built for.
+     * @param[out] C result of computing A^n
+     * @param[in] n exponent
+     *
+     * @pre 0 < n < 2^l (LogicError otherwise; C is not modified)
+     */
+    void power (T &C, const ZZ &n) const;
+
+    /**
+     * @brief Computes A^n.  The tables are rebuilt (with the previous
+     * parameters) if A is not the current base or n is too long.
+     * @param[out] C result of computing A^n
+     * @param[in] A base for exponentiation
+     * @param[in] n exponent
+     *
+     * @pre n > 0 (LogicError otherwise, before any table is built)
+     */
+    void power (T &C, const T &A, const ZZ &n);
+
+    /**
+     * @brief Writes the parameters and tables to out.
+     */
+    void write (std::ostream &out) const;
+
+    /**
+     * @brief Reads parameters and tables written by write().
+     */
+    void read (std::istream &in);
+
+    const T & getBase () const { return base; }
+    long getMaxBits () const { return l; }
+    long getRows () const { return h; }
+    long getNumTables () const { return v; }
+    long getTableSize () const { return v*((1L << h) - 1); }
+
+  };
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../src/Exponentiation/ExponentiationFixedBase_impl.hpp"
+
+#endif // EXPONENTIATION_FIXED_BASE_H
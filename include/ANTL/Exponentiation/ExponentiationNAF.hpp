@@ -24,6 +24,8 @@ namespace ANTL
    *   - mul(T &C, const T &A, const T &B): computes C = AB
    *   - sqr(T &C, const T &A): computes C = AA
    *   - inv(T &C, const T &A): computes C = inverse of A
+   * If is_inversion_free<T>, the inverse of A is not precomputed, and each
+   * digit -1 inverts A on the fly.
    */
   template < class T >
   class ExponentiationNAF : public Exponentiation<T> 
@@ -31,7 +33,7 @@ namespace ANTL
 
   protected:
     vector<short> e;  /**< vector containing NAF expansion of exponent */
-    T Ainv;           /**< inverse of the base element */
+    T Ainv;           /**< inverse of the base element (scratch if T is inversion free) */
 
   public:
     ExponentiationNAF() {};
@@ -24,6 +24,8 @@ namespace ANTL
    *   - mul(T &C, const T &A, const T &B): computes C = AB
    *   - sqr(T &C, const T &A): computes C = AA
    *   - inv(T &C, const T &A): computes C = inverse of A
+   * If is_inversion_free<T>, the inverses of the precomputed powers are not
+   * stored, and negative digits invert their power on the fly.
    */
   template < class T >
   class ExponentiationWNAF : public Exponentiation<T> 
@@ -31,8 +33,8 @@ namespace ANTL
 
   protected:
     vector<short> e;  /**< vector containing WNAF expansion of exponent */
-    T * precomp;      /**< array containing precomputed values used for WNAF */
-    T * precompInv;   /**< array containing the inverses of the values in precomp */ 
+    vector<T> precomp;     /**< precomputed values used for WNAF */
+    vector<T> precompInv;  /**< the inverses of the values in precomp (empty if T is inversion free) */
     short w;	      /**< width of WNAF representation */
 
   public:
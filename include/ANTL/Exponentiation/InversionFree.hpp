@@ -0,0 +1,71 @@
+/**
+ * @file InversionFree.hpp
+ * @brief trait for base types whose inverses are (almost) free
+ */
+
+#ifndef INVERSION_FREE_H
+#define INVERSION_FREE_H
+
+#include <vector>
+
+namespace ANTL
+{
+
+  /**
+   * @brief trait for base types with inversion as cheap as an assignment
+   * @remarks Signed-digit exponentiation methods (NAF, WNAF, SB3, JSF,
+   * HBTJSF) normally precompute the inverses of their tables once.  If
+   * is_inversion_free<T>::value is true, e.g., for ideals of quadratic orders,
+   * where the inverse of the class of (a, b, c) is that of its conjugate
+   * (a, -b, c), the inverses are not stored; instead, each multiplication by
+   * an inverse inverts its operand on the fly with mulinv().  Specialize the
+   * trait next to the definition of inv() for such types.
+   */
+  template < class T >
+  struct is_inversion_free
+  {
+    static const bool value = false;
+  };
+
+  /**
+   * @brief computes C = A B^-1, using Binv as scratch space for the inverse
+   */
+  template < class T >
+  inline void mulinv (T &C, const T &A, const T &B, T &Binv)
+  {
+    inv(Binv, B);
+    mul(C, A, Binv);
+  }
+
+  /**
+   * @brief computes Inv[t] = A[t]^-1 for all t with a single inversion
+   * (Montgomery's trick), using prefix as scratch space:  prefix[t] is the
+   * product of the first t+1 entries
+   */
+  template < class T >
+  void batchinv (std::vector<T> &Inv, const std::vector<T> &A, std::vector<T> &prefix)
+  {
+    long n = A.size(), t;
+    T acc, tmp;
+
+    Inv.resize(n);
+    if (n == 0)
+      return;
+    prefix.resize(n);
+
+    assign(prefix[0], A[0]);
+    for (t = 1; t < n; ++t)
+      mul(prefix[t], prefix[t-1], A[t]);
+
+    inv(acc, prefix[n-1]);
+    for (t = n - 1; t > 0; --t) {
+      mul(Inv[t], acc, prefix[t-1]);
+      mul(tmp, acc, A[t]);
+      assign(acc, tmp);
+    }
+    assign(Inv[0], acc);
+  }
+
+} // ANTL
+
+#endif // INVERSION_FREE_H
@@ -8,6 +8,7 @@
 #define MULTIEXPONENTIATION_H
 
 #include <ANTL/common.hpp>
+#include <ANTL/Exponentiation/InversionFree.hpp>
 #include <vector>
 
 namespace ANTL 
@@ -0,0 +1,122 @@
+/**
+ * @file MultiExponentiationInterleaved.hpp
+ * @brief class for interleaved wNAF multi-exponentiation (Straus-Shamir with
+ * one window width per base)
+ */
+
+#ifndef MULTIEXPONENTIATION_INTERLEAVED_H
+#define MULTIEXPONENTIATION_INTERLEAVED_H
+
+#include <vector>
+#include <ANTL/Exponentiation/MultiExponentiation/MultiExponentiation.hpp>
+
+namespace ANTL
+{
+
+  /**
+   * @brief class for interleaved wNAF multi-exponentiation
+   * @remarks This concrete class computes A[0]^n[0] * ... * A[k-1]^n[k-1] for a
+   * moderate number of bases (say 3 to 32), generalizing DoubleExponentiationIL.
+   * Each exponent is recoded in width-w[i] NAF, where w[i] is chosen from the
+   * bit length of n[i], and the digits of all exponents are applied
+   * left-to-right to a single accumulator, so that the squarings are shared
+   * by all bases:  the cost is max NumBits(n[i]) squarings plus about
+   * sum NumBits(n[i])/(w[i]+1) multiplications, and the tables of the odd
+   * powers A[i]^(2j+1).
+   *
+   * The tables depend only on the bases and are reused by power(C, n) until
+   * the next initialize(); power(C, A, n) builds them for the given exponents.
+   * Exponents may be negative or zero.  Unless is_inversion_free<T>, the
+   * inverses of the tables are computed with a single inversion
+   * (Montgomery's trick).  The base type is templated, and must have the
+   * following functions defined:
+   *   - assign(T &C, const T &A): sets C = A
+   *   - mul(T &C, const T &A, const T &B): computes C = AB
+   *   - sqr(T &C, const T &A): computes C = AA
+   *   - inv(T &C, const T &A): computes C = inverse of A
+   */
+  template < class T >
+  class MultiExponentiationInterleaved : public MultiExponentiation<T>
+  {
+
+  protected:
+    vector<short> w;                /**< window width for each base */
+    vector<vector<T> > precomp;     /**< precomp[i][j] = A[i]^(2j+1) */
+    vector<vector<T> > precompInv;  /**< inverses of precomp (empty if T is inversion free) */
+    vector<vector<short> > e;       /**< wNAF digits of the exponents */
+    T scratch;                      /**< inverse computed on the fly */
+
+    void recode(vector<short> &digits, const ZZ &n, const short width);
+
+  public:
+    MultiExponentiationInterleaved() {};
+    ~MultiExponentiationInterleaved() {};
+
+    /**
+     * @brief returns the window width minimizing the table size plus the
+     * number of nonzero digits of a bits-bit exponent (between 2 and 8)
+     */
+    static short chooseWidth(const long bits);
+
+    /**
+     * @brief Computes the tables of A[i] for exponents of at most bits[i] bits
+     * @param[in] A vector of bases
+     * @param[in] bits bit lengths of the exponents
+     *
+     * @pre len(A) = len(bits)
+     */
+    void initialize(const vector<T> &A, const vector<long> &bits);
+
+    /**
+     * @brief Computes the tables of A[i] with the window widths inw[i]
+     * @param[in] A vector of bases
+     * @param[in] inw window widths
+     *
+     * @pre len(A) = len(inw)
+     * @pre 2 <= inw[i] <= 15
+     */
+    void initializeWidths(const vector<T> &A, const vector<short> &inw);
+
+    /**
+     * @brief Computes C = A[0]^n[0] * ... * A[k-1]^n[k-1] with the tables of
+     * the last initialize()
+     * @param[out] C result
+     * @param[in] n vector of exponents
+     *
+     * @pre len(n) = number of bases
+     * @pre some n[i] != 0
+     */
+    void power(T &C, const vector<ZZ> &n);
+
+    /**
+     * @brief Computes C = A[0]^n[0] * ... * A[k-1]^n[k-1]
+     * @param[out] C result
+     * @param[in] A vector of bases
+     * @param[in] n vector of exponents
+     *
+     * @pre len(A) = len(n)
+     * @pre some n[i] != 0
+     */
+    void power(T &C, const vector<T> &A, const vector<ZZ> &n);
+
+    /**
+     * @brief Computes C[j] = A[0]^n[j][0] * ... * A[k-1]^n[j][k-1], sharing
+     * the tables of A between the rows
+     * @param[out] C vector of results
+     * @param[in] A vector of bases
+     * @param[in] n vector of vectors of exponents
+     *
+     * @pre len(A) = len(n[j]) for all j
+     */
+    void power(vector<T> &C, const vector<T> &A, const vector<vector<ZZ> > &n);
+
+    long numberOfBases() const { return precomp.size(); }
+    const vector<short> & getWidths() const { return w; }
+  };
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../../src/MultiExponentiation/MultiExponentiationInterleaved_impl.hpp"
+
+#endif // MULTIEXPONENTIATION_INTERLEAVED_H
@@ -3,14 +3,16 @@
  * @author Michael Jacobson/Reginald Lybbert
  * @brief class for Pippenger's Multi-exponentiation Algorithm, as described in
  * "Pippenger's Multiproduct and Multiexponentiation Algorithms"; Ryan Henry; 2010
- * 
+ *
  *   cacr.uwaterloo.ca/techreports/2010/cacr2010-26.pdf
  */
 
 #ifndef MULTIEXPONENTIATION_PIPPENGER_H
 #define MULTIEXPONENTIATION_PIPPENGER_H
 
-#include <ANTL/MultiExponentiation/MultiExponentiation.hpp>
+#include <thread>
+#include <ANTL/Exponentiation/MultiExponentiation/MultiExponentiation.hpp>
+#include <ANTL/Exponentiation/ThreadContext.hpp>
 
 namespace ANTL
 {
@@ -18,117 +20,108 @@ namespace ANTL
   /**
    * @brief class for Pippenger's multi-exponentiation algorithm
    * @remarks This concrete class defines a method for Pippenger's multi-exponentiation
-   * algorithm.
+   * algorithm.  The exponents are split into r words of b bits, which turns the
+   * multi-exponentiation into a multiproduct:  the inputs are the rN powers
+   * A[i]^(2^(wb)), and each output row is the product of the inputs selected
+   * by one bit position of the words.  The rows are stored as sets of input
+   * indices in a flat (CSR) layout, and the multiproduct partitions the
+   * inputs into blocks of c, whose 2^c subset products are computed once per
+   * block in a preallocated table and shared by all rows.  Finally, the b
+   * rows of each output are combined with b-1 squarings and multiplications.
+   *
+   * The output rows are processed in chunks, which bounds the memory of the
+   * index sets, and with set_threads(t), both the powers A[i]^(2^(wb)) and
+   * the output rows are computed by t threads.  The workers start from the
+   * thread local context of the caller (thread_context<T>, e.g., the
+   * modulus of zz_p), and otherwise require the arithmetic of T to be thread
+   * safe.  The base type is templated, and must have the following
+   * functions defined:
    *   - assign(T &C, const T &A): sets C = A
    *   - mul(T &C, const T &A, const T &B): computes C = AB
    *   - sqr(T &C, const T &A): computes C = AA
    *   - id(T &C): sets C = 1  (or whatever the identity is in the group T represents)
    */
   template < class T >
-  class MultiExponentiationPippenger : public MultiExponentiation<T> 
+  class MultiExponentiationPippenger : public MultiExponentiation<T>
   {
 
   protected:
-      /* @param[out] x_prime: the set of new inputs
-       * @param[out] y_prime: the set of new outputs
-       * @param[in] x: the set of inputs
-       * @param[in] y: the set of desired outputs
-       * @param[in] r: the radix
-       * @param[in] b: the word-length
-       *
-       * @pre r*b >= lg(y[i][j] + 1) for all i,j 
-       *
-       */
-    void decompose( vector<T> &x_prime, vector<vector<long> > &y_prime,
-                    const vector<T> &x, const vector<vector<ZZ> > &y, const long r, const long b );
-
-      /* @param[out] C: the set of outputs
-       * @param[in] x: the set of inputs
-       * @param[in] y: the set of desired outputs, expressed in terms of indices of x
-       */
-    void combine( vector<T> &C, const vector<T> &x, const long &r);
+    /**
+     * @brief sets of input indices in compressed sparse row layout:  row j
+     * is index[start[j]], ..., index[start[j+1]-1], in increasing order
+     */
+    struct IndexSets {
+      vector<long> start;
+      vector<long> index;
 
-      /* @param[out] C: the set of outputs
-       * @param[in]  x: the set of inputs
-       * @param[in] r:  the radix
-       */
+      long rows () const { return start.size() - 1; }
+    };
 
-    void multiprod( vector<T> &C, const vector<T> &x, const vector<vector<long> > &y); 
+    long threads;       /**< worker threads */
 
-      /* @param[out] ell: the iteration limit
-       * @param[out] c: the initial clumping factor
-       * @param[out] alpha: the clumping factors
-       * @param[out] beta: the grouping factors
+      /* @param[out] x_prime: the set of new inputs, x_prime[i*r + w] = x[i]^(2^(wb))
        * @param[in] x: the set of inputs
-       * @param[in] y: the set of desired outputs
-       *
+       * @param[in] r: the radix
+       * @param[in] b: the word-length
        */
-    void getParams( long &ell, long &c, vector<long> &alpha, vector<long> &beta, const vector<T> &x, const vector<vector<long> > &y);
-
-      /* @param[out] C: the set of outputs
-       * @param[in] i: the current iteration index
-       * @param[in] ell: the iteration limit
-       * @param[in] c: the initial clumping factor
-       * @param[in] alpha: the clumping factors
-       * @param[in] beta: the grouping factors
-       * @param[in] x: the set of inputs
-       * @param[in] y: the set of desired outputs
+    void decompose( vector<T> &x_prime, const vector<T> &x, const long r, const long b );
+
+      /* @param[out] y_prime: the index sets of the rows of outputs first, ..., last-1
+       * @param[in] y: the exponents
+       * @param[in] first, last: the range of outputs
+       * @param[in] r: the radix
+       * @param[in] b: the word-length
        *
+       * @pre r*b >= lg(y[i][j] + 1) for all i,j
        */
-    void computeMultiProd( vector<T> &C, const long i, const long &ell, const long &c, const vector<long> &alpha, 
-                            const vector<long> &beta, const vector<T> &x, const vector<vector<long> > &y);
+    void decompose( IndexSets &y_prime, const vector<vector<ZZ> > &y, const long first, const long last,
+                    const long r, const long b );
 
-      /* @param[out] x_prime: the set of new inputs
-       * @param[out] y_prime: the set of new outputs
+      /* @param[out] C: the products of the sets of y
        * @param[in] x: the set of inputs
-       * @param[in] y: the set of desired outputs
-       * @param[in] c: the initial clumping factor
-       *
+       * @param[in] y: the sets of inputs to multiply
+       * @param[in,out] table: scratch space for the subset products of a block
+       * @param[in,out] pos: scratch space for the position in each row
        */
-    void inputPartition(vector<T> &x_prime, vector<vector<long> > &y_prime, const vector<T> &x,
-                          const vector<vector<long> > &y, const long &c);
- 
-      /* @param[out] y_prime: the set of new outputs
-       * @param[out] y_doubleprime: the set of original outputs, expressed in terms of both new and old outputs
-       * @param[in] x: the set of inputs
-       * @param[in] y: the set of desired outputs
-       * @param[in] beta: the grouping factor
-       * @param[in] alpha: the clumping factor
-       *
+    void multiprod( vector<T> &C, const vector<T> &x, const IndexSets &y, vector<T> &table, vector<long> &pos );
+
+      /* @param[out] C: C[offset + q] is the combination of the rows qb, ..., qb+b-1 of x
+       * @param[in] offset: the first output
+       * @param[in] x: the multiproducts of the rows
+       * @param[in] b: the word-length
        */
-    void outputClump(vector<vector<long> > &y_prime, vector<vector<long> > &y_doubleprime, 
-                        const vector<T> &x, const vector<vector<long> > &y, const long alpha, const long beta);
-  
-      /* @param[out] x_prime: the set of new inputs
-       * @param[out] y_prime: the set of new outputs
-       * @param[in] x: the set of inputs
-       * @param[in] y: the set of desired outputs
-       * @param[in] beta: the grouping factor
-       * @param[in] alpha: the clumping factor
-       *
+    void combine( vector<T> &C, const long offset, const vector<T> &x, const long b );
+
+      /* @param[out] r: the radix
+       * @param[out] b: the word-length
+       * @param[in] inputs: the number of bases
+       * @param[in] outputs: the number of outputs per chunk
+       * @param[in] bits: the length of the longest exponent
        */
-    void inputClump(vector<T> &x_prime, vector<vector<long> > &y_prime, const vector<T> &x,
-                        const vector<vector<long> > &y, const long alpha, const long beta);
-    
+    static void getParams( long &r, long &b, const long inputs, const long outputs, const long bits );
 
-      /* @param[out] C: the set of outputs
-       * @param[in] x: the set of inputs
-       * @param[in] y: the set of desired outputs, expressed in terms of indices of x
+      /* @brief returns the block size c minimizing the cost (X/c)(2^c + R) of a
+       * multiproduct with X inputs and R rows
        */
-    void naiveMultiply(vector<T> &C, const vector<T> &x, const vector<vector<long> > &y);
+    static long blockSize( const long inputs, const long rows );
 
   public:
-    MultiExponentiationPippenger() {};
+    MultiExponentiationPippenger() : threads(1) {};
     ~MultiExponentiationPippenger() {};
 
+    /**
+     * @brief sets the number of worker threads
+     */
+    void set_threads(long n) { threads = (n > 0) ? n : 1; }
+    long get_threads() const { return threads; }
 
     /* @brief Computes C[j] = A[1]^n[j][1]*A[2]^n[j][2]*...*A[i]^n[j][i] using Pippenger's algorithm
      * @param[out] C vector of results of computing A[1]^n[j][1]*A[2]^n[j][2]*...*A[i]^n[j][i].
      * @param[in] A vector of bases for exponentiation
      * @param[in] n vector of exponents
      *
-     * @pre len(A) = len(n)
-     * @pre n[i] > 0 for all i
+     * @pre len(A) = len(n[j]) for all j
+     * @pre n[j][i] >= 0 for all i, j
      */
     void power(vector<T> &C, const vector<T> &A, const vector<vector<ZZ> > &n);
 
@@ -137,7 +130,6 @@ namespace ANTL
 } // ANTL
 
 // Unspecialized template definitions.
-#include "../../../src/MultiExponentiation/MultiExponentiationPippenger_impl.hpp"
+#include "../../../../src/MultiExponentiation/MultiExponentiationPippenger_impl.hpp"
 
 #endif // MULTIEXPONENTIATION_PIPPENGER_H
-
@@ -0,0 +1,45 @@
+/**
+ * @file ThreadContext.hpp
+ * @brief trait carrying the thread local context of a base type to worker threads
+ */
+
+#ifndef THREAD_CONTEXT_H
+#define THREAD_CONTEXT_H
+
+namespace ANTL
+{
+
+  template < class U >
+  struct thread_context_void
+  {
+    typedef void type;
+  };
+
+  /**
+   * @brief the thread local context (e.g., the modulus) of the elements of T
+   * @remarks NTL's modular types (zz_p, ZZ_p, zz_pE, ZZ_pE, GF2E) keep their
+   * modulus in a thread local context, which a new thread does not inherit.
+   * Multi-threaded methods call save() in the calling thread, and restore()
+   * first thing in each worker.  If T has a member typedef context_type, as
+   * the NTL types do, that context is saved and restored; for all other types
+   * (e.g., ideals, which carry a pointer to their order), both are no-ops.
+   */
+  template < class T, class = void >
+  struct thread_context
+  {
+    void save () {}
+    void restore () const {}
+  };
+
+  template < class T >
+  struct thread_context<T, typename thread_context_void<typename T::context_type>::type>
+  {
+    typename T::context_type context;
+
+    void save () { context.save(); }
+    void restore () const { context.restore(); }
+  };
+
+} // ANTL
+
+#endif // THREAD_CONTEXT_H
@@ -0,0 +1,117 @@
+/**
+ * @file CompactRepresentation.hpp
+ * @brief compact representations of elements of real quadratic orders
+ */
+
+#ifndef ANTL_COMPACT_REPRESENTATION_H
+#define ANTL_COMPACT_REPRESENTATION_H
+
+#include <vector>
+
+#include <NTL/ZZ.h>
+#include <NTL/RR.h>
+
+#include <ANTL/common.hpp>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticInfrastructureElement_fp.hpp>
+
+using namespace ANTL;
+
+namespace ANTL
+{
+  template < class T > class CompactRepresentation;
+  template < class T > class QuadraticOrder;
+  template < class T > class FPRepresentation;
+
+  // declare templated friend functions
+  template < class T >
+  void mul (CompactRepresentation<T> &C, const CompactRepresentation<T> &A, const CompactRepresentation<T> &B);
+
+  template < class T >
+  void inv (CompactRepresentation<T> &C, const CompactRepresentation<T> &A);
+
+  template < class T >
+  std::ostream & operator << (std::ostream & out, const CompactRepresentation<T> &A);
+
+  template < class T >
+  void compact_representation (CompactRepresentation<T> &E, const FPRepresentation<T> &eps);
+
+
+  /**
+   * @brief Compact representation of an element of a real quadratic order.
+   * @remarks The element is stored as a product
+   *    gamma = prod_i ((x_i + y_i sqrt(Delta))/z_i)^(2^e_i)
+   * of quadratic numbers of small height (polynomial in Delta).  A compact
+   * representation of the fundamental unit has O(log R) factors, so it needs
+   * O(log(Delta)^2) bits, whereas the fundamental unit itself has
+   * O(sqrt(Delta)) digits.
+   *
+   * All operations work on the factors, i.e., without expanding the product:
+   *    - mul() concatenates the factors, inv() inverts each factor,
+   *    - sign() and norm() only need the factors with e_i = 0 (all other
+   *      factors are squares), so norm() is exact for units,
+   *    - eval_mod() evaluates in (Z/pZ)[sqrt(Delta)],
+   *    - log() returns log|gamma| (used to check against the regulator).
+   *
+   * compact_representation() computes a compact representation of the
+   * fundamental unit from its (f,p) approximation (as returned by
+   * RegulatorBSGS<T>::fundamental_unit()).  It raises an error if the
+   * distance of the approximation does not lead back to the order.
+   *
+   * Currently, the template parameter T has been instantiated for:
+   *    long --- order in quadratic number field (word sized D)
+   *    ZZ --- order in a quadratic number field (arbitrary sized D)
+   */
+  template < class T > class CompactRepresentation
+  {
+  protected:
+    struct Factor {
+      ZZ x;
+      ZZ y;
+      ZZ z;
+      long e;
+    };
+
+    QuadraticOrder<T> *QO;
+    ZZ Delta;
+    std::vector<Factor> factors;
+
+    static long sign_of (const ZZ & x, const ZZ & y, const ZZ & D);
+
+  public:
+    CompactRepresentation (QuadraticOrder<T> & inQO);
+    ~CompactRepresentation ();
+
+    // assignment
+    void assign_one ();
+    void append (const ZZ & x, const ZZ & y, const ZZ & z, long e);
+
+    // access
+    long length () const { return factors.size(); }
+    const ZZ & get_x (long i) const { return factors[i].x; }
+    const ZZ & get_y (long i) const { return factors[i].y; }
+    const ZZ & get_z (long i) const { return factors[i].z; }
+    long get_e (long i) const { return factors[i].e; }
+    long size_in_bits () const;
+    QuadraticOrder<T> * get_QO () const { return QO; }
+
+    // properties
+    long sign () const;
+    long norm () const;
+    bool eval_mod (ZZ & u, ZZ & v, const ZZ & p) const;
+    void log (RR & l) const;
+
+    // arithmetic
+    friend void mul < T > (CompactRepresentation<T> &C, const CompactRepresentation<T> &A, const CompactRepresentation<T> &B);
+    friend void inv < T > (CompactRepresentation<T> &C, const CompactRepresentation<T> &A);
+
+    // output
+    friend std::ostream & operator << < T > (std::ostream & out, const CompactRepresentation<T> &A);
+  };
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../src/Quadratic/CompactRepresentation_impl.hpp"
+
+#endif // guard
@@ -29,6 +29,9 @@ namespace ANTL {
     protected:
       ZZ sqrt_delta;   // = floor(SquareRoot(abs(Delta)))
 
+      // NUCUBE for characteristic 2 (b^2 + bh + ac = f)
+      void cube_char2(QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> & A);
+
     public:
       ~CubeNucube() { };
 
@@ -48,6 +51,7 @@ template <> void CubeNucube<long>::init(const long & delta_in, const long & h_in
 template <> void CubeNucube<long>::cube(QuadraticIdealBase<long> & C, const QuadraticIdealBase<long> & A);
 
 template <> void CubeNucube<GF2EX>::cube(QuadraticIdealBase<GF2EX> & C, const QuadraticIdealBase<GF2EX> & A);
+template <> void CubeNucube<GF2nX>::cube(QuadraticIdealBase<GF2nX> & C, const QuadraticIdealBase<GF2nX> & A);
 
 } //ANTL
 
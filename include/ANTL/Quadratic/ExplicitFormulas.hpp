@@ -0,0 +1,49 @@
+/**
+ * @file ExplicitFormulas.hpp
+ * @brief explicit formulas for ideal (divisor class) arithmetic in imaginary
+ *        quadratic function fields of genus 2 and 3 over zz_p
+ */
+
+#ifndef ANTL_EXPLICIT_FORMULAS_H
+#define ANTL_EXPLICIT_FORMULAS_H
+
+#include <NTL/lzz_p.h>
+#include <NTL/lzz_pX.h>
+
+#include <ANTL/common.hpp>
+
+NTL_CLIENT
+
+namespace ANTL
+{
+  /**
+   * @brief Explicit addition and doubling of reduced ideals of the maximal
+   *        order of zz_p(x, sqrt(f)), deg f = 2g+1, g = 2 or 3, p odd.
+   * @remarks An ideal (a, b, c) with b^2 - a c = f is the divisor with Mumford
+   * representation (a, b).  The formulas follow Cantor's algorithm, specialized
+   * to the generic case and written out on the coefficients:
+   *    - inputs have deg a = g (a monic) and deg b < g,
+   *    - s = (b2 - b1)/(a1 - a2) mod a2 (resp. s = k/(2b) mod a for doubling,
+   *      with k = (f - b^2)/a) has degree g - 1,
+   *    - for g = 2 this gives the reduced result directly (Lange's formulas),
+   *      for g = 3 one reduction step is required.
+   * Only one inversion in zz_p is used for g = 2 and two for g = 3.  The
+   * results are reduced (a monic, deg a = g, deg b < g), with c = (b^2 - f)/a.
+   *
+   * If the inputs are not of this form, or the case is special (a1 and a2
+   * not coprime, s of smaller degree), false is returned and the outputs are
+   * not modified; the caller should then use the generic algorithms.
+   * Outputs may alias inputs.
+   */
+  bool explicit_add (zz_pX & Ca, zz_pX & Cb, zz_pX & Cc,
+                     const zz_pX & a1, const zz_pX & b1,
+                     const zz_pX & a2, const zz_pX & b2,
+                     const zz_pX & f, long genus);
+
+  bool explicit_dbl (zz_pX & Ca, zz_pX & Cb, zz_pX & Cc,
+                     const zz_pX & a, const zz_pX & b,
+                     const zz_pX & f, long genus);
+
+} // ANTL
+
+#endif // guard
@@ -0,0 +1,41 @@
+/**
+ * @file PrimeTable.hpp
+ * @brief shared table of small primes for L-function approximations
+ */
+
+#ifndef ANTL_PRIME_TABLE_H
+#define ANTL_PRIME_TABLE_H
+
+#include <vector>
+#include <mutex>
+
+#include <ANTL/common.hpp>
+
+namespace ANTL
+{
+  /**
+   * @brief Process-wide table of the primes up to some bound.
+   * @remarks The table is computed once with a sieve of Eratosthenes and
+   * extended (by at least doubling the bound) when a larger bound is
+   * requested, so that all L-function approximations share the same primes.
+   * Extensions are serialized with a mutex.  References returned by
+   * primes() remain valid until the next extension, so threads should call
+   * extend() with the largest bound they need before working in parallel.
+   */
+  class PrimeTable
+  {
+  protected:
+    static std::vector<long> table;
+    static long limit;
+    static std::mutex lock;
+
+  public:
+    static void extend (long bound);
+    static const std::vector<long> & primes (long bound);
+    static long count (long bound);
+    static long get_limit () { return limit; }
+  };
+
+} // ANTL
+
+#endif // guard
@@ -0,0 +1,94 @@
+/**
+ * @file QuadraticLfunction.hpp
+ * @brief approximation of L(1,chi) for quadratic orders
+ */
+
+#ifndef ANTL_QUADRATIC_LFUNCTION_H
+#define ANTL_QUADRATIC_LFUNCTION_H
+
+#include <vector>
+
+#include <NTL/ZZ.h>
+#include <NTL/RR.h>
+
+#include <ANTL/common.hpp>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/Lfunction/PrimeTable.hpp>
+
+using namespace ANTL;
+
+namespace ANTL
+{
+  template < class T > class QuadraticOrder;
+
+  /**
+   * @brief Approximation of L(1,chi_Delta) by a weighted truncated Euler
+   *        product (Bach).
+   * @remarks With weights a_i = (Q+i) log(Q+i) / sum_j (Q+j) log(Q+j),
+   * 0 <= i < Q,
+   *    log L(1,chi) ~ sum_i a_i sum_{p^k < Q+i} chi(p)^k / (k p^k),
+   * so each prime power n < 2Q contributes with the tail weight
+   * sum_{Q+i > n} a_i (1 for n < Q).  Assuming ERH, the error in log L is
+   * at most
+   *    (A log|Delta| + B) / (sqrt(Q) log(Q)).
+   * The constants A and B are configurable; Q can be set directly or from a
+   * required bound on the error.  The default error is log(sqrt(2)), as
+   * needed for class number bounds in BSGS.
+   *
+   * The primes are taken from the shared PrimeTable.  The Kronecker symbols
+   * are computed for blocks of primes at once: the residues Delta mod p are
+   * computed for the block, followed by one call to the block version of
+   * Jacobi_base().
+   *
+   * Currently, the template parameter T has been instantiated for:
+   *    long --- order in quadratic number field (word sized D)
+   *    ZZ --- order in a quadratic number field (arbitrary sized D)
+   */
+  template < class T > class QuadraticLfunction
+  {
+  protected:
+    QuadraticOrder<T> *QO;
+    ZZ Delta;
+
+    long Q;         // the Euler product uses prime powers < 2Q
+    long block;     // number of primes per Kronecker symbol block
+    double A;       // error constants
+    double B;
+
+    bool computed;
+    double logL;
+
+    void compute ();
+
+  public:
+    QuadraticLfunction (QuadraticOrder<T> & inQO);
+    ~QuadraticLfunction ();
+
+    // parameters
+    void set_Q (long inQ);
+    void set_error (double err);
+    void set_error_constants (double inA, double inB);
+    void set_block_size (long inblock);
+
+    long get_Q () const { return Q; }
+    long get_block_size () const { return block; }
+    double error_bound () const;
+    static double error_bound (const ZZ & D, long inQ, double inA, double inB);
+    static long choose_Q (const ZZ & D, double err, double inA, double inB);
+
+    // Kronecker symbols
+    long kronecker (long p) const;
+    void kronecker (long *chi, const long *P, long len) const;
+
+    // approximations
+    void log_L (RR & l);
+    void L (RR & l);
+    void bounds (RR & lower, RR & upper);
+  };
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../../src/Quadratic/Lfunction/QuadraticLfunction_impl.hpp"
+
+#endif // guard
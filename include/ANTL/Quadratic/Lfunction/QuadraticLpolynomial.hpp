@@ -0,0 +1,129 @@
+/**
+ * @file QuadraticLpolynomial.hpp
+ * @brief L-polynomial of a hyperelliptic function field from a truncated
+ *        Euler product
+ */
+
+#ifndef ANTL_QUADRATIC_LPOLYNOMIAL_H
+#define ANTL_QUADRATIC_LPOLYNOMIAL_H
+
+#include <vector>
+#include <thread>
+
+#include <NTL/ZZ.h>
+#include <NTL/RR.h>
+
+#include <ANTL/common.hpp>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+
+using namespace ANTL;
+
+namespace ANTL
+{
+  template < class T > class QuadraticOrder;
+
+  /**
+   * @brief L-polynomial L(u) = prod_{j=1}^{2g} (1 - alpha_j u) of the
+   *        function field of y^2 + h y = f over F_q, and the order of the
+   *        Jacobian L(1).
+   * @remarks The Euler product over the monic irreducible P with
+   * deg P <= lambda gives the power sums s_nu = sum_j alpha_j^nu for
+   * nu <= lambda exactly:
+   *    s_nu = -sum_{deg P | nu} deg P chi(P)^(nu/deg P) - chi(inf)^nu,
+   * where chi(P) = 1, 0, -1 if P splits, ramifies, or is inert and
+   * chi(inf) = 1, 0, -1 for real, imaginary, and unusual orders.  The
+   * coefficients a_i, i <= lambda, follow with Newton's identities.
+   *
+   * If lambda >= g, the functional equation a_{2g-i} = q^(g-i) a_i gives
+   * L(u), and the Jacobian order
+   *    L(1) = sum_{i<g} a_i (1 + q^(g-i)) + a_g
+   * exactly.  Otherwise, L(1) = q^g L(1/q) is approximated by
+   *    E = q^g exp(-sum_{nu<=lambda} s_nu / (nu q^nu))
+   * with |log L(1) - log E| <= 2g/(lambda+1) q^(-(lambda+1)/2) / (1 - q^(-1/2))
+   * (by the Riemann hypothesis for curves, |alpha_j| = sqrt(q)).
+   *
+   * The monic polynomials of degree nu are enumerated by their q-adic
+   * representation, so the cost is O(q^lambda) irreducibility
+   * tests.  By default, lambda = g if q^g <= 2^20, and otherwise the largest
+   * lambda <= g with q^lambda <= 2^16.
+   *
+   * Alternatively (set_point_counting), the sums
+   *    t_nu = sum_{deg P | nu} deg P chi(P)^(nu/deg P) = sum_{x in F_q^nu} chi_nu(x)
+   * are computed by counting points over F_q^nu = F_q[x]/(P_nu): chi_nu(x)
+   * is Jacobi(f(x), P_nu) (char <> 2), resp. 0 if h(x) = 0 and otherwise
+   * +1/-1 according to the trace of f(x)/h(x)^2 (char 2).  The field
+   * elements are split into blocks over the worker threads (set_threads).
+   * The curve then has
+   *    N_nu = q^nu + t_nu + 1 + chi(inf)^nu
+   * points over F_q^nu (count_points), and s_nu = q^nu + 1 - N_nu.
+   *
+   * Currently, the template parameter T has been instantiated for:
+   *    zz_pX --- hyperelliptic function field over Fp (char <> 2, p < 2^64)
+   *    ZZ_pX --- hyperelliptic function field over Fp (char <> 2)
+   *    GF2EX --- hyperelliptic function field (char = 2)
+   */
+  template < class T > class QuadraticLpolynomial
+  {
+  protected:
+    QuadraticOrder<T> *QO;
+    T f;             // y^2 + h y = f
+    T h;
+    ZZ q;            // cardinality of the constant field
+    long g;          // genus
+    long lambda;     // the Euler product uses primes of degree <= lambda
+    long chi_inf;    // splitting of the infinite place
+
+    bool point_counting; // t_nu by point counting instead of the Euler product
+    long threads;        // worker threads for point counting
+
+    bool computed;
+    std::vector<ZZ> s;   // power sums s_nu, 1 <= nu <= lambda
+    std::vector<ZZ> a;   // coefficients a_i, 0 <= i <= min(lambda, g)
+
+    void element (T & x, const ZZ & X) const;
+    long character (const T & P) const;
+    long character (const T & x, const T & P) const;
+    long character_sum (const T & P, const ZZ & first, const ZZ & last) const;
+    void prime_sums (std::vector<ZZ> & tnu) const;
+    void compute ();
+
+  public:
+    QuadraticLpolynomial (QuadraticOrder<T> & inQO);
+    ~QuadraticLpolynomial ();
+
+    // parameters
+    void set_degree_bound (long inlambda);
+    long get_degree_bound () const { return lambda; }
+    bool is_exact () const { return lambda >= g; }
+    double error_bound () const;
+    void set_point_counting (bool flag);
+    bool get_point_counting () const { return point_counting; }
+    void set_threads (long n) { threads = (n > 0) ? n : 1; }
+
+    // point counting over F_q^nu
+    void character_sum (ZZ & t, long nu) const;
+    void count_points (ZZ & N, long nu) const;
+
+    // power sums and coefficients (nu, i <= lambda)
+    void power_sum (ZZ & x, long nu);
+    void coefficient (ZZ & x, long i);
+
+    // L-polynomial and L(1) (exact, lambda >= g)
+    bool polynomial (std::vector<ZZ> & L);
+    bool jacobian_order (ZZ & N);
+
+    // approximation of L(1)
+    void estimate (RR & E);
+    void bounds (ZZ & lower, ZZ & upper);
+  };
+
+  template <> void QuadraticLpolynomial<GF2EX>::element (GF2EX & x, const ZZ & X) const;
+  template <> long QuadraticLpolynomial<GF2EX>::character (const GF2EX & P) const;
+  template <> long QuadraticLpolynomial<GF2EX>::character (const GF2EX & x, const GF2EX & P) const;
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../../src/Quadratic/Lfunction/QuadraticLpolynomial_impl.hpp"
+
+#endif // guard
@@ -0,0 +1,72 @@
+/**
+ * @file MultiplyExplicit.hpp
+ * @brief Concrete class extending MultiplyStrategy.
+ *  Computes a reduced ideal equivalent to the product of two ideals with
+ *  explicit formulas (genus 2 and 3 imaginary function fields over zz_p),
+ *  falling back to NUCOMP in all other cases.
+ */
+
+#ifndef MULTIPLY_EXPLICIT_H
+#define MULTIPLY_EXPLICIT_H
+
+#include <ANTL/Quadratic/Multiply/MultiplyStrategy.hpp>
+#include <ANTL/Quadratic/Multiply/MultiplyNucomp.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/ExplicitFormulas.hpp>
+
+NTL_CLIENT
+using namespace ANTL;
+
+namespace ANTL {
+
+  template <class T> class MultiplyStrategy;
+  template <class T> class QuadraticIdealBase;
+
+
+  template < class T > class MultiplyExplicit : public MultiplyStrategy<T> {
+
+    using MultiplyStrategy<T>::Delta;
+    using MultiplyStrategy<T>::hx;
+    using MultiplyStrategy<T>::genus;
+    using MultiplyStrategy<T>::is_init;
+
+    protected:
+      MultiplyNucomp<T> nucomp;   // used if the explicit formulas do not apply
+      long fallbacks;             // number of products computed with nucomp
+
+    public:
+      MultiplyExplicit() { fallbacks = 0; };
+      ~MultiplyExplicit() { };
+
+    void init(const T & delta_in, const T & h_in, long g_in=0) {
+      MultiplyStrategy<T>::init(delta_in,h_in,g_in);
+      nucomp.init(delta_in,h_in,g_in);
+    };
+
+    long get_fallbacks() const { return fallbacks; };
+    void reset_fallbacks() { fallbacks = 0; };
+
+//     multiply();
+//     Task:
+//          computes a reduced ideal equivalent to the product of two ideals.
+//          For zz_pX with genus 2 or 3 (h = 0), reduced ideals in general
+//          position are multiplied with explicit formulas (see
+//          ExplicitFormulas.hpp); equal ideals are squared.  All other
+//          inputs, and all other base types, use NUCOMP.
+
+     void multiply(QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> & A, const QuadraticIdealBase<T> & B);
+  };
+
+
+//
+// Declare specialized methods
+//
+
+template <> void MultiplyExplicit<zz_pX>::multiply(QuadraticIdealBase<zz_pX> & C, const QuadraticIdealBase<zz_pX> & A, const QuadraticIdealBase<zz_pX> & B);
+
+}//ANTL
+
+// Unspecialized template definitions.
+#include "../src/Quadratic/Multiply/MultiplyExplicit_impl.hpp"
+
+#endif // guard
@@ -31,6 +31,9 @@ namespace ANTL {
     protected:
       ZZ NC_BOUND;    // termination bound for NUCOMP = floor(|D|^1/4)
 
+      // NUCOMP for characteristic 2 (b^2 + bh + ac = f)
+      void multiply_char2(QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> & A, const QuadraticIdealBase<T> & B);
+
     public:
       ~MultiplyNucomp() { };
 
@@ -59,6 +62,7 @@ template <> void MultiplyNucomp<ZZ>::multiply(QuadraticIdealBase<ZZ> & C, const
 template <> void MultiplyNucomp<long>::multiply(QuadraticIdealBase<long> & C, const QuadraticIdealBase<long> & A, const QuadraticIdealBase<long> & B);
 
 template <> void MultiplyNucomp<GF2EX>::multiply(QuadraticIdealBase<GF2EX> & C, const QuadraticIdealBase<GF2EX> & A, const QuadraticIdealBase<GF2EX> & B);
+template <> void MultiplyNucomp<GF2nX>::multiply(QuadraticIdealBase<GF2nX> & C, const QuadraticIdealBase<GF2nX> & A, const QuadraticIdealBase<GF2nX> & B);
 
 }//ANTL
 
@@ -0,0 +1,88 @@
+/**
+ * @file PrimeIdealBatch.hpp
+ * @brief batched generation of prime ideals (prime forms) of quadratic orders
+ */
+
+#ifndef ANTL_PRIME_IDEAL_BATCH_H
+#define ANTL_PRIME_IDEAL_BATCH_H
+
+#include <vector>
+
+#include <ANTL/common.hpp>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/Lfunction/PrimeTable.hpp>
+
+using namespace ANTL;
+
+namespace ANTL
+{
+  template < class T > class QuadraticOrder;
+  template < class T > class QuadraticIdealBase;
+
+  /**
+   * @brief Prime ideals over many word-size primes at once.
+   * @remarks For each prime p for which QuadraticIdealBase<T>::assign_prime
+   * succeeds, the prime form (p, b, (b^2 - Delta)/4p) is emitted as the pair
+   * (p, b) into a contiguous array, ready to be used as a factor base or as
+   * a set of random generators.  The primes are processed in blocks:
+   *    - Delta mod p is computed for the whole block (rem_block); a
+   *      remainder tree does not pay off for word-size primes unless Delta
+   *      has several thousand bits,
+   *    - the Kronecker symbols come from the block version of Jacobi_base(),
+   *    - the square roots of Delta mod p are computed in word arithmetic
+   *      (ressol_long).
+   * As in assign_prime, b = Delta (mod 2), ramified primes give b = 0 or p,
+   * and primes with p^2 | Delta are skipped.  The primes must be smaller
+   * than 2^31.
+   *
+   * Currently, the template parameter T has been instantiated for:
+   *    long --- order in quadratic number field (word sized D)
+   *    ZZ --- order in a quadratic number field (arbitrary sized D)
+   */
+  template < class T > class PrimeIdealBatch
+  {
+  public:
+    struct PrimeForm {
+      long p;
+      long b;
+    };
+
+  protected:
+    QuadraticOrder<T> *QO;
+    T Delta;
+    long D16;     // Delta mod 16
+    long block;   // number of primes per block
+
+    std::vector<PrimeForm> forms;
+
+    void process (const long *P, long len);
+
+  public:
+    PrimeIdealBatch (QuadraticOrder<T> & inQO, long inblock = 256);
+    ~PrimeIdealBatch ();
+
+    void set_block_size (long inblock) { block = (inblock > 0) ? inblock : 1; }
+    long get_block_size () const { return block; }
+
+    // generation (the prime forms are appended)
+    long generate (long bound, long count = 0);
+    long generate (const std::vector<long> & P);
+    void clear () { forms.clear(); }
+
+    // access
+    long size () const { return forms.size(); }
+    const PrimeForm & operator [] (long i) const { return forms[i]; }
+    const PrimeForm * data () const { return forms.data(); }
+    const std::vector<PrimeForm> & get_forms () const { return forms; }
+
+    void assign (QuadraticIdealBase<T> & A, long i) const;
+    void assign (std::vector< QuadraticIdealBase<T> > & A) const;
+  };
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../src/Quadratic/PrimeIdealBatch_impl.hpp"
+
+#endif // guard
@@ -10,6 +10,9 @@
 #include <ANTL/common.hpp>
 #include <ANTL/Quadratic/QuadraticOrder.hpp>
 #include <ANTL/Quadratic/QuadraticNumber.hpp>
+#include <ANTL/Exponentiation/InversionFree.hpp>
+#include <ANTL/Exponentiation/ElementHash.hpp>
+#include <ANTL/Exponentiation/ElementGroup.hpp>
 
 using namespace ANTL;
 
@@ -22,6 +25,8 @@ namespace ANTL {
   // declare templated friend functions
   template <class T> void conjugate (QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> &A);
 
+  template <class T> void inv (QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> &A);
+
   template <class T> void mul (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A, const QuadraticIdealBase<T> &B);
 
   template <class T> void mul (QuadraticIdealBase<T> &C, ANTL::QuadraticNumber<T> & gamma, const QuadraticIdealBase<T> &A, const QuadraticIdealBase<T> &B);
@@ -131,6 +136,64 @@ namespace ANTL {
   template <> bool QuadraticIdealBase<GF2EX>::assign_prime (const GF2EX & p);
   template <> void conjugate (QuadraticIdealBase<GF2EX> &C, const QuadraticIdealBase<GF2EX> &A);
 
+  template <> bool QuadraticIdealBase<GF2nX>::assign_prime (const GF2nX & p);
+  template <> void conjugate (QuadraticIdealBase<GF2nX> &C, const QuadraticIdealBase<GF2nX> &A);
+
+  // inversion is conjugation, so exponentiation does not store inverses
+  template <class T> struct is_inversion_free< QuadraticIdealBase<T> >
+  {
+    static const bool value = true;
+  };
+
+  // reduced ideals are hashed on (a, b) in baby-step giant-step tables
+  template <> struct element_hash< QuadraticIdealBase<ZZ> >
+  {
+    std::size_t operator() (const QuadraticIdealBase<ZZ> &A) const
+    {
+      return (std::size_t) trunc_long(A.get_a(), NTL_BITS_PER_LONG)
+           ^ ((std::size_t) trunc_long(A.get_b(), NTL_BITS_PER_LONG) << 1);
+    }
+  };
+
+  template <> struct element_hash< QuadraticIdealBase<long> >
+  {
+    std::size_t operator() (const QuadraticIdealBase<long> &A) const
+    {
+      return (std::size_t) A.get_a() ^ ((std::size_t) A.get_b() << 1);
+    }
+  };
+
+  // group operations on reduced ideals with the order's best multiplication,
+  // squaring and reduction (which must be set), so that products can be
+  // compared and hashed
+  template <class T> struct element_group< QuadraticIdealBase<T> >
+  {
+    static void identity (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A)
+    {
+      C.set_QO(A.get_QO());
+      C.assign_one();
+    }
+
+    static void multiply (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A, const QuadraticIdealBase<T> &B)
+    {
+      A.get_QO()->get_mul_best()->multiply(C, A, B);
+      C.reduce();
+    }
+
+    static void square (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A)
+    {
+      A.get_QO()->get_sqr_best()->square(C, A);
+      C.reduce();
+    }
+
+    static void reduce (QuadraticIdealBase<T> &C) { C.reduce(); }
+
+    static bool equal (const QuadraticIdealBase<T> &A, const QuadraticIdealBase<T> &B)
+    {
+      return A.IsEqual(B);
+    }
+  };
+
 } // ANTL
 
 // Unspecialized template definitions.
@@ -0,0 +1,187 @@
+/**
+ * @file QuadraticIdealHybrid.hpp
+ * @brief quadratic ideals with word sized coefficients, promoted to ZZ on overflow
+ */
+
+#ifndef ANTL_QUADRATIC_IDEAL_HYBRID_H
+#define ANTL_QUADRATIC_IDEAL_HYBRID_H
+
+#include <iostream>
+
+#include <NTL/ZZ.h>
+
+#include <ANTL/common.hpp>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+
+using namespace ANTL;
+
+namespace ANTL
+{
+  class QuadraticIdealHybrid;
+
+  /**
+   * @brief Operation counters of the hybrid ideal arithmetic.
+   * @remarks For each operation (multiplication, squaring, reduction):
+   *    word     --- done in word arithmetic,
+   *    promoted --- word arithmetic overflowed, redone with ZZ,
+   *    ZZ       --- done with ZZ (an input was not word sized).
+   * demotions counts the ZZ results that fit into words again.
+   */
+  struct HybridCounters
+  {
+    long mul_word, mul_promoted, mul_ZZ;
+    long sqr_word, sqr_promoted, sqr_ZZ;
+    long red_word, red_promoted, red_ZZ;
+    long demotions;
+
+    HybridCounters () { clear(); }
+
+    void clear ();
+    long word_ops () const { return mul_word + sqr_word + red_word; }
+    long promotions () const { return mul_promoted + sqr_promoted + red_promoted; }
+    long ZZ_ops () const { return mul_ZZ + sqr_ZZ + red_ZZ; }
+  };
+
+  std::ostream & operator << (std::ostream & out, const HybridCounters & N);
+
+
+  /**
+   * @brief A quadratic order (arbitrary sized Delta) together with the data
+   *        needed for the word sized arithmetic of QuadraticIdealHybrid.
+   * @remarks The word kernels are NUCOMP, NUDUPL (as in MultiplyNucomp<long>
+   * and SquareNudupl<long>) and plain reduction (as in ReducePlainImag and
+   * ReducePlainReal), with every product, sum and difference checked with
+   * __builtin_mul_overflow and friends.  A kernel reports an overflow
+   * instead of returning a result, and the operation is then redone with
+   * MultiplyNucomp<ZZ> and SquareNudupl<ZZ> (owned by this object) and the
+   * reduction strategy of the order (set_red_best), which has to be set.
+   *
+   * Word kernels are only used if |Delta| < 2^(NTL_BITS_PER_LONG - 2);
+   * word sized coefficients are also bounded by 2^(NTL_BITS_PER_LONG - 2),
+   * so negations and doublings of inputs cannot overflow.
+   *
+   * The counters are not synchronized; use one object per thread.
+   */
+  class QuadraticHybridOrder
+  {
+    friend class QuadraticIdealHybrid;
+    friend void mul (QuadraticIdealHybrid &C, const QuadraticIdealHybrid &A, const QuadraticIdealHybrid &B);
+    friend void sqr (QuadraticIdealHybrid &C, const QuadraticIdealHybrid &A);
+
+  protected:
+    QuadraticOrder<ZZ> *QO;
+
+    bool word;          // true if word kernels can be used
+    bool imaginary;
+    long Delta;
+    long NC_BOUND;      // floor(|Delta|^(1/4))
+    long rootD;         // floor(sqrt(Delta)) (real orders)
+
+    MultiplyNucomp<ZZ> mul_nucomp;
+    SquareNudupl<ZZ> sqr_nudupl;
+
+    HybridCounters counters;
+
+    // word kernels, false on overflow
+    bool nucomp (long & Ca, long & Cb, long & Cc, long a1, long b1, long c1, long a2, long b2, long c2) const;
+    bool nudupl (long & a, long & b, long & c) const;
+    bool reduce (long & a, long & b, long & c) const;
+    bool reduce_imag (long & a, long & b, long & c) const;
+    bool reduce_real (long & a, long & b, long & c) const;
+    bool normalize_real (long & a, long & b, long & c) const;
+    bool is_normal_real (long a, long b) const;
+    bool is_reduced_real (long a, long b) const;
+
+    static void xgcd_partial (long & R2, long & R1, long & C2, long & C1, long bound);
+
+  public:
+    static const long WORD_BOUND = 1L << (NTL_BITS_PER_LONG - 2);
+
+    QuadraticHybridOrder (QuadraticOrder<ZZ> & inQO);
+    ~QuadraticHybridOrder ();
+
+    QuadraticOrder<ZZ> * get_QO () const { return QO; }
+    bool is_word () const { return word; }
+
+    const HybridCounters & get_counters () const { return counters; }
+    void reset_counters () { counters.clear(); }
+
+    static bool fits (const ZZ & x) { return NumBits(x) < NTL_BITS_PER_LONG - 1; }
+    static bool fits (long x) { return x > -WORD_BOUND && x < WORD_BOUND; }
+  };
+
+
+  /**
+   * @brief Primitive ideal of a quadratic order, stored with word sized
+   *        coefficients whenever they fit, and as QuadraticIdealBase<ZZ>
+   *        otherwise.
+   * @remarks mul() and sqr() compute reduced products and squares.  If
+   * both inputs are word sized, the word kernels of the order are tried
+   * first; only if they overflow, the operation is promoted to ZZ.  After a
+   * ZZ operation, the result is moved back to words if it fits (so a single
+   * overflow does not make all later operations slow).  The counters of the
+   * order show how often this happens.
+   *
+   * For imaginary orders, the results agree with MultiplyNucomp<ZZ> and
+   * SquareNudupl<ZZ> followed by ReducePlainImag<ZZ>.  For real orders, they
+   * are reduced ideals in the same class (computed as with ReducePlainReal).
+   */
+  class QuadraticIdealHybrid
+  {
+  protected:
+    QuadraticHybridOrder *HO;
+
+    bool word;
+    long a, b, c;                // if word
+    QuadraticIdealBase<ZZ> I;    // otherwise
+
+    void assign_word (long na, long nb, long nc);
+    bool demote ();
+
+  public:
+    QuadraticIdealHybrid (QuadraticHybridOrder & inHO);
+    ~QuadraticIdealHybrid ();
+
+    // assignment
+    void assign_one ();
+    bool assign_prime (const ZZ & p);
+    void assign (const QuadraticIdealHybrid & B);
+    void assign (const QuadraticIdealBase<ZZ> & B);
+    void assign (const ZZ & na, const ZZ & nb, const ZZ & nc);
+
+    QuadraticIdealHybrid & operator = (const QuadraticIdealHybrid & B);
+
+    // getters
+    void get (QuadraticIdealBase<ZZ> & B) const;
+    ZZ get_a () const;
+    ZZ get_b () const;
+    ZZ get_c () const;
+    bool is_word () const { return word; }
+    QuadraticHybridOrder * get_HO () const { return HO; }
+
+    // arithmetic
+    void reduce ();
+    friend void mul (QuadraticIdealHybrid &C, const QuadraticIdealHybrid &A, const QuadraticIdealHybrid &B);
+    friend void sqr (QuadraticIdealHybrid &C, const QuadraticIdealHybrid &A);
+
+    // comparisons
+    bool IsOne () const;
+    bool IsEqual (const QuadraticIdealHybrid & B) const;
+
+    friend bool operator == (const QuadraticIdealHybrid &A, const QuadraticIdealHybrid &B);
+    friend bool operator != (const QuadraticIdealHybrid &A, const QuadraticIdealHybrid &B);
+
+    // output
+    friend std::ostream & operator << (std::ostream & out, const QuadraticIdealHybrid &A);
+  };
+
+  void mul (QuadraticIdealHybrid &C, const QuadraticIdealHybrid &A, const QuadraticIdealHybrid &B);
+  void sqr (QuadraticIdealHybrid &C, const QuadraticIdealHybrid &A);
+  bool operator == (const QuadraticIdealHybrid &A, const QuadraticIdealHybrid &B);
+  bool operator != (const QuadraticIdealHybrid &A, const QuadraticIdealHybrid &B);
+  std::ostream & operator << (std::ostream & out, const QuadraticIdealHybrid &A);
+
+} // ANTL
+
+#endif // guard
@@ -1,21 +1,26 @@
 /**
- * @file FPRepresentation.hpp
+ * @file QuadraticInfrastructureElement_fp.hpp
  * @author Reginald Lybbert
- * @brief reduced w-near (f,p) representations of ideals in real quadratic fields
+ * @brief reduced (f,p) representations of ideals in real quadratic fields
  */
 
 #ifndef ANTL_FP_REPRESENTATION_H
 #define ANTL_FP_REPRESENTATION_H
 
+#include <NTL/ZZ.h>
+#include <NTL/RR.h>
+
 #include <ANTL/common.hpp>
-#include <ANTL/Arithmetic/QQ.hpp>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
 #include <ANTL/Quadratic/QuadraticIdealBase.hpp>
 
+using namespace ANTL;
+
 namespace ANTL
 {
+  template < class T > class FPRepresentation;
   template < class T > class QuadraticIdealBase;
   template < class T > class QuadraticOrder;
-  template < class T > class QuadraticNumber;
 
 
   // declare templated friend functions
@@ -29,7 +34,7 @@ namespace ANTL
   void sqr (FPRepresentation<T> &C, const FPRepresentation<T> &A);
 
   template < class T >
-  void cube (FPRepresentation<T> &C, const FPRepresentation<T> &A);
+  void sqr (FPRepresentation<T> &C, ZZ & x, ZZ & y, ZZ & z, const FPRepresentation<T> &A);
 
   template < class T >
   bool operator == (const FPRepresentation<T> &A, const FPRepresentation<T> &B);
@@ -38,109 +43,133 @@ namespace ANTL
   bool operator != (const FPRepresentation<T> &A, const FPRepresentation<T> &B);
 
   template < class T >
-  std::istream & operator >> (std::istream & in, FPRepresentation<T> &A);
+  std::ostream & operator << (std::ostream & out, const FPRepresentation<T> &A);
 
   template < class T >
-  std::ostream & operator << (std::ostream & out, const FPRepresentation<T> &A);
+  void regulator_fp (RR & R, QuadraticOrder<T> & QO, long prec);
+
+
+  /**
+   * @brief (f,p) representation of an element of the infrastructure of a
+   *        real quadratic order.
+   * @remarks An instance stores a reduced ideal b = [a, (b + sqrt(Delta))/2]
+   * together with a p-bit fixed-point approximation
+   *    theta ~ d 2^(k-p),   2^p <= d < 2^(p+1)
+   * of the relative generator of b with respect to a starting ideal
+   * (normally the order itself), so that the distance of b is
+   * log(theta) = log(d) + (k-p) log(2).
+   *
+   * All arithmetic (baby steps, composition, reduction, inversion) is done
+   * with integers only; every operation introduces a relative error of at
+   * most 2^(-p) in theta, so a computation involving m operations loses
+   * about log2(m) bits of the distance.  RR is only used when a distance
+   * is finally converted by distance().
+   *
+   * Composition is done without intermediate reduction (as in the
+   * composition step of NUCOMP/NUDUPL) and the result is reduced with
+   * baby steps whose relative generators are accumulated in fixed point.
+   *
+   * Currently, the template parameter T has been instantiated for:
+   *    long --- order in quadratic number field (word sized D)
+   *    ZZ --- order in a quadratic number field (arbitrary sized D)
+   * Internally all coefficients are held as ZZ.
+   */
+  template < class T > class FPRepresentation
+  {
+  protected:
+    QuadraticOrder<T> *QO;
 
+    // reduced ideal
+    ZZ a;
+    ZZ b;
+    ZZ c;
 
-//Still need to write WNEAR, prove inversion, rewrite everything to match formats....
-template < class T > class fpRepresentation
-{
-  protected:
-    QuadraticIdealBase b;
-    ZZ d; 
+    // relative generator theta ~ d 2^(k-p)
+    ZZ d;
     long k;
-    long w;
     long p;
-    
-    void remove(ZZ bigT,T C,long s){
-       ZZ m = round(abs((bigT<<(p+3-s))/C));
-       long t = floor(m/8d) + 1;
-       d = ceil((1<<(p+3+t))*d/m);
-       k = k - t;
-    };
-
-    void wnear();
-
-public:
-
-   //Still need to prove this works:
-   friend void inv(FPRepresentation<T> & C, const FPRepresentation<T> &A){
-      C.w = A.w;
-      C.p = A.p;
-      inv(C.b,A.b);
-      C.d = floor(1<<(2*A.p + 1)/d);
-      C.k = -A.k - 1;
-   }
-   friend void mul(FPRepresentation<T> & C, const FPRepresentation<T> & A, const FPRepresentation<T> &B){
-       assert(A.w == B.w  && A.p == B.p);
-       C.w = A.w;
-       C.p = A.p;
-       NUCOMP(C.b, A.b, B.b);
-       if(A.d*B.d <= 1<<(2*A.p + 1)){
-           C.d = (A.d*B.d)>>A.p;
-           C.k = A.k + B.k;
-       }else{
-           C.d = (A.d*B.d)>>(A.p+1);
-           C.k = A.k + B.k + 1; 
-       }
-       s = NumBits((C.b.B)/(C.b.Q))+(A.p+4);
-       T = C.b.A<<s + C.b.B*floor(sqrt(D)<<s)
-       C.remove(T,C.b.C,s);
-       C.wnear();
-   }
-
-   friend void sqr(FPRepresentation<T> &C, const FPRepresentation<T> &A){
-       C.w = A.w;
-       C.p = A.p;
-       NUDUPL(C.b, A.b);
-       if(A.d*A.d <= 1<<(2*A.p + 1)){
-           C.d = (A.d*A.d)>>A.p;
-           C.k = 2*A.k;
-       }else{
-           C.d = (A.d*A.d)>>(A.p+1);
-           C.k = 2*A.k + 1; 
-       }
-       s = NumBits((C.b.B)/(C.b.Q))+(A.p+4);
-       T = C.b.A<<s + C.b.B*floor(sqrt(D)<<s)
-       C.remove(T,C.b.C,s);
-       C.wnear();
-   };
-
-   friend void cube(FPRepresentation<T> &C, const FPRepresentation<T> &A){
-       C.w = A.w;
-       C.p = A.p;
-       NUCUBE(C.b, A.b);
-       if(A.d*A.d*A.d <= 1<<(3*A.p + 1)){
-           C.d = (A.d*A.d*A.d)>>(2*A.p);
-           C.k = 3*A.k;
-       }else if(A.d*A.d*A.d <= 1<<(3*A.p + 2)){
-           C.d = (A.d*A.d*A.d)>>(2*A.p+1);
-           C.k = 3*A.k + 1; 
-       }else{
-           C.d = (A.d*A.d*A.d)>>(2*A.p+2);
-           C.k = 3*A.k + 2; 
-       }
-       s = NumBits((C.b.B)/(C.b.Q))+(A.p+4);
-       T = C.b.A<<s + C.b.B*floor(sqrt(D)<<s)
-       C.remove(T,C.b.C,s);
-       C.wnear();
-   };
-
-   friend bool operator == (const FPRepresentation<T> &A, const FPRepresentation<T> &B){
-      return (A.b == B.b && A.d == B.d && A.k == B.k && A.w == B.w && A.p == B.p);
-   }
-
-  friend bool operator != (const FPRepresentation<T> &A, const FPRepresentation<T> &B){
-      return !(A.b == B.b && A.d == B.d && A.k == B.k && A.w == B.w && A.p == B.p);
-   }
-   
-  friend std::istream & operator >> < T > (std::istream & in,
-					   QuadraticIdealBase<T> &A);
-
-  friend std::ostream & operator << < T > (std::ostream & out,
-					   const QuadraticIdealBase<T> &A);
-};
-
 
+    // per-order constants: Delta, floor(sqrt(Delta)), floor(sqrt(Delta) 2^s)
+    ZZ Delta;
+    ZZ rootD;
+    ZZ rootD_s;
+    long s;
+
+    void init_constants ();
+    void scale (const ZZ & num, const ZZ & den, long e);
+    void compose (const FPRepresentation<T> &A, const FPRepresentation<T> &B, ZZ & S);
+    void mul_relative (ZZ & x, ZZ & y, ZZ & z, const ZZ & u, const ZZ & v, const ZZ & w) const;
+
+  public:
+    FPRepresentation (QuadraticOrder<T> & inQO, long prec);
+    FPRepresentation (const FPRepresentation<T> & A);
+    ~FPRepresentation ();
+
+    FPRepresentation<T> & operator = (const FPRepresentation<T> &A);
+
+    // assignment
+    void assign_order (QuadraticOrder<T> & inQO, long prec);
+    void assign_one ();
+    void assign (const QuadraticIdealBase<T> &A);
+    void assign (const FPRepresentation<T> &A);
+    void assign (const ZZ & na, const ZZ & nb);
+    void set_distance (const ZZ & nd, long nk);
+    void clear_distance ();
+
+    // distance arithmetic (theta is multiplied/divided)
+    void add_distance (const ZZ & nd, long nk);
+    void sub_distance (const ZZ & nd, long nk);
+    void add_log (const ZZ & x);
+
+    // access
+    const ZZ & get_a () const { return a; }
+    const ZZ & get_b () const { return b; }
+    const ZZ & get_c () const { return c; }
+    const ZZ & get_d () const { return d; }
+    long get_k () const { return k; }
+    long get_precision () const { return p; }
+    QuadraticOrder<T> * get_QO () const { return QO; }
+
+    void get_ideal (QuadraticIdealBase<T> &A) const;
+    RR distance () const;
+
+    // infrastructure
+    void normalize ();
+    bool is_reduced () const;
+    void reduce ();
+
+    void rho ();
+    void rho_inverse ();
+
+    // with exact relative generator (x + y sqrt(Delta))/z
+    void reduce (ZZ & x, ZZ & y, ZZ & z);
+    void rho (ZZ & x, ZZ & y, ZZ & z);
+    void rho_inverse (ZZ & x, ZZ & y, ZZ & z);
+    void wnear (const ZZ & td, long tk);
+    void wnear (long w);
+
+    long compare_distance (const FPRepresentation<T> &B) const;
+    long compare_distance (const ZZ & td, long tk) const;
+
+    // comparisons
+    bool IsOne () const;
+    bool IsEqual (const FPRepresentation<T> &B) const;
+
+    // arithmetic
+    friend void inv < T > (FPRepresentation<T> & C, const FPRepresentation<T> &A);
+    friend void mul < T > (FPRepresentation<T> &C, const FPRepresentation<T> &A, const FPRepresentation<T> &B);
+    friend void sqr < T > (FPRepresentation<T> &C, const FPRepresentation<T> &A);
+    friend void sqr < T > (FPRepresentation<T> &C, ZZ & x, ZZ & y, ZZ & z, const FPRepresentation<T> &A);
+
+    friend bool operator == < T > (const FPRepresentation<T> &A, const FPRepresentation<T> &B);
+    friend bool operator != < T > (const FPRepresentation<T> &A, const FPRepresentation<T> &B);
+
+    friend std::ostream & operator << < T > (std::ostream & out, const FPRepresentation<T> &A);
+  };
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../src/Quadratic/QuadraticInfrastructureElement_fp_impl.hpp"
+
+#endif // guard
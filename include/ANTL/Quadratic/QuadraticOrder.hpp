@@ -130,6 +130,8 @@ using namespace ANTL;
    *       zz_pX --- hyperelliptic function field over Fp (char <> 2, p < 2^64)
    *       zz_pEX --- hyperelliptic function field over Fq (char <> 2, p < 2^64)
    *       GF2EX --- hyperelliptic function field (char = 2)
+   *    ANTL:
+   *       GF2nX --- hyperelliptic function field over GF(2^n), n <= 64, small genus
    */
 
 template < class T > class QuadraticOrder : public IOrder<T,NTL::RR> {
@@ -573,14 +575,21 @@ class QuadraticOrder<long> : public QuadraticOrder<long, long, double, double> {
   //  template <> QuadraticOrder<GF2EX> & randomUnusualOrder<GF2EX> (long size, bool prime);
   //  template <> QuadraticOrder<GF2EX> & randomRealOrder<GF2EX> (long size, bool prime);
 
+  template <>      QuadraticOrder<GF2nX>::QuadraticOrder (const GF2nX & newf, const GF2nX & newh);
+  template <> bool QuadraticOrder<GF2nX>::IsImaginary () const;
+  template <> bool QuadraticOrder<GF2nX>::IsReal () const;
+  template <> bool QuadraticOrder<GF2nX>::IsUnusual () const;
+
   template <> bool QuadraticOrder<ZZ>::IsImaginary () const;
   template <> bool QuadraticOrder<ZZ>::IsReal () const;
+  template <> NTL::RR QuadraticOrder<ZZ>::regulator ();
   //  template <> QuadraticOrder<ZZ> & randomImaginaryOrder<ZZ> (long size, bool prime);
   //  template <> QuadraticOrder<ZZ> & randomUnusualOrder<ZZ> (long size, bool prime);
   //  template <> QuadraticOrder<ZZ> & randomRealOrder<ZZ> (long size, bool prime);
 
   template <> bool QuadraticOrder<long>::IsImaginary () const;
   template <> bool QuadraticOrder<long>::IsReal () const;
+  template <> NTL::RR QuadraticOrder<long>::regulator ();
   //  template <> QuadraticOrder<long> & randomImaginaryOrder<long> (long size, bool prime);
   //  template <> QuadraticOrder<long> & randomUnusualOrder<long> (long size, bool prime);
   //  template <> QuadraticOrder<long> & randomRealOrder<long> (long size, bool prime);
@@ -0,0 +1,130 @@
+/**
+ * @file ClassGroupRank.hpp
+ * @brief p-ranks of class groups of quadratic orders for small p
+ */
+
+#ifndef ANTL_CLASS_GROUP_RANK_H
+#define ANTL_CLASS_GROUP_RANK_H
+
+#include <vector>
+#include <unordered_map>
+
+#include <NTL/ZZ.h>
+
+#include <ANTL/common.hpp>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/Lfunction/PrimeTable.hpp>
+
+using namespace ANTL;
+
+namespace ANTL
+{
+  template < class T > class QuadraticOrder;
+  template < class T > class QuadraticIdealBase;
+
+  /**
+   * @brief Computes the 2-rank and the 3-rank of the class group of a
+   *        quadratic order without computing the class group.
+   * @remarks The 2-rank is given by genus theory.  If mu is the number of
+   * generic characters of Delta (one for each odd prime dividing Delta, plus
+   * delta = (-1/.), epsilon = (2/.) or delta epsilon, depending on
+   * Delta/4 mod 8), the narrow class group has 2-rank mu - 1.  For real
+   * orders, the class group has 2-rank mu - 1 if all generic characters are
+   * 1 on -1, and mu - 2 otherwise.  Only the odd part of Delta has to be
+   * factored (trial division with PrimeTable, then Pollard-Brent rho).
+   *
+   * The 3-rank is estimated for imaginary orders.  Each sample is a prime
+   * ideal p raised to
+   *    M = prod p^e,  p <= B, p != 3,  p^e < h_max,
+   * where h_max bounds h, so p^M lies in the 3-Sylow subgroup whenever the
+   * part of h prime to 3 is B-smooth (otherwise p^M is discarded, detected by
+   * cubing).  The samples g_1, ..., g_n generate a subgroup H of the 3-Sylow
+   * subgroup, which is enumerated together with the exponent vectors of its
+   * elements.  For each g_k, the smallest 3^j with g_k^(3^j) in
+   * <g_1, ..., g_(k-1)> gives the relation
+   *    g_k^(3^j) = prod_{i<k} g_i^(e_i),
+   * and these relations generate the relation lattice of H.  Since
+   * H/H^3 = F_3^n / (relations mod 3), the 3-rank of H is n minus the rank
+   * of the relation matrix over F_3 (Gaussian elimination).  The result is
+   * a lower bound, which is exact as soon as the samples generate the
+   * 3-Sylow subgroup.
+   *
+   * The reduction strategy of the order (set_red_best) is used for all
+   * reductions.  Composition, squaring and cubing use NUCOMP, NUDUPL and
+   * NUCUBE.
+   *
+   * p_rank() uses these methods for p = 2 and p = 3, and falls back to the
+   * class group of the order otherwise.
+   *
+   * Currently, the template parameter T has been instantiated for:
+   *    long --- order in quadratic number field (word sized D)
+   *    ZZ --- order in a quadratic number field (arbitrary sized D)
+   */
+  template < class T > class ClassGroupRank
+  {
+  protected:
+    struct ElementHash {
+      std::size_t operator() (const ZZ & a) const
+      {
+        return (std::size_t) trunc_long(a, NTL_BITS_PER_LONG);
+      }
+    };
+
+    QuadraticOrder<T> *QO;
+    ZZ Delta;
+
+    // genus theory
+    bool factored;
+    std::vector<ZZ> primes;   // odd primes dividing Delta
+    long num_chars;           // number of generic characters
+    bool all_plus;            // true if all generic characters are 1 on -1
+
+    // 3-rank
+    long samples;             // number of prime ideals used
+    long smooth;              // smoothness bound B (0 = automatic)
+    long max_size;            // maximal size of the enumerated subgroup
+    long discarded;
+
+    MultiplyNucomp<T> mul_nucomp;
+    SquareNudupl<T> sqr_nudupl;
+    CubeNucube<T> cube_nucube;
+
+    std::vector< QuadraticIdealBase<T> > H;
+    std::vector< std::vector<long> > coords;   // exponent vectors of H
+    std::unordered_multimap<ZZ, long, ElementHash> table;
+
+    void genus ();
+    long lookup (const QuadraticIdealBase<T> &A) const;
+    void insert (const QuadraticIdealBase<T> &A, const std::vector<long> &e);
+    void power (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A, const ZZ & n);
+    void cube (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A);
+
+    static long rank_mod3 (std::vector< std::vector<long> > & R, long n);
+    static void factor (std::vector<ZZ> & fact, const ZZ & n);
+    static void pollard_brent (ZZ & f, const ZZ & n);
+
+  public:
+    ClassGroupRank (QuadraticOrder<T> & inQO);
+    ~ClassGroupRank ();
+
+    void set_samples (long n) { samples = n; }
+    void set_smoothness_bound (long B) { smooth = B; }
+    void set_max_size (long n) { max_size = n; }
+
+    long two_rank ();
+    long narrow_two_rank ();
+    long three_rank ();
+    long p_rank (long p);
+
+    const std::vector<ZZ> & get_prime_divisors ();
+    long get_num_discarded () const { return discarded; }
+    QuadraticOrder<T> * get_QO () const { return QO; }
+  };
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../../src/Quadratic/Rank/ClassGroupRank_impl.hpp"
+
+#endif // guard
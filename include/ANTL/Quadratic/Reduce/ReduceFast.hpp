@@ -29,6 +29,9 @@ namespace ANTL {
     protected:
       ZZ sqrt_delta;   // = floor(SquareRoot(abs(Delta)))
 
+      // fast reduction for characteristic 2 (b^2 + bh + ac = f)
+      void reduce_char2(QuadraticIdealBase<T> & A);
+
     public:
       ~ReduceFast() {};
 
@@ -51,6 +54,7 @@ template <> void ReduceFast<long>::init(const long & delta_in, const long & h_in
 template <> void ReduceFast<long>::reduce(QuadraticIdealBase<long> & A);
 
 template <> void ReduceFast<GF2EX>::reduce(QuadraticIdealBase<GF2EX> & A);
+template <> void ReduceFast<GF2nX>::reduce(QuadraticIdealBase<GF2nX> & A);
 
 } //ANTL
 // Unspecialized template definitions.
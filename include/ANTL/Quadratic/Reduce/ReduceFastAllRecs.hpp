@@ -26,6 +26,10 @@ namespace ANTL {
     using ReduceStrategy<T>::genus;
     using ReduceStrategy<T>::is_init;
 
+    protected:
+      // fast reduction for characteristic 2 (b^2 + bh + ac = f)
+      void reduce_char2(QuadraticIdealBase<T> & A);
+
     public:
       ~ReduceFastAllRecs() {};
 
@@ -38,6 +42,7 @@ namespace ANTL {
 
 // Declare specialized methods
 template <> void ReduceFastAllRecs<GF2EX>::reduce(QuadraticIdealBase<GF2EX> & A);
+template <> void ReduceFastAllRecs<GF2nX>::reduce(QuadraticIdealBase<GF2nX> & A);
 
 }//ANTL
 
@@ -27,6 +27,10 @@ namespace ANTL {
     using ReduceStrategy<T>::genus;
     using ReduceStrategy<T>::is_init;
 
+    protected:
+      // fast reduction for characteristic 2 (b^2 + bh + ac = f)
+      void reduce_char2(QuadraticIdealBase<T> & A);
+
     public:
       ~ReduceFastRecs() {};
 
@@ -39,6 +43,7 @@ namespace ANTL {
 
 // Declare specialized methods
 template <> void ReduceFastRecs<GF2EX>::reduce(QuadraticIdealBase<GF2EX> & A);
+template <> void ReduceFastRecs<GF2nX>::reduce(QuadraticIdealBase<GF2nX> & A);
 
 }//ANTL
 
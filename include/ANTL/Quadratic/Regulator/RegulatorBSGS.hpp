@@ -0,0 +1,127 @@
+/**
+ * @file RegulatorBSGS.hpp
+ * @brief baby-step giant-step regulator computation for real quadratic orders
+ */
+
+#ifndef ANTL_REGULATOR_BSGS_H
+#define ANTL_REGULATOR_BSGS_H
+
+#include <vector>
+#include <unordered_map>
+
+#include <NTL/ZZ.h>
+#include <NTL/RR.h>
+
+#include <ANTL/common.hpp>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticInfrastructureElement_fp.hpp>
+#include <ANTL/Quadratic/CompactRepresentation.hpp>
+
+using namespace ANTL;
+
+namespace ANTL
+{
+  template < class T > class QuadraticOrder;
+  template < class T > class FPRepresentation;
+  template < class T > class CompactRepresentation;
+  template < class T > class QuadraticIdealBase;
+
+  /**
+   * @brief Shanks/Buchmann-Williams baby-step giant-step algorithm for the
+   *        regulator and fundamental unit of a real quadratic order.
+   * @remarks Baby steps walk the principal cycle with rho() from the order,
+   * storing the reduced ideals in a hash table (keyed on a) together with
+   * their (f,p) distances.  The giant step is the baby-step ideal G whose
+   * distance is at least log(Delta) less than the last baby step, so the
+   * reduction offset of a product never skips over the baby-step window.
+   * Giant steps C_{j+1} = C_j G are computed with (f,p) composition and
+   * reduction.
+   *
+   * Every giant step ideal C is checked directly against the table and via
+   * its conjugate.  Since the conjugate of the baby step b_i lies at
+   * distance -d(b_i) - log(a_i) on the principal cycle,
+   *     C = b_i         gives R = d(C) - d(b_i),
+   *     conj(C) = b_i   gives R = d(C) + d(b_i) + log(a),
+   * so giant steps only have to cover half of the cycle.  With about
+   * Delta^(1/4) baby steps, the algorithm needs O(Delta^(1/4+eps)) operations.
+   *
+   * A compact representation of the fundamental unit is obtained from its
+   * (f,p) approximation with fundamental_unit(E).
+   *
+   * The baby-step table is kept after the computation and reused by
+   * principal_ideal_test(), which locates a reduced ideal equivalent to the
+   * input in the principal cycle with giant steps from that ideal.
+   *
+   * Currently, the template parameter T has been instantiated for:
+   *    long --- order in quadratic number field (word sized D)
+   *    ZZ --- order in a quadratic number field (arbitrary sized D)
+   */
+  template < class T > class RegulatorBSGS
+  {
+  protected:
+    struct BabyStep {
+      ZZ a;
+      ZZ b;
+      ZZ d;
+      long k;
+    };
+
+    struct BabyStepHash {
+      std::size_t operator() (const ZZ & a) const
+      {
+        return (std::size_t) trunc_long(a, NTL_BITS_PER_LONG);
+      }
+    };
+
+    QuadraticOrder<T> *QO;
+    long bits;       // requested absolute precision of R
+    long p;          // precision of (f,p) arithmetic
+    long num_baby;   // minimal number of baby steps (0 = automatic)
+
+    bool computed;
+    std::vector<BabyStep> baby;
+    std::unordered_multimap<ZZ, long, BabyStepHash> table;
+
+    FPRepresentation<T> last;   // last baby step
+    FPRepresentation<T> giant;  // giant step
+    FPRepresentation<T> eps;    // order at distance R (theta ~ fundamental unit)
+
+    long giant_steps;
+
+    void baby_steps ();
+    void insert (const FPRepresentation<T> &A);
+
+  public:
+    RegulatorBSGS (QuadraticOrder<T> & inQO, long inbits = 64);
+    ~RegulatorBSGS ();
+
+    void assign_order (QuadraticOrder<T> & inQO);
+    void set_precision (long inbits);
+    void set_baby_steps (long m);
+
+    void compute ();
+    bool is_computed () const { return computed; }
+
+    void regulator (RR & R);
+    const FPRepresentation<T> & fundamental_unit ();
+    void fundamental_unit (CompactRepresentation<T> & E);
+
+    // principal ideal testing
+    bool principal_ideal_test (FPRepresentation<T> & G, const QuadraticIdealBase<T> & A);
+
+    // baby-step table
+    bool find (const ZZ & a, const ZZ & b, ZZ & d, long & k) const;
+    long get_num_baby_steps () const { return baby.size(); }
+    long get_num_giant_steps () const { return giant_steps; }
+    long get_precision () const { return p; }
+    const FPRepresentation<T> & get_last_baby_step () const { return last; }
+    const FPRepresentation<T> & get_giant_step () const { return giant; }
+    QuadraticOrder<T> * get_QO () const { return QO; }
+  };
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../../src/Quadratic/Regulator/RegulatorBSGS_impl.hpp"
+
+#endif // guard
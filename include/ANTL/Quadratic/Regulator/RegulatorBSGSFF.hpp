@@ -0,0 +1,151 @@
+/**
+ * @file RegulatorBSGSFF.hpp
+ * @brief baby-step giant-step regulator and class number computation for
+ *        real hyperelliptic function fields
+ */
+
+#ifndef ANTL_REGULATOR_BSGS_FF_H
+#define ANTL_REGULATOR_BSGS_FF_H
+
+#include <vector>
+#include <unordered_map>
+
+#include <NTL/ZZ.h>
+#include <NTL/GF2EXFactoring.h>
+
+#include <ANTL/common.hpp>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/Lfunction/QuadraticLpolynomial.hpp>
+
+using namespace ANTL;
+
+namespace ANTL
+{
+  template < class T > class QuadraticOrder;
+  template < class T > class QuadraticLpolynomial;
+
+  /**
+   * @brief Baby-step giant-step algorithm for the regulator and ideal class
+   *        number of a real hyperelliptic function field y^2 + h y = f of
+   *        genus g over F_q.
+   * @remarks A reduced ideal is [a, b + y] with a monic, deg a <= g, and
+   * a | b^2 - b h - f; b is normalized with deg(b - h - d) < deg a, where d
+   * is the polynomial part of the root y in F_q((1/x)) (deg y = g+1).  Since
+   * the distances in the infrastructure are degrees, they are exact integers:
+   *    - a baby step [a, b + y] -> [c, h - b + y], c = (b^2 - b h - f)/a made
+   *      monic, advances the distance by deg(b + y) - deg a (= g + 1 - deg a
+   *      for reduced ideals),
+   *    - composition of ideals at distances d1 and d2 gives an ideal at
+   *      distance d1 + d2 - deg S (S = gcd(a1, a2, b1 + b2 - h)), and each
+   *      reduction step adds deg(b + y) - deg a, so that the reduced product
+   *      is at distance d1 + d2 - e with 0 <= e <= 2g,
+   *    - the conjugate [a, h - b + y] of the reduced ideal at distance delta
+   *      lies at distance deg a - delta (mod R).
+   * No floating point arithmetic is needed.
+   *
+   * Baby steps walk the principal cycle from the order and are stored in a
+   * hash table keyed on a.  As reduced products never advance further than
+   * the sum of the distances, the last baby step is used as the giant step G.
+   * Every giant step C_j = C_{j-1} G is checked against the table directly
+   * (C = b_i gives R = d(C) - d(b_i)) and via its conjugate (conj(C) = b_i
+   * gives R = d(C) + d(b_i) - deg a), so giant steps cover half of the cycle.
+   *
+   * The ideal class number h follows from h R = L(1), the order of the
+   * Jacobian.  L(1) is taken from the truncated Euler product of
+   * QuadraticLpolynomial: exact if its degree bound is at least g, and
+   * otherwise an interval containing L(1), which determines h if it
+   * contains only one multiple of R.  The upper bound on L(1) >= R is also
+   * used to choose the number of baby steps (about sqrt(L(1)/2)).
+   * verify() recomputes L(1) independently by point counting over F_q^i,
+   * i <= g, and checks it against R and h.
+   *
+   * Currently, the template parameter T has been instantiated for:
+   *    zz_pX --- hyperelliptic function field over Fp (char <> 2, p < 2^64)
+   *    ZZ_pX --- hyperelliptic function field over Fp (char <> 2)
+   *    GF2EX --- hyperelliptic function field (char = 2)
+   */
+  template < class T > class RegulatorBSGSFF
+  {
+  protected:
+    struct Element {
+      T a;
+      T b;
+      long d;
+    };
+
+    struct BabyStepHash {
+      std::size_t operator() (const T & a) const
+      {
+        std::size_t key = deg(a);
+        for (long i = 0; i <= deg(a); ++i)
+          key = key * 1000003 ^ key_word(coeff(a, i));
+        return key;
+      }
+    };
+
+    static unsigned long key_word (const zz_p & c) { return rep(c); }
+    static unsigned long key_word (const ZZ_p & c) { return trunc_long(rep(c), NTL_BITS_PER_LONG); }
+    static unsigned long key_word (const GF2E & c) { return IsZero(c) ? 0 : rep(c).xrep[0]; }
+
+    QuadraticOrder<T> *QO;
+    QuadraticLpolynomial<T> Lpoly;
+
+    T f;        // y^2 + h y = f
+    T h;
+    T d;        // polynomial part of y
+    T t;        // h + d  (b is normalized with respect to t)
+    long g;
+    long num_baby;   // minimal number of baby steps (0 = automatic)
+
+    bool computed;
+    bool full_cycle; // the baby steps contain the whole principal cycle
+    long R;
+    std::vector<Element> baby;
+    std::unordered_multimap<T, long, BabyStepHash> table;
+    Element giant;
+
+    long giant_steps;
+
+    // infrastructure
+    void root ();
+    void normalize (T & b, const T & a) const;
+    long degree_y (const T & a, const T & b, const T & c) const;
+    void rho (Element & A) const;
+    void reduce (Element & A) const;
+    void compose (Element & C, const Element & A, const Element & B) const;
+
+    void baby_steps ();
+    void insert (const Element & A);
+
+  public:
+    RegulatorBSGSFF (QuadraticOrder<T> & inQO);
+    ~RegulatorBSGSFF ();
+
+    void set_baby_steps (long m);
+
+    void compute ();
+    bool is_computed () const { return computed; }
+
+    long regulator ();
+    bool class_number (ZZ & hx);
+    bool verify (long threads = 1);
+
+    // principal ideal testing
+    bool principal_ideal_test (T & ra, T & rb, long & delta, const T & a, const T & b);
+
+    // baby-step table
+    bool find (const T & a, const T & b, long & delta) const;
+    long get_num_baby_steps () const { return baby.size(); }
+    long get_num_giant_steps () const { return giant_steps; }
+    QuadraticLpolynomial<T> & get_Lpolynomial () { return Lpoly; }
+    QuadraticOrder<T> * get_QO () const { return QO; }
+  };
+
+  template <> void RegulatorBSGSFF<GF2EX>::root ();
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../../src/Quadratic/Regulator/RegulatorBSGSFF_impl.hpp"
+
+#endif // guard
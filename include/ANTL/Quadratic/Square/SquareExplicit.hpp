@@ -0,0 +1,72 @@
+/**
+ * @file SquareExplicit.hpp
+ * @brief Concrete class extending SquareStrategy.
+ *  Computes a reduced ideal equivalent to the square of an ideal with
+ *  explicit formulas (genus 2 and 3 imaginary function fields over zz_p),
+ *  falling back to NUDUPL in all other cases.
+ */
+
+#ifndef SQUARE_EXPLICIT_H
+#define SQUARE_EXPLICIT_H
+
+#include <ANTL/Quadratic/Square/SquareStrategy.hpp>
+#include <ANTL/Quadratic/Square/SquareNudupl.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/ExplicitFormulas.hpp>
+
+NTL_CLIENT
+using namespace ANTL;
+
+namespace ANTL {
+
+  template <class T> class SquareStrategy;
+  template <class T> class QuadraticIdealBase;
+
+
+  template < class T > class SquareExplicit : public SquareStrategy<T> {
+
+    using SquareStrategy<T>::Delta;
+    using SquareStrategy<T>::hx;
+    using SquareStrategy<T>::genus;
+    using SquareStrategy<T>::is_init;
+
+    protected:
+      SquareNudupl<T> nudupl;   // used if the explicit formulas do not apply
+      long fallbacks;           // number of squares computed with nudupl
+
+    public:
+      SquareExplicit() { fallbacks = 0; };
+      ~SquareExplicit() { };
+
+    void init(const T & delta_in, const T & h_in, long g_in=0) {
+      SquareStrategy<T>::init(delta_in,h_in,g_in);
+      nudupl.init(delta_in,h_in,g_in);
+    };
+
+    long get_fallbacks() const { return fallbacks; };
+    void reset_fallbacks() { fallbacks = 0; };
+
+//     square();
+//     Task:
+//          computes a reduced ideal equivalent to the square of an ideal.
+//          For zz_pX with genus 2 or 3 (h = 0), reduced ideals in general
+//          position are squared with explicit formulas (see
+//          ExplicitFormulas.hpp).  All other inputs, and all other base
+//          types, use NUDUPL.
+
+     void square(QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> & A);
+  };
+
+
+//
+// Declare specialized methods
+//
+
+template <> void SquareExplicit<zz_pX>::square(QuadraticIdealBase<zz_pX> & C, const QuadraticIdealBase<zz_pX> & A);
+
+}//ANTL
+
+// Unspecialized template definitions.
+#include "../src/Quadratic/Square/SquareExplicit_impl.hpp"
+
+#endif // guard
@@ -29,6 +29,12 @@ namespace ANTL {
     protected:
       ZZ NC_BOUND;	  // termination bound for NUCOMP = floor(|D|^1/4)
 
+      // one NUDUPL step on (a, b, c), without normalization or reduction
+      void nudupl(T & a, T & b, T & c);
+
+      // NUDUPL for characteristic 2 (b^2 + bh + ac = f)
+      void square_char2(QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> & A);
+
     public:
       ~SquareNudupl() { };
 
@@ -38,16 +44,24 @@ namespace ANTL {
 
       // nudupl
       void square(QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> & A);
+
+      // k fused NUDUPL steps (A^(2^k)), reduced only at the end
+      void sqr_k(QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> & A, long k);
   };
 
 // Declare specialized methods
 template <> void SquareNudupl<ZZ>::init(const ZZ & delta_in, const ZZ & h_in, long g_in);
+template <> void SquareNudupl<ZZ>::nudupl(ZZ & a, ZZ & b, ZZ & c);
 template <> void SquareNudupl<ZZ>::square(QuadraticIdealBase<ZZ> & C, const QuadraticIdealBase<ZZ> & A);
+template <> void SquareNudupl<ZZ>::sqr_k(QuadraticIdealBase<ZZ> & C, const QuadraticIdealBase<ZZ> & A, long k);
 
 template <> void SquareNudupl<long>::init(const long & delta_in, const long & h_in, long g_in);
+template <> void SquareNudupl<long>::nudupl(long & a, long & b, long & c);
 template <> void SquareNudupl<long>::square(QuadraticIdealBase<long> & C, const QuadraticIdealBase<long> & A);
+template <> void SquareNudupl<long>::sqr_k(QuadraticIdealBase<long> & C, const QuadraticIdealBase<long> & A, long k);
 
 template <> void SquareNudupl<GF2EX>::square(QuadraticIdealBase<GF2EX> & C, const QuadraticIdealBase<GF2EX> & A);
+template <> void SquareNudupl<GF2nX>::square(QuadraticIdealBase<GF2nX> & C, const QuadraticIdealBase<GF2nX> & A);
 
 } //ANTL
 
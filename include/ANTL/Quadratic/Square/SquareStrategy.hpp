@@ -55,6 +55,17 @@ namespace ANTL {
 
     // Generic ideal squaring definition
     virtual void square(QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> & A) = 0;
+
+    // Repeated squaring:  C = reduced ideal equivalent to A^(2^k).  The
+    // generic version squares and reduces k times; strategies may keep the
+    // intermediate results partially reduced.
+    virtual void sqr_k(QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> & A, long k) {
+      C.assign(A);
+      for (long i = 0; i < k; ++i) {
+        square(C, C);
+        C.reduce();
+      }
+    };
   };
 
 } //ANTL
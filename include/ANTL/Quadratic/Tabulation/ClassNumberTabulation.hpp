@@ -0,0 +1,126 @@
+/**
+ * @file ClassNumberTabulation.hpp
+ * @brief tabulation of class numbers of real quadratic fields
+ */
+
+#ifndef ANTL_CLASS_NUMBER_TABULATION_H
+#define ANTL_CLASS_NUMBER_TABULATION_H
+
+#include <vector>
+#include <string>
+#include <iostream>
+
+#include <ANTL/common.hpp>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/Regulator/RegulatorBSGS.hpp>
+#include <ANTL/Quadratic/Lfunction/PrimeTable.hpp>
+#include <ANTL/Quadratic/Lfunction/QuadraticLfunction.hpp>
+
+namespace ANTL
+{
+  /**
+   * @brief Computes h(Delta) and R(Delta) for all fundamental discriminants
+   *        Delta in an interval [Dmin, Dmax) (Dmin > 1).
+   * @remarks The interval is processed in blocks.  For each block,
+   *    - the fundamental discriminants are found with a squarefree sieve
+   *      (Delta = 1 mod 4, or Delta = 8, 12 mod 16, and no odd p^2 | Delta),
+   *    - the approximations of log L(1,chi_Delta) (Bach's weighted Euler
+   *      product, see QuadraticLfunction) are computed for the whole block
+   *      prime by prime: for small p, chi_Delta(p) is read from a table of
+   *      Legendre symbols mod p; for large p, the block version of
+   *      Jacobi_base() is applied to the residues of all discriminants,
+   *    - R is computed with one RegulatorBSGS instance, whose (f,p)
+   *      representations and baby-step table allocations are reused from
+   *      one discriminant to the next.
+   * From h R = sqrt(Delta) L(1,chi) / 2 and the error bound for L, an
+   * interval [h_lo, h_hi] for h is obtained; h_lo = h_hi for almost all
+   * Delta if the error is small compared to 1/h.
+   *
+   * Output is a binary stream: the 8-byte magic "ANTLCNT1" and
+   * varint(start of the shard), followed by one record per discriminant,
+   *    varint(Delta - previous Delta), varint(h_lo), varint(h_hi - h_lo),
+   *    R (8 bytes, IEEE double, little endian),
+   * where varints are unsigned LEB128 and the first previous Delta is the
+   * start of the shard.  Records are read with read_header() and
+   * read_record().  The values are not verified against the class group:
+   * [h_lo, h_hi] contains h only if the error bound of the Euler product
+   * holds (it assumes the ERH and the error constants A, B), so even
+   * h_lo = h_hi is unconditional only after a class group computation.
+   *
+   * The blocks of [Dmin, Dmax) can be split into shards (one per process);
+   * shard i of n processes a contiguous range of blocks.  If a checkpoint
+   * file is given, it is updated after each block, and run() resumes from
+   * it, truncating the output to the last completed block.  The checkpoint
+   * records Dmin, Dmax, the block size, the shard and Q; run() fails if
+   * they do not match the current parameters.
+   *
+   * The class group structure is not computed.
+   */
+  class ClassNumberTabulation
+  {
+  protected:
+    long Dmin;
+    long Dmax;
+    long block;        // discriminants per block
+    long shard;        // this shard
+    long num_shards;
+    long Q;            // Euler product bound (0 = automatic)
+    double err;        // required error in log L (if Q is automatic)
+    double A;          // error constants (see QuadraticLfunction)
+    double B;
+    long bits;         // precision of R
+    std::string checkpoint;
+    long records;
+
+    // per-run tables
+    long Qrun;
+    long np;
+    std::vector<double> s_plus;     // contribution of p if chi(p) = 1
+    std::vector<double> s_minus;    // contribution of p if chi(p) = -1
+
+    // per-block buffers
+    std::vector<char> fundamental;
+    std::vector<double> logL;
+    std::vector<long> idx;
+    std::vector<long> res;
+    std::vector<long> mod;
+    std::vector<long> chi;
+    std::vector<signed char> legendre;
+
+    void init_lfunction ();
+    void sieve_fundamental (long D0, long len);
+    void sieve_lfunction (long D0, long len);
+
+    long read_checkpoint (long & D0, long & offset, long & count, long & prevD) const;
+    bool write_checkpoint (long D0, long offset, long count, long prevD) const;
+
+    static void put_varint (std::ostream & out, unsigned long x);
+    static bool get_varint (std::istream & in, unsigned long & x);
+
+  public:
+    ClassNumberTabulation (long inDmin, long inDmax);
+    ~ClassNumberTabulation ();
+
+    // parameters
+    void set_shard (long i, long n);
+    void set_block_size (long inblock);
+    void set_Q (long inQ);
+    void set_error (double inerr);
+    void set_error_constants (double inA, double inB);
+    void set_precision (long inbits);
+    void set_checkpoint (const std::string & file);
+
+    void shard_range (long & lo, long & hi) const;
+    long get_num_records () const { return records; }
+
+    // tabulation
+    bool run (const std::string & file);
+
+    // reading the output
+    static bool read_header (std::istream & in, long & D);
+    static bool read_record (std::istream & in, long & D, long & hlo, long & hhi, double & R);
+  };
+
+} // ANTL
+
+#endif // guard
@@ -0,0 +1,130 @@
+/**
+ * @file ClassGroupVDF.hpp
+ * @brief verifiable delay functions in class groups of imaginary quadratic orders
+ */
+
+#ifndef ANTL_CLASS_GROUP_VDF_H
+#define ANTL_CLASS_GROUP_VDF_H
+
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <NTL/ZZ.h>
+
+#include <ANTL/common.hpp>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+
+using namespace ANTL;
+
+namespace ANTL
+{
+  template < class T > class QuadraticOrder;
+  template < class T > class QuadraticIdealBase;
+  template < class T > class SquareStrategy;
+
+  /**
+   * @brief Verifiable delay function y = g^(2^t) in the class group of an
+   *        imaginary quadratic order, with Wesolowski and Pietrzak proofs.
+   * @remarks The squaring chain is run with SquareStrategy<T>::sqr_k() of the
+   * given squaring strategy (NUDUPL by default), in segments of s squarings
+   * (the checkpoint interval).  After each segment, the checkpoint
+   * G(j s) = g^(2^(j s)) is stored.  advance() continues the chain, so
+   * outputs and proofs for any t up to the current number of squarings can
+   * be requested while the chain is extended (e.g., from another thread);
+   * the checkpoints are copied under a mutex.
+   *
+   * Wesolowski:  with the challenge prime l = H(g, y, t) (128 bits),
+   *    pi = g^floor(2^t / l),   verified by  pi^l g^(2^t mod l) = y.
+   * Writing floor(2^t / l) = sum_j q_j 2^(j s) with 0 <= q_j < 2^s gives
+   *    pi = prod_j G(j s)^q_j,
+   * so the proof needs t squarings in total, split over the worker threads.
+   *
+   * Pietrzak:  in round i, mu_i = x_i^(2^(t_i/2)) is sent, r_i = H(x_i, y_i,
+   * mu_i, t_i) (128 bits), x_(i+1) = x_i^r_i mu_i, y_(i+1) = mu_i^r_i y_i and
+   * t_(i+1) = t_i/2, as long as t_i is even.  Since x_i is a product of
+   * G(m t_i) (m < 2^i) with known exponents, mu_i is a product of
+   * checkpoints whenever s divides t_i/2 (computed by the worker threads);
+   * otherwise it is computed from x_i by squaring (at most s squarings in
+   * total).  The verifier computes x_n^(2^t_n) for the odd part t_n of t,
+   * so t should be a power of 2 times a small number.
+   *
+   * The challenges are derived with NTL's DeriveKey() (HMAC-SHA256) from the
+   * ideals (a, b) and t.  Composition uses NUCOMP, all results are reduced
+   * with the reduction strategy of the order (set_red_best).  The ideal
+   * arithmetic is thread safe for every composition, squaring, cubing and
+   * reduction strategy (their temporaries are thread local).
+   *
+   * Currently, the template parameter T has been instantiated for:
+   *    long --- order in quadratic number field (word sized D)
+   *    ZZ --- order in a quadratic number field (arbitrary sized D)
+   */
+  template < class T > class ClassGroupVDF
+  {
+  protected:
+    QuadraticOrder<T> *QO;
+
+    SquareStrategy<T> *sqr;                // squaring strategy of the chain
+    mutable SquareNudupl<T> sqr_nudupl;    // default squaring strategy
+    mutable MultiplyNucomp<T> mul_nucomp;
+
+    long interval;                 // checkpoint interval s
+    long threads;                  // worker threads for proofs
+    long iterations;               // squarings done so far
+
+    std::deque< QuadraticIdealBase<T> > checkpoints;   // G(j s)
+    QuadraticIdealBase<T> current;                     // G(iterations)
+    mutable std::mutex lock;
+
+    void power (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A, const ZZ & n) const;
+    void multiply (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A, const QuadraticIdealBase<T> &B) const;
+    void multi_power (QuadraticIdealBase<T> &C, const std::vector< QuadraticIdealBase<T> > &A, const std::vector<ZZ> &e) const;
+    void get_checkpoints (std::vector< QuadraticIdealBase<T> > &G, long t) const;
+    bool is_element (const QuadraticIdealBase<T> &A) const;
+    bool is_equal (const QuadraticIdealBase<T> &A, const QuadraticIdealBase<T> &B) const;
+
+    static void append (std::vector<unsigned char> &buf, const ZZ & x);
+    static void append (std::vector<unsigned char> &buf, const QuadraticIdealBase<T> &A);
+    static void hash (ZZ & h, const std::vector<unsigned char> &buf);
+
+  public:
+    ClassGroupVDF (QuadraticOrder<T> & inQO, long ininterval = 65536);
+    ~ClassGroupVDF ();
+
+    void set_square_strategy (SquareStrategy<T> & A) { sqr = &A; }
+    void set_checkpoint_interval (long s);
+    void set_threads (long n) { threads = (n > 0) ? n : 1; }
+
+    long get_checkpoint_interval () const { return interval; }
+    long get_threads () const { return threads; }
+    long get_iterations () const;
+    QuadraticOrder<T> * get_QO () const { return QO; }
+
+    // evaluation
+    void start (const QuadraticIdealBase<T> &g);
+    void advance (long steps);
+    void output (QuadraticIdealBase<T> &y, long t) const;
+    void evaluate (QuadraticIdealBase<T> &y, const QuadraticIdealBase<T> &g, long t);
+
+    // Wesolowski proofs
+    void challenge_prime (ZZ & l, const QuadraticIdealBase<T> &g, const QuadraticIdealBase<T> &y, long t) const;
+    void prove_wesolowski (QuadraticIdealBase<T> &pi, long t) const;
+    bool verify_wesolowski (const QuadraticIdealBase<T> &g, const QuadraticIdealBase<T> &y,
+                            const QuadraticIdealBase<T> &pi, long t) const;
+
+    // Pietrzak proofs
+    void challenge (ZZ & r, const QuadraticIdealBase<T> &x, const QuadraticIdealBase<T> &y,
+                    const QuadraticIdealBase<T> &mu, long t) const;
+    void prove_pietrzak (std::vector< QuadraticIdealBase<T> > &proof, long t) const;
+    bool verify_pietrzak (const QuadraticIdealBase<T> &g, const QuadraticIdealBase<T> &y,
+                          const std::vector< QuadraticIdealBase<T> > &proof, long t) const;
+  };
+
+} // ANTL
+
+// Unspecialized template definitions.
+#include "../../../../src/Quadratic/VDF/ClassGroupVDF_impl.hpp"
+
+#endif // guard
@@ -30,6 +30,8 @@
 #include <ANTL/thresholds.hpp>
 #include <ANTL/XGCD/xgcd_iter.hpp>
 #include <ANTL/XGCD/hxgcd.hpp>
+#include <ANTL/XGCD/xgcd_plain.hpp>
+#include <ANTL/Arithmetic/GF2nX.hpp>
 
 
 
@@ -40,6 +42,9 @@
 template < class T >
 void XGCD(T & G, T & X, T & Y, const T & A, const T & B);
 
+// GF2nX (small degrees only, plain Euclid)
+void XGCD(GF2nX & G, GF2nX & X, GF2nX & Y, const GF2nX & A, const GF2nX & B);
+
 
 //
 // XGCD_LEFT
@@ -48,6 +53,8 @@ void XGCD(T & G, T & X, T & Y, const T & A, const T & B);
 template < class T >
 void XGCD_LEFT(T & G, T & X, const T & A, const T & B);
 
+void XGCD_LEFT(GF2nX & G, GF2nX & X, const GF2nX & A, const GF2nX & B);
+
 
 
 //
@@ -59,6 +66,7 @@ void XGCD_PARTIAL(T & R2, T & R1, T & C2, T & C1, long bound, bool & flag);
 
 // flag not requred for GF2EX version
 void XGCD_PARTIAL(GF2EX & R2, GF2EX & R1, GF2EX & C2, GF2EX & C1, long bound);
+void XGCD_PARTIAL(GF2nX & R2, GF2nX & R1, GF2nX & C2, GF2nX & C1, long bound);
 
 // integer version uses a ZZ bound and Lehmer's variation (also no flag)
 void XGCD_PARTIAL(ZZ & R2, ZZ & R1, ZZ & C2, ZZ & C1, const ZZ & bound);
@@ -75,6 +83,7 @@ void XGCD_PARTIAL_REDUCE(T & R2, T & R1, T & B2, T & B1, long bound, bool & flag
 
 // flag not requred for GF2EX version
 void XGCD_PARTIAL_REDUCE(GF2EX & R2, GF2EX & R1, GF2EX & B2, GF2EX & B1, long bound, bool even);
+void XGCD_PARTIAL_REDUCE(GF2nX & R2, GF2nX & R1, GF2nX & B2, GF2nX & B1, long bound, bool even);
 
 
 
@@ -34,6 +34,7 @@
 
 
 #include <ANTL/common.hpp>
+#include <ANTL/Arithmetic/GF2nX.hpp>
 
 // We use the NTL namespace everywhere. Rather than have a using directive in
 // every file, we just put it here, for convenience and clarity.
@@ -67,6 +68,7 @@ void XGCD_PARTIAL_PLAIN(T & R2, T & R1, T & C2, T & C1, long bound, bool & flag)
 
 // flag not requred for GF2EX version
 void XGCD_PARTIAL_PLAIN(GF2EX & R2, GF2EX & R1, GF2EX & C2, GF2EX & C1, long bound);
+void XGCD_PARTIAL_PLAIN(GF2nX & R2, GF2nX & R1, GF2nX & C2, GF2nX & C1, long bound);
 
 // integer version uses a ZZ bound and Lehmer's variation (also no flag)
 //void XGCD_PARTIAL_PLAIN(ZZ & R2, ZZ & R1, ZZ & C2, ZZ & C1, const ZZ & bound);
@@ -82,6 +84,16 @@ void XGCD_PARTIAL_REDUCE_PLAIN(T & R2, T & R1, T & B2, T & B1, long bound, bool
 
 // flag not requred for GF2EX version
 void XGCD_PARTIAL_REDUCE_PLAIN(GF2EX & R2, GF2EX & R1, GF2EX & B2, GF2EX & B1, long bound, bool even);
+void XGCD_PARTIAL_REDUCE_PLAIN(GF2nX & R2, GF2nX & R1, GF2nX & B2, GF2nX & B1, long bound, bool even);
+
+
+
+//
+// Declare specialized methods
+//
+
+template <> void XGCD_PLAIN(GF2nX & G, GF2nX & X, GF2nX & Y, const GF2nX & A, const GF2nX & B);
+template <> void XGCD_LEFT_PLAIN(GF2nX & G, GF2nX & X, const GF2nX & A, const GF2nX & B);
 
 
 
@@ -176,6 +176,16 @@ namespace ANTL {
   long Jacobi_base (const long & a, const long & n);
   long Jacobi_base (const long long & a, const long long & n);
   long Jacobi_base (const ZZ & a, const ZZ & n);
+  void Jacobi_base (long *J, const long *a, const long *n, long len);
+
+  /* remainders r[i] = a mod n[i], 0 <= r[i] < n[i], for a block of word-size
+     moduli */
+  void rem_block (long *r, const ZZ & a, const long *n, long len);
+  void rem_block (long *r, const long & a, const long *n, long len);
+
+  /* square root x of a modulo a word-size prime p (Tonelli-Shanks); returns
+     0 if p | a, -1 if a is a non-residue, and 1 otherwise */
+  long ressol_long (long & x, long a, long p);
 
   /* Jacobi functions - no preconditions on a and n */
   long Jacobi(const long & a, const long & n);
@@ -201,6 +211,13 @@ namespace ANTL {
   long Kronecker(const zz_pEX & a, const zz_pEX & n);
   long Kronecker(const GF2EX & h, const GF2EX & f, const GF2EX & n);
 
+  /* leading coefficient tests - true if the infinite place splits, i.e., if
+     lc(D) is a square (y^2 = D), resp. z^2 + z = lc(f)/lc(h)^2 is solvable
+     (y^2 + h y = f, deg f = 2 deg h) */
+  bool test_Dcoeff(const ZZ_pX & D);
+  bool test_Dcoeff(const zz_pX & D);
+  bool test_Dcoeff(const GF2EX & f, const GF2EX & h);
+
   // finite field cardinality macros
   template <class> ZZ CARDINALITY(void);
 
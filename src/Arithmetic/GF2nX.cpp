@@ -0,0 +1,503 @@
+/**
+ * @file GF2nX.cpp
+ * @remark packed GF(2^n) elements and polynomials of small degree over GF(2^n)
+ */
+
+#include <ANTL/Arithmetic/GF2nX.hpp>
+
+long GF2n::n = 0;
+unsigned long GF2n::low = 0;
+unsigned long GF2n::mask = 0;
+
+
+
+//
+// GF2n::init()
+//
+// Task:
+//      sets the modulus to P (irreducible, deg P <= NTL_BITS_PER_LONG),
+//      resp. to a sparse irreducible polynomial of degree n; GF2E is
+//      initialized with the same modulus
+//
+
+void GF2n::init (const GF2X & P)
+{
+  long d = NTL::deg(P);
+
+  if (d < 1 || d > NTL_BITS_PER_LONG)
+    LogicError("GF2n::init: bad modulus degree");
+
+  n = d;
+  mask = (d == NTL_BITS_PER_LONG) ? ~0UL : (1UL << d) - 1;
+  low = 0;
+  for (long i = 0; i < d; ++i)
+    if (NTL::IsOne(NTL::coeff(P, i)))
+      low |= 1UL << i;
+
+  GF2E::init(P);
+}
+
+void GF2n::init (long d)
+{
+  GF2X P;
+  BuildSparseIrred(P, d);
+  init(P);
+}
+
+
+
+//
+// inv()
+//
+// Task:
+//      x = 1/a, by the extended Euclidean algorithm on GF(2)[t] (with
+//      128 bit words, since P may need NTL_BITS_PER_LONG + 1 bits)
+//
+
+static inline long deg128 (unsigned __int128 x)
+{
+  unsigned long hi = (unsigned long) (x >> NTL_BITS_PER_LONG);
+  if (hi)
+    return 2*NTL_BITS_PER_LONG - 1 - __builtin_clzl(hi);
+  if ((unsigned long) x)
+    return NTL_BITS_PER_LONG - 1 - __builtin_clzl((unsigned long) x);
+  return -1;
+}
+
+void inv (GF2n & x, const GF2n & a)
+{
+  unsigned __int128 u, v, g1, g2, t;
+  long j;
+
+  if (IsZero(a))
+    LogicError("GF2n: division by zero");
+
+  // invariants:  g1 a = u, g2 a = v (mod P)
+  u = a.rep;
+  v = ((unsigned __int128) 1 << GF2n::n) | GF2n::low;
+  g1 = 1;
+  g2 = 0;
+
+  while (u != 1) {
+    j = deg128(u) - deg128(v);
+    if (j < 0) {
+      t = u; u = v; v = t;
+      t = g1; g1 = g2; g2 = t;
+      j = -j;
+    }
+    u ^= v << j;
+    g1 ^= g2 << j;
+  }
+
+  // deg g1 < n
+  x.rep = (unsigned long) g1;
+}
+
+void div (GF2n & x, const GF2n & a, const GF2n & b)
+{
+  GF2n t;
+  inv(t, b);
+  mul(x, a, t);
+}
+
+
+
+//
+// SqrRoot()
+//
+// Task:
+//      x = sqrt(a) = a^(2^(n-1))
+//
+
+void SqrRoot (GF2n & x, const GF2n & a)
+{
+  x = a;
+  for (long i = 1; i < GF2n::n; ++i)
+    sqr(x, x);
+}
+
+
+
+//
+// SolveArtinSchreier()
+//
+// Task:
+//      finds z with z^2 + z = c.  Returns false if there is none (i.e., the
+//      trace of c is 1).  The map z -> z^2 + z is GF(2)-linear; its images
+//      of the basis t^i are put into echelon form (with the combinations of
+//      the t^i giving each basis vector), and c is reduced with them.
+//
+
+bool SolveArtinSchreier (GF2n & z, const GF2n & c)
+{
+  unsigned long basis[NTL_BITS_PER_LONG], comb[NTL_BITS_PER_LONG];
+  unsigned long v, w, r;
+  long i, p;
+  GF2n e;
+
+  for (i = 0; i < NTL_BITS_PER_LONG; ++i)
+    basis[i] = 0;
+
+  for (i = 0; i < GF2n::n; ++i) {
+    e.rep = 1UL << i;
+    sqr(e, e);
+    v = e.rep ^ (1UL << i);
+    w = 1UL << i;
+
+    // reduce by the basis (pivot = highest bit)
+    while (v) {
+      p = NTL_BITS_PER_LONG - 1 - __builtin_clzl(v);
+      if (!basis[p]) {
+        basis[p] = v;
+        comb[p] = w;
+        break;
+      }
+      v ^= basis[p];
+      w ^= comb[p];
+    }
+  }
+
+  v = c.rep;
+  r = 0;
+  while (v) {
+    p = NTL_BITS_PER_LONG - 1 - __builtin_clzl(v);
+    if (!basis[p])
+      return false;
+    v ^= basis[p];
+    r ^= comb[p];
+  }
+
+  z.rep = r;
+  return true;
+}
+
+
+
+void random (GF2n & x)
+{
+  x.rep = RandomWord() & GF2n::mask;
+}
+
+void conv (GF2n & x, const GF2X & a)
+{
+  x.rep = 0;
+  for (long i = 0; i <= NTL::deg(a) && i < GF2n::n; ++i)
+    if (NTL::IsOne(NTL::coeff(a, i)))
+      x.rep |= 1UL << i;
+}
+
+void conv (GF2X & x, const GF2n & a)
+{
+  NTL::clear(x);
+  for (long i = 0; i < GF2n::n; ++i)
+    if ((a.rep >> i) & 1)
+      NTL::SetCoeff(x, i);
+}
+
+void conv (GF2n & x, const GF2E & a)
+{
+  conv(x, rep(a));
+}
+
+void conv (GF2E & x, const GF2n & a)
+{
+  GF2X t;
+  conv(t, a);
+  NTL::conv(x, t);
+}
+
+std::ostream & operator << (std::ostream & out, const GF2n & a)
+{
+  GF2X t;
+  conv(t, a);
+  return out << t;
+}
+
+
+
+//
+// polynomials
+//
+
+void SetX (GF2nX & x)
+{
+  x.len = 2;
+  x.rep[0] = 0;
+  x.rep[1] = 1;
+}
+
+void SetCoeff (GF2nX & x, long i, const GF2n & c)
+{
+  if (i >= x.len) {
+    if (IsZero(c))
+      return;
+    long l = x.len;
+    x.SetLength(i + 1);
+    for (; l < i; ++l)
+      x.rep[l] = 0;
+  }
+  x.rep[i] = c.rep;
+  x.normalize();
+}
+
+void SetCoeff (GF2nX & x, long i)
+{
+  SetCoeff(x, i, GF2n(1));
+}
+
+void add (GF2nX & x, const GF2nX & a, const GF2nX & b)
+{
+  long i, la = a.len, lb = b.len;
+
+  if (la < lb) {
+    x.SetLength(lb);
+    for (i = 0; i < la; ++i)
+      x.rep[i] = a.rep[i] ^ b.rep[i];
+    for (; i < lb; ++i)
+      x.rep[i] = b.rep[i];
+  }
+  else {
+    x.SetLength(la);
+    for (i = 0; i < lb; ++i)
+      x.rep[i] = a.rep[i] ^ b.rep[i];
+    for (; i < la; ++i)
+      x.rep[i] = a.rep[i];
+    if (la == lb)
+      x.normalize();
+  }
+}
+
+
+
+//
+// mul()
+//
+// Task:
+//      x = a b (schoolbook; each coefficient is reduced once)
+//
+
+void mul (GF2nX & x, const GF2nX & a, const GF2nX & b)
+{
+  unsigned long r[GF2NX_MAX_LEN], hi, lo, h, l;
+  long i, j, jmin, jmax, la = a.len, lb = b.len, lx;
+
+  if (la == 0 || lb == 0) {
+    clear(x);
+    return;
+  }
+
+  lx = la + lb - 1;
+  if (lx > GF2NX_MAX_LEN)
+    LogicError("GF2nX: degree too large (increase GF2NX_MAX_LEN)");
+
+  for (i = 0; i < lx; ++i) {
+    jmin = (i - lb + 1 > 0) ? i - lb + 1 : 0;
+    jmax = (i < la - 1) ? i : la - 1;
+    hi = lo = 0;
+    for (j = jmin; j <= jmax; ++j) {
+      clmul(h, l, a.rep[j], b.rep[i-j]);
+      hi ^= h;
+      lo ^= l;
+    }
+    r[i] = GF2n_reduce(hi, lo);
+  }
+
+  x.len = lx;
+  std::memcpy(x.rep, r, lx*sizeof(unsigned long));
+}
+
+void mul (GF2nX & x, const GF2nX & a, const GF2n & b)
+{
+  GF2n t;
+
+  if (IsZero(b)) {
+    clear(x);
+    return;
+  }
+
+  x.len = a.len;
+  for (long i = 0; i < a.len; ++i) {
+    mul(t, GF2n(a.rep[i]), b);
+    x.rep[i] = t.rep;
+  }
+}
+
+void sqr (GF2nX & x, const GF2nX & a)
+{
+  long i, la = a.len;
+  GF2n t;
+
+  if (la == 0) {
+    clear(x);
+    return;
+  }
+
+  x.SetLength(2*la - 1);
+
+  // from the top, so that x may alias a
+  for (i = la - 1; i >= 0; --i) {
+    sqr(t, GF2n(a.rep[i]));
+    x.rep[2*i] = t.rep;
+    if (i)
+      x.rep[2*i-1] = 0;
+  }
+}
+
+
+
+//
+// DivRem()
+//
+// Task:
+//      a = q b + r with deg r < deg b (b != 0)
+//
+
+void DivRem (GF2nX & q, GF2nX & r, const GF2nX & a, const GF2nX & b)
+{
+  unsigned long R[GF2NX_MAX_LEN], B[GF2NX_MAX_LEN], Q[GF2NX_MAX_LEN];
+  long i, j, da = deg(a), db = deg(b);
+  GF2n lc, c, t;
+
+  if (db < 0)
+    LogicError("GF2nX: division by zero");
+
+  if (da < db) {
+    r = a;
+    clear(q);
+    return;
+  }
+
+  std::memcpy(R, a.rep, a.len*sizeof(unsigned long));
+  std::memcpy(B, b.rep, b.len*sizeof(unsigned long));
+
+  lc.rep = B[db];
+  if (!IsOne(lc))
+    inv(lc, lc);
+
+  for (i = da; i >= db; --i) {
+    c.rep = R[i];
+    if (!IsOne(lc))
+      mul(c, c, lc);
+    Q[i-db] = c.rep;
+    if (IsZero(c))
+      continue;
+    for (j = 0; j < db; ++j) {
+      mul(t, c, GF2n(B[j]));
+      R[i-db+j] ^= t.rep;
+    }
+  }
+
+  q.len = da - db + 1;
+  std::memcpy(q.rep, Q, q.len*sizeof(unsigned long));
+
+  r.len = db;
+  std::memcpy(r.rep, R, db*sizeof(unsigned long));
+  r.normalize();
+}
+
+void div (GF2nX & q, const GF2nX & a, const GF2nX & b)
+{
+  GF2nX r;
+  DivRem(q, r, a, b);
+}
+
+void div (GF2nX & q, const GF2nX & a, const GF2n & b)
+{
+  GF2n t;
+  inv(t, b);
+  mul(q, a, t);
+}
+
+void rem (GF2nX & r, const GF2nX & a, const GF2nX & b)
+{
+  GF2nX q;
+  DivRem(q, r, a, b);
+}
+
+void MulMod (GF2nX & x, const GF2nX & a, const GF2nX & b, const GF2nX & f)
+{
+  mul(x, a, b);
+  rem(x, x, f);
+}
+
+void MakeMonic (GF2nX & x)
+{
+  if (IsZero(x) || IsOne(LeadCoeff(x)))
+    return;
+
+  GF2n t;
+  inv(t, LeadCoeff(x));
+  mul(x, x, t);
+}
+
+void GCD (GF2nX & d, const GF2nX & a, const GF2nX & b)
+{
+  GF2nX u(a), v(b), q, r;
+
+  while (!IsZero(v)) {
+    DivRem(q, r, u, v);
+    u = v;
+    v = r;
+  }
+
+  MakeMonic(u);
+  d = u;
+}
+
+void eval (GF2n & y, const GF2nX & f, const GF2n & a)
+{
+  GF2n t;
+
+  clear(t);
+  for (long i = f.len - 1; i >= 0; --i) {
+    mul(t, t, a);
+    t.rep ^= f.rep[i];
+  }
+  y = t;
+}
+
+void random (GF2nX & x, long n)
+{
+  GF2n c;
+
+  x.SetLength(n);
+  for (long i = 0; i < n; ++i) {
+    random(c);
+    x.rep[i] = c.rep;
+  }
+  x.normalize();
+}
+
+void conv (GF2nX & x, const GF2EX & a)
+{
+  GF2n c;
+
+  x.SetLength(NTL::deg(a) + 1);
+  for (long i = 0; i < x.len; ++i) {
+    conv(c, NTL::coeff(a, i));
+    x.rep[i] = c.rep;
+  }
+}
+
+void conv (GF2EX & x, const GF2nX & a)
+{
+  GF2E c;
+
+  NTL::clear(x);
+  for (long i = 0; i < a.len; ++i) {
+    conv(c, GF2n(a.rep[i]));
+    NTL::SetCoeff(x, i, c);
+  }
+}
+
+bool operator == (const GF2nX & a, const GF2nX & b)
+{
+  return a.len == b.len && std::memcmp(a.rep, b.rep, a.len*sizeof(unsigned long)) == 0;
+}
+
+std::ostream & operator << (std::ostream & out, const GF2nX & a)
+{
+  GF2EX t;
+  conv(t, a);
+  return out << t;
+}
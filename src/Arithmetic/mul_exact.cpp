@@ -917,3 +917,26 @@ KarMulExact(GF2EX & x, const GF2EX & a, const GF2EX & b, long n)
 #endif
 }
 */
+
+
+
+//
+// MulExact, SqrExact (GF2nX)
+//
+// The degrees are small, so the full product (one reduction per
+// coefficient) is computed.
+//
+
+template <>
+void
+MulExact(GF2nX & x, const GF2nX & a, const GF2nX & b, long n)
+{
+  mul(x,a,b);
+}
+
+template <>
+void
+SqrExact(GF2nX & x, const GF2nX & a, long n)
+{
+  sqr(x,a);
+}
@@ -14,95 +14,106 @@ DoubleExponentiationHBTJSF<T>::readPrecomps(T &C, short mDigit, short nDigit)
 {
 
   int switcher = 6*mDigit + nDigit;
+  int index = 0;
+  bool negative = false;
 
   switch(switcher){
-    case -13:  //(-2,-1)
-       assign(C,precomps[4]);
-       inv(C,C);
+    case -13:  // (-2,-1)
+       index = 4;
+       negative = true;
        break;
-    case -11:  //(-2,1)
-       assign(C,precomps[5]);
-       inv(C,C);
+    case -11:  // (-2,1)
+       index = 5;
+       negative = true;
        break;
     case -9:   // (-2,3)
-       assign(C,precomps[15]);
-       inv(C,C);
+       index = 15;
+       negative = true;
        break;
     case -8:   // (-1,-2)
-       assign(C,precomps[8]);
-       inv(C,C);
+       index = 8;
+       negative = true;
        break;
     case -7:   // (-1,-1)
-       assign(C,precomps[2]);
-       inv(C,C);
+       index = 2;
+       negative = true;
        break;
     case -6:   // (-1,0)
-       assign(C,precomps[0]);
-       inv(C,C);
+       index = 0;
+       negative = true;
        break;
     case -5:   // (-1,1)
-       assign(C,precomps[3]);
-       inv(C,C);
+       index = 3;
+       negative = true;
        break;
     case -4:   // (-1,2)
-       assign(C,precomps[9]);
-       inv(C,C);
+       index = 9;
+       negative = true;
        break;
     case -3:   // (-1,3)
-       assign(C,precomps[13]);
-       inv(C,C);
+       index = 13;
+       negative = true;
        break;
     case -1:   // (0,-1)
-       assign(C,precomps[1]);
-       inv(C,C);
+       index = 1;
+       negative = true;
        break;
-    case 1:   // (0,1)
-       assign(C,precomps[1]);
+    case 1:    // (0,1)
+       index = 1;
        break;
-    case 4:   // (1,-2)
-       assign(C,precomps[9]);
+    case 4:    // (1,-2)
+       index = 9;
        break;
-    case 5:   // (1,-1)
-       assign(C,precomps[3]);
+    case 5:    // (1,-1)
+       index = 3;
        break;
-    case 6:   // (1,0)
-       assign(C,precomps[0]);
+    case 6:    // (1,0)
+       index = 0;
        break;
-    case 7:   // (1,1)
-       assign(C,precomps[2]);
+    case 7:    // (1,1)
+       index = 2;
        break;
-    case 8:   // (1,2)
-       assign(C,precomps[8]);
+    case 8:    // (1,2)
+       index = 8;
        break;
-    case 9:   // (1,3)
-       assign(C,precomps[12]);
+    case 9:    // (1,3)
+       index = 12;
        break;
     case 11:   // (2,-1)
-       assign(C,precomps[5]);
+       index = 5;
        break;
     case 13:   // (2,1)
-       assign(C,precomps[4]);
+       index = 4;
        break;
     case 15:   // (2,3)
-       assign(C,precomps[14]);
+       index = 14;
        break;
     case 16:   // (3,-2)
-       assign(C,precomps[11]);
+       index = 11;
        break;
     case 17:   // (3,-1)
-       assign(C,precomps[7]);
+       index = 7;
        break;
     case 19:   // (3,1)
-       assign(C,precomps[6]);
+       index = 6;
        break;
     case 20:   // (3,2)
-       assign(C,precomps[10]);
+       index = 10;
        break;
-    default:   // (3,2)
+    default:
        assign(C,precomps[0]);
        cout << "Error in parsing representation; got digits: " << mDigit << "," << nDigit << endl;
        cout << "All digits should be in {-2,-1,0,1,2,3}, and should be coprime." << endl;
+       return;
     }
+
+  // inverses are precomputed unless T is inversion free
+  if (!negative)
+    assign(C,precomps[index]);
+  else if (is_inversion_free<T>::value)
+    inv(C,precomps[index]);
+  else
+    assign(C,precompsInv[index]);
 }
 
 //
@@ -134,6 +145,14 @@ DoubleExponentiationHBTJSF<T>::initializeBase(const T &A, const T&B)
   mul(precomps[14],precomps[12],precomps[0]);   //A^2B^3
   mul(precomps[15],precomps[13],precomps[0]);   //A^2B^-3
 
+  // inverses for negative digits (unless computed on the fly)
+  if (is_inversion_free<T>::value)
+    precompsInv.clear();
+  else {
+    precompsInv.resize(16);
+    for (int i = 0; i < 16; ++i)
+      inv(precompsInv[i],precomps[i]);
+  }
 
 } 
 
@@ -195,25 +214,20 @@ DoubleExponentiationHBTJSF<T>::power (T &C, const T &A, const T &B, const ZZ & m
       initializeExponent(m,n);
   }
 
-  //Do the exponentiation
+  //Do the exponentiation (the representation is kept for later calls)
   T temp;
-  readPrecomps(C, em.back(), en.back());
-  base.pop_back();
-  em.pop_back();
-  en.pop_back();
-  while(!base.empty()){
-    if(base.back() == 2){
+  long j = base.size() - 1;
+  readPrecomps(C, em[j], en[j]);
+  for(--j; j >= 0; --j){
+    if(base[j] == 2){
        sqr(C,C);
-    }else if(base.back() == 3){
+    }else if(base[j] == 3){
        cub(C,C);
     }
-    if(em.back() != 0 || en.back() != 0){
-       readPrecomps(temp, em.back(), en.back());
+    if(em[j] != 0 || en[j] != 0){
+       readPrecomps(temp, em[j], en[j]);
        mul(C,C,temp);
     }
-    base.pop_back();
-    em.pop_back();
-    en.pop_back();
   }
 
 }	
@@ -60,6 +60,9 @@ void
 DoubleExponentiationIL<T>::power (T &C, const T &A, const T &B, const ZZ & m, const ZZ & n)
 {
   // compute WNAF expansion of m and n (right-to-left)
+  em.clear();
+  en.clear();
+
   ZZ ex = abs (m);
   while (ex > 0)
     {
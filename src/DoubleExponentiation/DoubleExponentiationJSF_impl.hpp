@@ -16,12 +16,18 @@ DoubleExponentiationJSF<T>::initialize(const T &A, const T&B, const ZZ &m, const
 
   //create precomputed values
 
-  inv(AInv,A);
-  inv(BInv,B);
   mul(AB, A, B);
-  mul(ABInv, A, BInv);
-  inv(AInvB, ABInv);
-  inv(AInvBInv, AB);
+  if (is_inversion_free<T>::value) {
+    // the inverses are computed on the fly
+    mulinv(ABInv, A, B, AInv);
+  }
+  else {
+    inv(AInv,A);
+    inv(BInv,B);
+    mul(ABInv, A, BInv);
+    inv(AInvB, ABInv);
+    inv(AInvBInv, AB);
+  }
 
 
 
@@ -39,6 +45,8 @@ void
 DoubleExponentiationJSF<T>::power (T &C, const T &A, const T &B, const ZZ & m, const ZZ & n)
 {
   // compute JSF expansion of m and n (right-to-left)
+  em.clear();
+  en.clear();
 
   ZZ mt = m;
   ZZ nt = n;
@@ -98,6 +106,7 @@ DoubleExponentiationJSF<T>::power (T &C, const T &A, const T &B, const ZZ & m, c
   }
   else
     assign(C,B);
+  const bool invFree = is_inversion_free<T>::value;
   for (register long j = em.size()-2; j >= 0; --j)
     {
       sqr(C, C);
@@ -111,17 +120,29 @@ DoubleExponentiationJSF<T>::power (T &C, const T &A, const T &B, const ZZ & m, c
         }
      }else if(em.at(j) == 0){
         if(en.at(j) == -1){
-          mul(C, C, BInv);
+          if(invFree)
+            mulinv(C, C, B, AInv);
+          else
+            mul(C, C, BInv);
         }else if(en.at(j) == 1){
           mul(C,C,B);
         }
      }else if(em.at(j) == -1){
         if(en.at(j) == -1){
-          mul(C,C,AInvBInv);
+          if(invFree)
+            mulinv(C, C, AB, AInv);
+          else
+            mul(C,C,AInvBInv);
         }else if(en.at(j) == 0){
-           mul(C,C,AInv);
+          if(invFree)
+            mulinv(C, C, A, AInv);
+          else
+            mul(C,C,AInv);
         }else if(en.at(j) == 1){
-           mul(C,C,AInvB);
+          if(invFree)
+            mulinv(C, C, ABInv, AInv);
+          else
+            mul(C,C,AInvB);
         }
      }
       
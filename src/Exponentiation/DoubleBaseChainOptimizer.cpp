@@ -0,0 +1,212 @@
+/**
+ * @file DoubleBaseChainOptimizer.cpp
+ * @brief search for double base (2,3) chains of minimal weighted cost
+ */
+
+#include <ANTL/Exponentiation/DoubleBaseChainOptimizer.hpp>
+
+using namespace ANTL;
+
+//
+// DoubleBaseChainOptimizer::optimize()
+//
+// Task:
+//      dynamic programming over the states (a, b, delta), m = floor(n/(2^a 3^b))
+//      + delta.  The rows b are processed from the largest power of 3 down,
+//      and in each row a decreases, so that the states reached by dividing
+//      by 2 (a+1) and by 3 (b+1) are known.  Divisions lead to delta in
+//      {0, 1}, and the cost of such a state is the cost of an optional
+//      multiplication (m -> m -+ 1) followed by a division (or nothing if
+//      m = 1), i.e., of D[delta-1], D[delta] or D[delta+1].  The choices are
+//      stored in one byte per state:
+//          bits 0-1:  0 = m is 1, 1 = halve, 2 = divide by 3 (after the move)
+//          bits 2-3:  0 = no multiplication, 1 = m -> m-1, 2 = m -> m+1
+//          bits 4-5:  floor(n/(2^a 3^b)) mod 3
+//          bit  6:    floor(n/(2^a 3^b)) mod 2
+//
+
+double DoubleBaseChainOptimizer::optimize (ExponentRecoding & R, const ZZ & n) const
+{
+  const double INF = 1e300;
+  std::vector<ZZ> q;
+  std::vector< std::vector<unsigned char> > choice;
+  std::vector<double> cur[2], next[2];
+  std::vector<char> ops;
+  ZZ ex = abs(n);
+  long B, b, a, nb, nbnext, d, dd, r, p, m0, m, twos, threes;
+  long i, sgn;
+  double D[4], best, c;
+  int div3[4];
+  unsigned char ch, mv;
+
+  if (IsZero(n))
+    LogicError("DoubleBaseChainOptimizer: zero exponent");
+
+  // q[b] = floor(|n| / 3^b) >= 1
+  q.push_back(ex);
+  while (q.back() >= 3) {
+    q.push_back(ZZ());
+    div(q.back(), q[q.size() - 2], 3);
+  }
+  B = q.size() - 1;
+  choice.resize(B + 1);
+
+  nbnext = 0;
+  for (b = B; b >= 0; --b) {
+    nb = NumBits(q[b]);
+    choice[b].assign(2*(nb + 1), 0);
+    // a = nb + 1 is past the top bit:  m = delta, so only delta = 1 (m = 1)
+    // is reachable, by halving m = 2 at a = nb
+    for (d = 0; d < 2; ++d)
+      cur[d].assign(nb + 2, INF);
+    cur[1][nb + 1] = 0;
+
+    r = 0;
+    for (a = nb; a >= 0; --a) {
+      p = (a < nb) ? bit(q[b], a) : 0;
+      r = (2*r + p) % 3;
+
+      // m0 = floor(q[b] / 2^a) if it is small, otherwise 4
+      if (a >= nb - 2) {
+        m0 = 0;
+        for (i = nb - 1; i >= a; --i)
+          m0 = 2*m0 + bit(q[b], i);
+      }
+      else
+        m0 = 4;
+
+      // D[d]:  finish with a division, delta = d - 1 in {-1, 0, 1, 2}
+      for (d = 0; d < 4; ++d) {
+        m = m0 + d - 1;
+        D[d] = INF;
+        div3[d] = 3;
+        if (m == 1) {
+          D[d] = 0;
+          div3[d] = 0;
+        }
+        else if (m > 1) {
+          if (((p + d - 1) & 1) == 0) {
+            dd = (p + d - 1) / 2;
+            c = S + cur[dd][a + 1];
+            if (c < D[d]) {
+              D[d] = c;
+              div3[d] = 1;
+            }
+          }
+          if ((r + d - 1) % 3 == 0) {
+            dd = (r + d - 1) / 3;
+            if (b < B && a <= nbnext)
+              c = C + next[dd][a];
+            else
+              c = (dd == 1) ? C : INF;    // floor(n / (2^a 3^(b+1))) = 0
+            if (c < D[d]) {
+              D[d] = c;
+              div3[d] = 2;
+            }
+          }
+        }
+      }
+
+      // delta in {0, 1}:  at most one multiplication before the division
+      for (d = 1; d < 3; ++d) {
+        best = D[d];
+        mv = 0;
+        if (M + D[d-1] < best) {
+          best = M + D[d-1];
+          mv = 1;
+        }
+        if (M + D[d+1] < best) {
+          best = M + D[d+1];
+          mv = 2;
+        }
+        dd = (mv == 1) ? d - 1 : ((mv == 2) ? d + 1 : d);
+        choice[b][2*a + d - 1] = div3[dd] | (mv << 2) | (r << 4) | (p << 6);
+        cur[d-1][a] = best;
+      }
+    }
+
+    for (d = 0; d < 2; ++d)
+      next[d].swap(cur[d]);
+    nbnext = nb;
+  }
+
+  best = next[0][0];
+  if (best >= INF)
+    LogicError("DoubleBaseChainOptimizer: no chain");
+
+  // follow the choices from n down to 1:  ops are 's' (halve), 'c' (divide
+  // by 3), '+' (m -> m-1, i.e., multiply by A), '-' (m -> m+1, multiply by A^-1)
+  a = b = 0;
+  d = 0;
+  while (true) {
+    ch = choice[b][2*a + d];
+    p = (ch >> 6) & 1;
+    r = (ch >> 4) & 3;
+    if (((ch >> 2) & 3) == 1) {
+      ops.push_back('+');
+      --d;
+    }
+    else if (((ch >> 2) & 3) == 2) {
+      ops.push_back('-');
+      ++d;
+    }
+
+    if ((ch & 3) == 0)
+      break;
+    else if ((ch & 3) == 1) {
+      ops.push_back('s');
+      d = (p + d) / 2;
+      ++a;
+      if (a >= (long) choice[b].size() / 2)
+        break;    // reached m = 1 with floor(...) = 0
+    }
+    else {
+      ops.push_back('c');
+      d = (r + d) / 3;
+      ++b;
+      if (b > B || a >= (long) choice[b].size() / 2)
+        break;    // reached m = 1 with floor(...) = 0
+    }
+  }
+
+  // replay forwards as a strict chain
+  sgn = (sign(n) < 0) ? -1 : 1;
+  R.exponent = n;
+  R.type = ExponentRecoding::STRICT_CHAIN;
+  R.param = 0;
+  R.steps.clear();
+  R.maxDigit = 1;
+  R.maxBaseThrees = 0;
+  R.negative = false;
+
+  R.push(sgn, 0, 0, 0);
+  twos = threes = 0;
+  for (i = ops.size() - 1; i >= 0; --i) {
+    if (ops[i] == 's')
+      ++twos;
+    else if (ops[i] == 'c')
+      ++threes;
+    else {
+      R.push((ops[i] == '+') ? sgn : -sgn, twos, threes, 0);
+      twos = threes = 0;
+    }
+  }
+  if (twos > 0 || threes > 0)
+    R.push(0, twos, threes, 0);
+
+  return best;
+}
+
+
+
+//
+// DoubleBaseChainOptimizer::cost()
+//
+// Task:
+//      returns S (#squarings) + C (#cubings) + M (#multiplications) of R
+//
+
+double DoubleBaseChainOptimizer::cost (const ExponentRecoding & R) const
+{
+  return S*R.squarings() + C*R.cubings() + M*R.multiplications();
+}
@@ -0,0 +1,382 @@
+/**
+ * @file ElementOrder_impl.hpp
+ * @brief generic implementation of templated methods from ElementOrder class
+ */
+
+#include <algorithm>
+
+using namespace ANTL;
+
+//
+// ElementOrder<T>::power()
+//
+// Task:
+//      computes C = A^n (C = one for n = 0), reduced, with the chosen
+//      exponentiation or left-to-right binary with the operations of
+//      element_group<T>.  C must not be A.
+//
+template < class T >
+void
+ElementOrder<T>::power (T &C, const T &A, const ZZ &n, const T &one)
+{
+  if (IsZero(n))
+    C = one;
+  else if (E) {
+    E->power(C, A, n);
+    element_group<T>::reduce(C);
+  }
+  else {
+    C = A;
+    for (long i = NumBits(n) - 2; i >= 0; --i) {
+      element_group<T>::square(C, C);
+      if (bit(n, i))
+        element_group<T>::multiply(C, C, A);
+    }
+  }
+}
+
+
+//
+// ElementOrder<T>::pollardBrent()
+//
+// Task:
+//      finds a non-trivial factor f of the odd composite n with Brent's
+//      variant of Pollard's rho method
+//
+template < class T >
+void
+ElementOrder<T>::pollardBrent (ZZ &f, const ZZ &n)
+{
+  ZZ x, y, ys, q, t;
+  long r, i, k, m = 128;
+
+  for (long c = 1; ; ++c) {
+    y = 2;
+    q = 1;
+    f = 1;
+    r = 1;
+
+    do {
+      x = y;
+      for (i = 0; i < r; ++i) {
+        SqrMod(y, y, n);
+        AddMod(y, y, c, n);
+      }
+
+      k = 0;
+      do {
+        ys = y;
+        for (i = 0; i < m && i < r - k; ++i) {
+          SqrMod(y, y, n);
+          AddMod(y, y, c, n);
+          SubMod(t, x, y, n);
+          MulMod(q, q, t, n);
+        }
+        GCD(f, q, n);
+        k += m;
+      } while (k < r && IsOne(f));
+
+      r <<= 1;
+    } while (IsOne(f));
+
+    if (f == n) {
+      // backtrack from ys
+      do {
+        SqrMod(ys, ys, n);
+        AddMod(ys, ys, c, n);
+        SubMod(t, x, ys, n);
+        GCD(f, t, n);
+      } while (IsOne(f));
+    }
+
+    if (f != n)
+      return;
+  }
+}
+
+
+//
+// ElementOrder<T>::factor()
+//
+// Task:
+//      computes the distinct prime divisors of |n| (trial division up to
+//      2^16, then Pollard-Brent rho), in increasing order
+//
+template < class T >
+void
+ElementOrder<T>::factor (std::vector<ZZ> &primes, const ZZ &n)
+{
+  ZZ m, f;
+  long p;
+  PrimeSeq seq;
+
+  primes.clear();
+  abs(m, n);
+  if (IsZero(m))
+    LogicError("ElementOrder: cannot factor 0");
+
+  for (p = seq.next(); p != 0 && p < (1L << 16) && !IsOne(m); p = seq.next()) {
+    if (divide(m, p)) {
+      primes.push_back(ZZ(p));
+      while (divide(m, m, p));
+    }
+    if (m < p*p) {
+      if (!IsOne(m)) {
+        primes.push_back(m);
+        m = 1;
+      }
+      break;
+    }
+  }
+
+  // all remaining prime factors are > 2^16
+  std::vector<ZZ> todo;
+  if (!IsOne(m))
+    todo.push_back(m);
+  while (!todo.empty()) {
+    m = todo.back();
+    todo.pop_back();
+
+    if (ProbPrime(m)) {
+      if (std::find(primes.begin(), primes.end(), m) == primes.end())
+        primes.push_back(m);
+      continue;
+    }
+
+    pollardBrent(f, m);
+    todo.push_back(f);
+    todo.push_back(m / f);
+  }
+
+  std::sort(primes.begin(), primes.end());
+}
+
+
+//
+// ElementOrder<T>::reduce()
+//
+// Task:
+//      computes the order of B, which divides prod p[i]^e[i], first <= i < last.
+//      For a single prime, B is raised to p until it becomes one; otherwise,
+//      the primes are split into two halves with products N_L and N_R, and
+//      the orders of B^N_R and B^N_L are computed recursively.
+//
+template < class T >
+void
+ElementOrder<T>::reduce (ZZ &ord, const T &B, const T &one, const std::vector<ZZ> &p,
+                         const std::vector<long> &e, const long first, const long last)
+{
+  T C(B), D(B);
+  ZZ NL, NR, ordR;
+  long i, k, mid;
+
+  if (element_group<T>::equal(B, one)) {
+    ord = 1;
+    return;
+  }
+
+  if (last - first == 1) {
+    ord = p[first];
+    C = B;
+    for (k = 1; k < e[first]; ++k) {
+      power(D, C, p[first], one);
+      if (element_group<T>::equal(D, one))
+        return;
+      C = D;
+      mul(ord, ord, p[first]);
+    }
+    return;
+  }
+
+  mid = (first + last) / 2;
+  NL = 1;
+  for (i = first; i < mid; ++i)
+    mul(NL, NL, NTL::power(p[i], e[i]));
+  NR = 1;
+  for (i = mid; i < last; ++i)
+    mul(NR, NR, NTL::power(p[i], e[i]));
+
+  power(C, B, NR, one);
+  reduce(ord, C, one, p, e, first, mid);
+  power(D, B, NL, one);
+  reduce(ordR, D, one, p, e, mid, last);
+  mul(ord, ord, ordR);
+}
+
+
+//
+// compute the order of A from a multiple N (BSGS if N = 0)
+//
+template < class T >
+void
+ElementOrder<T>::order (ZZ &ord, const T &A, const ZZ &N)
+{
+  std::vector<ZZ> primes;
+
+  if (IsZero(N)) {
+    ZZ bound;
+    sqr(bound, to_ZZ(maxBabySteps));
+    if (!orderBSGS(ord, A, bound))
+      LogicError("ElementOrder: order exceeds the baby-step giant-step bound");
+    return;
+  }
+
+  factor(primes, N);
+  order(ord, A, N, primes);
+}
+
+
+//
+// compute the order of A from a multiple N with the given prime divisors
+//
+template < class T >
+void
+ElementOrder<T>::order (ZZ &ord, const T &A, const ZZ &N, const std::vector<ZZ> &primes)
+{
+  std::vector<ZZ> p;
+  std::vector<long> e;
+  ZZ M;
+  T one(A), C(A);
+  long k;
+
+  // exponents of the primes dividing N
+  abs(M, N);
+  if (IsZero(M))
+    LogicError("ElementOrder: zero multiple");
+  for (size_t i = 0; i < primes.size(); ++i) {
+    for (k = 0; divide(M, M, primes[i]); ++k);
+    if (k > 0) {
+      p.push_back(primes[i]);
+      e.push_back(k);
+    }
+  }
+  if (!IsOne(M))
+    LogicError("ElementOrder: incomplete factorization of the multiple");
+
+  element_group<T>::identity(one, A);
+  abs(M, N);
+  power(C, A, M, one);
+  if (!element_group<T>::equal(C, one))
+    LogicError("ElementOrder: N is not a multiple of the order");
+
+  if (p.empty())
+    ord = 1;
+  else
+    reduce(ord, A, one, p, e, 0, p.size());
+}
+
+
+//
+// ElementOrder<T>::orderBSGS()
+//
+// Task:
+//      baby-step giant-step search for the smallest n <= bound with A^n = 1.
+//      With m baby steps A^j (0 <= j < m) in a hash table, the i-th giant
+//      step A^(im) matches A^j for n = im - j, and the first match gives the
+//      order.
+//
+template < class T >
+bool
+ElementOrder<T>::orderBSGS (ZZ &ord, const T &A, const ZZ &bound)
+{
+  std::unordered_multimap<std::size_t, long> table;
+  std::vector<T> baby;
+  element_hash<T> hash;
+  T one(A), G(A), C(A);
+  ZZ root;
+  long m, j, i, giants;
+
+  if (bound < 1)
+    return false;
+
+  element_group<T>::identity(one, A);
+  if (element_group<T>::equal(A, one)) {
+    ord = 1;
+    return true;
+  }
+
+  SqrRoot(root, bound);
+  m = (root < maxBabySteps) ? to_long(root) + 1 : maxBabySteps;
+  if (NumBits((bound + m - 1) / m) >= NTL_BITS_PER_LONG - 1)
+    LogicError("ElementOrder: baby-step giant-step bound too large");
+  giants = to_long((bound + m - 1) / m);
+
+  baby.assign(m, one);
+  table.insert(std::make_pair(hash(one), 0L));
+  for (j = 1; j < m; ++j) {
+    element_group<T>::multiply(baby[j], baby[j-1], A);
+    if (element_group<T>::equal(baby[j], one)) {
+      ord = j;
+      return ord <= bound;
+    }
+    table.insert(std::make_pair(hash(baby[j]), j));
+  }
+
+  element_group<T>::multiply(G, baby[m-1], A);
+  C = G;
+  for (i = 1; i <= giants; ++i) {
+    auto range = table.equal_range(hash(C));
+    for (auto it = range.first; it != range.second; ++it)
+      if (element_group<T>::equal(baby[it->second], C)) {
+        mul(ord, to_ZZ(i), m);
+        sub(ord, ord, it->second);
+        return ord <= bound;
+      }
+    element_group<T>::multiply(C, C, G);
+  }
+
+  return false;
+}
+
+
+//
+// compute the exponent of the group generated by A from a multiple N (BSGS
+// if N = 0)
+//
+template < class T >
+void
+ElementOrder<T>::exponent (ZZ &e, const std::vector<T> &A, const ZZ &N)
+{
+  std::vector<ZZ> primes;
+
+  if (IsZero(N)) {
+    ZZ ord;
+
+    e = 1;
+    for (size_t i = 0; i < A.size(); ++i) {
+      T B(A[i]), one(A[i]);
+      element_group<T>::identity(one, A[i]);
+      power(B, A[i], e, one);
+      order(ord, B, N);
+      mul(e, e, ord);
+    }
+    return;
+  }
+
+  factor(primes, N);
+  exponent(e, A, N, primes);
+}
+
+
+//
+// compute the exponent of the group generated by A from a multiple N with
+// the given prime divisors:  lcm(e, ord(A[i])) = e ord(A[i]^e), and the
+// order of A[i]^e divides N/e
+//
+template < class T >
+void
+ElementOrder<T>::exponent (ZZ &e, const std::vector<T> &A, const ZZ &N, const std::vector<ZZ> &primes)
+{
+  ZZ M, ord;
+
+  e = 1;
+  for (size_t i = 0; i < A.size(); ++i) {
+    T B(A[i]), one(A[i]);
+    element_group<T>::identity(one, A[i]);
+    power(B, A[i], e, one);
+    abs(M, N);
+    div(M, M, e);
+    order(ord, B, M, primes);
+    mul(e, e, ord);
+  }
+}
@@ -0,0 +1,472 @@
+/**
+ * @file ExponentRecoding.cpp
+ * @brief exponent recodings (NAF, WNAF, SB3, signed greedy (2,3)
+ *        representation, double base strict chain) and their cache
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <ANTL/Exponentiation/ExponentRecoding.hpp>
+
+using namespace ANTL;
+
+//
+// constructors
+//
+
+ExponentRecoding::ExponentRecoding ()
+  : type(NAF), param(0), maxDigit(1), maxBaseThrees(0), negative(false)
+{
+}
+
+ExponentRecoding::ExponentRecoding (const ZZ & n, Type t, long inparam)
+{
+  recode(n, t, inparam);
+}
+
+
+
+//
+// ExponentRecoding::push()
+//
+// Task:
+//      appends the step (digit, twos, threes, basethrees).  Runs of more than
+//      65535 squarings or cubings are split into steps with digit 0.
+//
+
+void ExponentRecoding::push (long digit, long twos, long threes, long basethrees)
+{
+  Step s;
+
+  while (twos > 0xFFFF || threes > 0xFFFF) {
+    s.digit = 0;
+    s.twos = std::min(twos, 0xFFFFL);
+    s.threes = std::min(threes, 0xFFFFL);
+    s.basethrees = 0;
+    steps.push_back(s);
+    twos -= s.twos;
+    threes -= s.threes;
+  }
+
+  s.digit = digit;
+  s.twos = twos;
+  s.threes = threes;
+  s.basethrees = basethrees;
+  steps.push_back(s);
+
+  if (std::abs(digit) > maxDigit)
+    maxDigit = std::abs(digit);
+  if (basethrees > maxBaseThrees)
+    maxBaseThrees = basethrees;
+  if (digit < 0)
+    negative = true;
+}
+
+
+
+//
+// ExponentRecoding::recode()
+//
+// Task:
+//      recodes n.  The recodings are those of ExponentiationNAF,
+//      ExponentiationWNAF, ExponentiationSB3, ExponentiationDoubleBaseSignedGreedy
+//      and ExponentiationDoubleBaseStrictChain.
+//
+
+void ExponentRecoding::recode (const ZZ & n, Type t, long inparam)
+{
+  long i;
+
+  exponent = n;
+  type = t;
+  param = inparam;
+  steps.clear();
+  maxDigit = 1;
+  maxBaseThrees = 0;
+  negative = false;
+
+  if (IsZero(n))
+    return;
+
+  switch (t) {
+    case NAF:
+      param = 2;
+      recodeNAF(n, 2);
+      break;
+    case WNAF:
+      if (param <= 0)
+        param = 4;
+      if (param < 2 || param > 15)
+        LogicError("ExponentRecoding: window width out of range");
+      recodeNAF(n, param);
+      break;
+    case SB3:
+      recodeSB3(n);
+      break;
+    case DBNS:
+      if (param <= 0)
+        param = (NumBits(n) + 1) / 2;
+      recodeDBNS(n, param);
+      break;
+    case STRICT_CHAIN:
+      recodeStrictChain(n);
+      break;
+    default:
+      LogicError("ExponentRecoding: unknown recoding");
+  }
+
+  // n < 0:  A^n = (A^-1)^|n|
+  if (sign(n) < 0) {
+    negative = false;
+    for (i = 0; i < (long) steps.size(); ++i) {
+      steps[i].digit = -steps[i].digit;
+      if (steps[i].digit < 0)
+        negative = true;
+    }
+  }
+}
+
+
+
+//
+// ExponentRecoding::recodeNAF()
+//
+// Task:
+//      width-w NAF of |n| (w = 2 is the NAF), computed right-to-left and
+//      stored left-to-right
+//
+
+void ExponentRecoding::recodeNAF (const ZZ & n, long w)
+{
+  std::vector<short> e;
+  ZZ ex = abs(n);
+  long mask = 1L << w;
+  long j, prev;
+
+  e.reserve(NumBits(n) + 1);
+  while (ex > 0) {
+    if (IsOdd(ex)) {
+      long ei = rem(ex, mask);
+      if (ei > (mask >> 1))
+        ei -= mask;
+      e.push_back(ei);
+      sub(ex, ex, ei);
+    }
+    else
+      e.push_back(0);
+    RightShift(ex, ex, 1);
+  }
+
+  prev = e.size() - 1;
+  push(e[prev], 0, 0, 0);
+  for (j = prev - 1; j >= 0; --j) {
+    if (e[j] != 0) {
+      push(e[j], prev - j, 0, 0);
+      prev = j;
+    }
+  }
+  if (prev > 0)
+    push(0, prev, 0, 0);
+}
+
+
+
+//
+// ExponentRecoding::recodeSB3()
+//
+// Task:
+//      balanced ternary expansion of |n|
+//
+
+void ExponentRecoding::recodeSB3 (const ZZ & n)
+{
+  std::vector<short> e;
+  ZZ ex = abs(n);
+  long j, prev;
+
+  while (ex > 0) {
+    long ei = rem(ex, 3);
+    if (ei == 2)
+      ei = -1;
+    e.push_back(ei);
+    sub(ex, ex, ei);
+    div(ex, ex, 3);
+  }
+
+  prev = e.size() - 1;
+  push(e[prev], 0, 0, 0);
+  for (j = prev - 1; j >= 0; --j) {
+    if (e[j] != 0) {
+      push(e[j], 0, prev - j, 0);
+      prev = j;
+    }
+  }
+  if (prev > 0)
+    push(0, 0, prev, 0);
+}
+
+
+
+//
+// ExponentRecoding::recodeDBNS()
+//
+// Task:
+//      signed greedy (2,3) representation |n| = sum s_i 2^a_i 3^b_i with
+//      a_i <= NumBits(n) and b_i <= threeBound:  at each step, the term
+//      2^a 3^b closest to the remainder is chosen (from below or above).
+//      The terms are then applied in order of decreasing a_i.
+//
+
+struct DBNSTerm {
+  long sign;
+  long twos;
+  long threes;
+};
+
+static bool DBNSTermGreater (const DBNSTerm & x, const DBNSTerm & y)
+{
+  return x.twos > y.twos;
+}
+
+void ExponentRecoding::recodeDBNS (const ZZ & n, long threeBound)
+{
+  std::vector<ZZ> pow3;
+  std::vector<DBNSTerm> terms;
+  DBNSTerm term;
+  ZZ ex = abs(n), q, cand, diff, bestDiff, best;
+  long twoBound = NumBits(n);
+  long b, a, bestTwos = 0, bestThrees = 0, s = 1, prev;
+  size_t i;
+
+  pow3.resize(threeBound + 1);
+  set(pow3[0]);
+  for (b = 1; b <= threeBound; ++b)
+    mul(pow3[b], pow3[b-1], 3);
+
+  while (ex > 0) {
+    clear(best);
+    for (b = 0; b <= threeBound; ++b) {
+      const ZZ & t = pow3[b];
+
+      if (t <= ex) {
+        // t 2^a <= ex < t 2^(a+1)
+        div(q, ex, t);
+        a = NumBits(q) - 1;
+        if (a > twoBound)
+          a = twoBound;
+
+        LeftShift(cand, t, a);
+        sub(diff, ex, cand);
+        if (IsZero(best) || diff < bestDiff) {
+          best = cand;
+          bestDiff = diff;
+          bestTwos = a;
+          bestThrees = b;
+        }
+
+        if (a + 1 <= twoBound) {
+          LeftShift(cand, t, a + 1);
+          sub(diff, cand, ex);
+          if (diff < bestDiff) {
+            best = cand;
+            bestDiff = diff;
+            bestTwos = a + 1;
+            bestThrees = b;
+          }
+        }
+      }
+      else {
+        sub(diff, t, ex);
+        if (diff >= ex)
+          break;
+        if (IsZero(best) || diff < bestDiff) {
+          best = t;
+          bestDiff = diff;
+          bestTwos = 0;
+          bestThrees = b;
+        }
+      }
+    }
+
+    term.sign = s;
+    term.twos = bestTwos;
+    term.threes = bestThrees;
+    terms.push_back(term);
+
+    if (best > ex)
+      s = -s;
+    ex = bestDiff;
+  }
+
+  std::stable_sort(terms.begin(), terms.end(), DBNSTermGreater);
+
+  prev = terms[0].twos;
+  push(terms[0].sign, 0, 0, terms[0].threes);
+  for (i = 1; i < terms.size(); ++i) {
+    push(terms[i].sign, prev - terms[i].twos, 0, terms[i].threes);
+    prev = terms[i].twos;
+  }
+  if (prev > 0)
+    push(0, prev, 0, 0);
+}
+
+
+
+//
+// ExponentRecoding::recodeStrictChain()
+//
+// Task:
+//      double base strict chain |n| = 2^a_0 3^b_0 (s_0 + 2^a_1 3^b_1 (s_1 + ...)),
+//      computed as in ExponentiationDoubleBaseStrictChain
+//
+
+void ExponentRecoding::recodeStrictChain (const ZZ & n)
+{
+  std::vector<DBNSTerm> e;
+  DBNSTerm elem;
+  ZZ ex = abs(n);
+  long i;
+
+  while (ex > 0) {
+    elem.twos = elem.threes = 0;
+    while (rem(ex, 3) == 0) {
+      ++elem.threes;
+      div(ex, ex, 3);
+    }
+    while (IsEven(ex)) {
+      ++elem.twos;
+      RightShift(ex, ex, 1);
+    }
+    if (rem(ex, 6) == 5) {
+      elem.sign = -1;
+      add(ex, ex, 1);
+    }
+    else {
+      elem.sign = 1;
+      sub(ex, ex, 1);
+    }
+    e.push_back(elem);
+  }
+
+  // the leading element has sign 1 and initializes the result
+  i = e.size() - 1;
+  push(e[i].sign, 0, 0, 0);
+  for (; i > 0; --i)
+    push(e[i-1].sign, e[i].twos, e[i].threes, 0);
+  if (e[0].twos > 0 || e[0].threes > 0)
+    push(0, e[0].twos, e[0].threes, 0);
+}
+
+
+
+//
+// ExponentRecoding::squarings(), cubings(), multiplications()
+//
+// Task:
+//      returns the number of operations of power(), not counting the
+//      tables of powers of the base
+//
+
+long ExponentRecoding::squarings () const
+{
+  long total = 0;
+
+  for (size_t i = 0; i < steps.size(); ++i)
+    total += steps[i].twos;
+  return total;
+}
+
+long ExponentRecoding::cubings () const
+{
+  long total = 0;
+
+  for (size_t i = 0; i < steps.size(); ++i)
+    total += steps[i].threes;
+  return total;
+}
+
+long ExponentRecoding::multiplications () const
+{
+  long total = 0;
+
+  for (size_t i = 0; i < steps.size(); ++i)
+    if (steps[i].digit != 0)
+      ++total;
+  return (total > 0) ? total - 1 : 0;
+}
+
+
+
+//
+// ExponentRecoding::write(), read()
+//
+// Task:
+//      writes and reads the recoding as text:  the type, parameter,
+//      exponent and number of steps, followed by one step (d s t k) per line
+//
+
+void ExponentRecoding::write (std::ostream & out) const
+{
+  out << (int) type << " " << param << " " << exponent << " " << steps.size() << std::endl;
+  for (size_t i = 0; i < steps.size(); ++i)
+    out << steps[i].digit << " " << steps[i].twos << " " << steps[i].threes << " "
+        << steps[i].basethrees << std::endl;
+}
+
+void ExponentRecoding::read (std::istream & in)
+{
+  int t;
+  long len, i, d, s, u, k;
+
+  in >> t >> param >> exponent >> len;
+  if (!in || t < NAF || t > STRICT_CHAIN || len < 0)
+    LogicError("ExponentRecoding: bad header");
+
+  type = Type(t);
+  steps.clear();
+  steps.reserve(len);
+  maxDigit = 1;
+  maxBaseThrees = 0;
+  negative = false;
+
+  for (i = 0; i < len; ++i) {
+    in >> d >> s >> u >> k;
+    push(d, s, u, k);
+  }
+
+  if (!in)
+    LogicError("ExponentRecoding: truncated recoding");
+}
+
+
+
+//
+// ExponentRecodingCache::get()
+//
+// Task:
+//      returns the cached recoding of n, recoding it if necessary.  If the
+//      cache is full, it is cleared first.
+//
+
+const ExponentRecoding & ExponentRecodingCache::get (const ZZ & n, ExponentRecoding::Type t, long inparam)
+{
+  Key key;
+
+  key.n = n;
+  key.type = t;
+  key.param = inparam;
+
+  std::map<Key, ExponentRecoding, KeyLess>::iterator it = cache.find(key);
+  if (it != cache.end()) {
+    ++hits;
+    return it->second;
+  }
+
+  ++misses;
+  if ((long) cache.size() >= maxEntries)
+    cache.clear();
+
+  ExponentRecoding & R = cache[key];
+  R.recode(n, t, inparam);
+  return R;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file ExponentRecoding_impl.hpp
+ * @brief generic implementation of the templated replay of exponent recodings
+ */
+
+using namespace ANTL;
+
+//
+// ExponentRecoding::power()
+//
+// Task:
+//      computes C = A^n from the steps.  The odd powers A^d (d <= maxDigit)
+//      and the powers A^(3^k) (k <= maxBaseThrees) are computed first,
+//      together with their inverses if there are negative digits.
+//
+
+template <class T> void ExponentRecoding::power (T & C, const T & A) const
+{
+  std::vector<T> odd, oddInv, cubes, cubesInv;
+  long i, j;
+  bool started = false;
+
+  if (steps.empty())
+    LogicError("ExponentRecoding: zero exponent");
+
+  // odd[i] = A^(2i+1)
+  odd.resize((maxDigit + 1) / 2);
+  assign(odd[0], A);
+  if (odd.size() > 1) {
+    T A2;
+    sqr(A2, A);
+    for (i = 1; i < (long) odd.size(); ++i)
+      mul(odd[i], odd[i-1], A2);
+  }
+
+  // cubes[k] = A^(3^k)
+  cubes.resize(maxBaseThrees + 1);
+  assign(cubes[0], A);
+  for (i = 1; i <= maxBaseThrees; ++i)
+    cub(cubes[i], cubes[i-1]);
+
+  if (negative) {
+    oddInv.resize(odd.size());
+    for (i = 0; i < (long) odd.size(); ++i)
+      inv(oddInv[i], odd[i]);
+    if (maxBaseThrees > 0) {
+      cubesInv.resize(cubes.size());
+      for (i = 1; i <= maxBaseThrees; ++i)
+        inv(cubesInv[i], cubes[i]);
+    }
+  }
+
+  for (std::vector<Step>::const_iterator s = steps.begin(); s != steps.end(); ++s) {
+    if (started) {
+      for (j = 0; j < s->threes; ++j)
+        cub(C, C);
+      for (j = 0; j < s->twos; ++j)
+        sqr(C, C);
+    }
+
+    if (s->digit == 0)
+      continue;
+
+    const T & B = (s->basethrees > 0)
+      ? ((s->digit > 0) ? cubes[s->basethrees] : cubesInv[s->basethrees])
+      : ((s->digit > 0) ? odd[(s->digit - 1) / 2] : oddInv[(-s->digit - 1) / 2]);
+
+    if (started)
+      mul(C, C, B);
+    else {
+      assign(C, B);
+      started = true;
+    }
+  }
+}
@@ -0,0 +1,345 @@
+/**
+ * @file ExponentiationAuto_impl.hpp
+ * @brief generic implementation of templated methods from ExponentiationAuto class
+ */
+
+using namespace ANTL;
+
+//
+// set the costs of the group operations
+//
+template < class T >
+void
+ExponentiationAuto<T>::setCosts (double M, double S, double C, double I)
+{
+  costs.mul = M;
+  costs.sqr = S;
+  costs.cub = C;
+  costs.inv = I;
+}
+
+
+//
+// time the group operations for the sample element A
+//
+template < class T >
+void
+ExponentiationAuto<T>::calibrate (const T &A, double minTime)
+{
+  T A2, C;
+  double t, elapsed;
+  long reps, i, op;
+  double measured[4];
+
+  sqr(A2, A);
+
+  for (op = 0; op < 4; ++op) {
+    reps = 1;
+    while (true) {
+      t = GetTime();
+      for (i = 0; i < reps; ++i) {
+        switch (op) {
+          case 0: mul(C, A, A2); break;
+          case 1: sqr(C, A2); break;
+          case 2: cub(C, A); break;
+          default: inv(C, A2); break;
+        }
+      }
+      elapsed = GetTime() - t;
+      if (elapsed >= minTime || reps >= (1L << 30))
+        break;
+      reps <<= 1;
+    }
+    measured[op] = elapsed / reps;
+  }
+
+  setCosts(measured[0], measured[1], measured[2], measured[3]);
+}
+
+
+//
+// read and write the costs
+//
+template < class T >
+void
+ExponentiationAuto<T>::readCosts (std::istream &in)
+{
+  double M, S, C, I;
+
+  in >> M >> S >> C >> I;
+  if (!in)
+    LogicError("ExponentiationAuto: bad costs");
+
+  setCosts(M, S, C, I);
+}
+
+template < class T >
+void
+ExponentiationAuto<T>::writeCosts (std::ostream &out) const
+{
+  out << costs.mul << " " << costs.sqr << " " << costs.cub << " " << costs.inv << std::endl;
+}
+
+
+//
+// operation counts of the binary method
+//
+template < class T >
+void
+ExponentiationAuto<T>::countBinary (OperationCount &ops, const ZZ &n) const
+{
+  ops.sqr = NumBits(n) - 1;
+  ops.mul = weight(n) - 1;
+  ops.cub = 0;
+  ops.inv = 0;
+}
+
+
+//
+// operation counts of the NAF (w = 2) and WNAF methods, following the
+// recodings in ExponentiationNAF and ExponentiationWNAF
+//
+template < class T >
+void
+ExponentiationAuto<T>::countNAF (OperationCount &ops, const ZZ &n, short w) const
+{
+  ZZ ex = abs(n);
+  long len = 0, nonzero = 0, negative = 0;
+  long mask = (1L << w);
+
+  while (ex > 0) {
+    if (IsOdd(ex)) {
+      long ei = rem(ex, mask);
+      if (ei > (mask >> 1)) {
+        ei -= mask;
+        ++negative;
+      }
+      sub(ex, ex, ei);
+      ++nonzero;
+    }
+    RightShift(ex, ex, 1);
+    ++len;
+  }
+
+  // the leading digit initializes the result
+  ops.sqr = len - 1;
+  ops.mul = nonzero - 1;
+  ops.cub = 0;
+
+  if (w > 2) {
+    // precomputation of A^(2i+1), i < 2^(w-2)
+    ops.sqr += 1;
+    ops.mul += (1L << (w - 2)) - 1;
+  }
+
+  // inversion-free types conjugate once per negative digit, the others
+  // invert the table entries
+  if (is_inversion_free<T>::value)
+    ops.inv = negative;
+  else if (w == 2)
+    ops.inv = 1;
+  else
+    ops.inv = (1L << (w - 2));
+}
+
+
+//
+// operation counts of the SB3 method
+//
+template < class T >
+void
+ExponentiationAuto<T>::countSB3 (OperationCount &ops, const ZZ &n) const
+{
+  ZZ ex = abs(n);
+  long len = 0, nonzero = 0, negative = 0;
+
+  while (ex > 0) {
+    long ei = rem(ex, 3);
+    if (ei == 2) {
+      ei = -1;
+      ++negative;
+    }
+    if (ei != 0)
+      ++nonzero;
+    sub(ex, ex, ei);
+    div(ex, ex, 3);
+    ++len;
+  }
+
+  ops.cub = len - 1;
+  ops.mul = nonzero - 1;
+  ops.sqr = 0;
+  ops.inv = is_inversion_free<T>::value ? negative : 1;
+}
+
+
+//
+// operation counts of the double base strict chain method
+//
+template < class T >
+void
+ExponentiationAuto<T>::countStrictChain (OperationCount &ops, const ZZ &n) const
+{
+  ZZ ex = abs(n);
+  long elements = 0;
+
+  ops.sqr = ops.cub = 0;
+  while (ex > 0) {
+    while (rem(ex, 3) == 0) {
+      ++ops.cub;
+      div(ex, ex, 3);
+    }
+    while (IsEven(ex)) {
+      ++ops.sqr;
+      RightShift(ex, ex, 1);
+    }
+    if (rem(ex, 6) == 5)
+      add(ex, ex, 1);
+    else
+      sub(ex, ex, 1);
+    ++elements;
+  }
+
+  ops.mul = elements - 1;
+  ops.inv = 1;
+}
+
+
+//
+// operation counts of method m
+//
+template < class T >
+void
+ExponentiationAuto<T>::count (OperationCount &ops, Method m, const ZZ &n) const
+{
+  switch (m) {
+    case BINARY:       countBinary(ops, n); break;
+    case NAF:          countNAF(ops, n, 2); break;
+    case WNAF3:        countNAF(ops, n, 3); break;
+    case WNAF4:        countNAF(ops, n, 4); break;
+    case WNAF5:        countNAF(ops, n, 5); break;
+    case WNAF6:        countNAF(ops, n, 6); break;
+    case SB3:          countSB3(ops, n); break;
+    case STRICT_CHAIN: countStrictChain(ops, n); break;
+    default:
+      LogicError("ExponentiationAuto: unknown method");
+  }
+}
+
+
+//
+// predicted cost of method m
+//
+template < class T >
+double
+ExponentiationAuto<T>::predict (Method m, const ZZ &n) const
+{
+  OperationCount ops;
+
+  count(ops, m, n);
+  return ops.mul*costs.mul + ops.sqr*costs.sqr + ops.cub*costs.cub + ops.inv*costs.inv;
+}
+
+
+//
+// method with the smallest predicted cost
+//
+template < class T >
+typename ExponentiationAuto<T>::Method
+ExponentiationAuto<T>::choose (const ZZ &n, double *predicted) const
+{
+  Method best = BINARY;
+  double cost, bestCost = 0;
+  long m;
+
+  for (m = 0; m < NUM_METHODS; ++m) {
+    cost = predict(Method(m), n);
+    if (predicted != NULL)
+      predicted[m] = cost;
+    if (m == 0 || cost < bestCost) {
+      bestCost = cost;
+      best = Method(m);
+    }
+  }
+
+  return best;
+}
+
+
+//
+// compute A^n with the cheapest method
+//
+template < class T >
+void
+ExponentiationAuto<T>::power (T &C, const T &A, const ZZ &n)
+{
+  Decision d;
+
+  d.bits = NumBits(n);
+  d.method = choose(n, d.predicted);
+  if (tracing)
+    trace.push_back(d);
+
+  power(C, A, n, d.method);
+}
+
+
+//
+// compute A^n with method m
+//
+template < class T >
+void
+ExponentiationAuto<T>::power (T &C, const T &A, const ZZ &n, Method m)
+{
+  switch (m) {
+    case BINARY: {
+      ExponentiationBinary<T> E;
+      E.power(C, A, n);
+      break;
+    }
+    case NAF: {
+      ExponentiationNAF<T> E;
+      E.initialize(A, n);
+      E.power(C, A, n);
+      break;
+    }
+    case WNAF3:
+    case WNAF4:
+    case WNAF5:
+    case WNAF6: {
+      ExponentiationWNAF<T> E;
+      E.initialize(A, n, 3 + (m - WNAF3));
+      E.power(C, A, n);
+      break;
+    }
+    case SB3: {
+      ExponentiationSB3<T> E;
+      E.initialize(A, n);
+      E.power(C, A, n);
+      break;
+    }
+    case STRICT_CHAIN: {
+      ExponentiationDoubleBaseStrictChain<T> E;
+      E.initialize(A);
+      E.power(C, A, n);
+      break;
+    }
+    default:
+      LogicError("ExponentiationAuto: unknown method");
+  }
+}
+
+
+//
+// name of method m
+//
+template < class T >
+const char *
+ExponentiationAuto<T>::methodName (Method m)
+{
+  static const char * names[NUM_METHODS] = { "binary", "naf", "wnaf3", "wnaf4", "wnaf5", "wnaf6", "sb3", "strict-chain" };
+
+  if (m < 0 || m >= NUM_METHODS)
+    return "unknown";
+  return names[m];
+}
@@ -0,0 +1,150 @@
+/**
+ * @file ExponentiationBatch_impl.hpp
+ * @brief generic implementation of templated methods from ExponentiationBatch class
+ */
+
+using namespace ANTL;
+
+//
+// ExponentiationBatch<T>::powerRange()
+//
+// Task:
+//      computes C[i] = A[i]^n for first <= i < last, in blocks of blockSize
+//      bases.  For each block, tab[i*width + j] is A^(2j+1) for j < nodd and
+//      A^(3^(j-nodd+1)) otherwise, and every step of the recoding is applied
+//      to all the bases of the block before the next one.
+//
+template < class T >
+void
+ExponentiationBatch<T>::powerRange (vector<T> &C, const vector<T> &A, const long first, const long last) const
+{
+  const vector<ExponentRecoding::Step> &steps = recoding.getSteps();
+  long nodd = (recoding.getMaxDigit() + 1) / 2;
+  long ncub = recoding.getMaxBaseThrees();
+  long width = nodd + ncub;
+  bool invert = recoding.hasNegativeDigits() && !is_inversion_free<T>::value;
+  vector<T> tab, tabInv, prefix;
+  T A2, scratch;
+  long lo, len, i, j, x;
+  bool started;
+
+  for (lo = first; lo < last; lo += blockSize) {
+    len = (last - lo < blockSize) ? last - lo : blockSize;
+
+    tab.resize(len*width);
+    for (i = 0; i < len; ++i) {
+      T *t = &tab[i*width];
+      assign(t[0], A[lo+i]);
+      if (nodd > 1) {
+        sqr(A2, A[lo+i]);
+        for (j = 1; j < nodd; ++j)
+          mul(t[j], t[j-1], A2);
+      }
+      for (j = 0; j < ncub; ++j)
+        cub(t[nodd+j], (j == 0) ? A[lo+i] : t[nodd+j-1]);
+    }
+    if (invert)
+      batchinv(tabInv, tab, prefix);
+
+    started = false;
+    for (typename vector<ExponentRecoding::Step>::const_iterator s = steps.begin(); s != steps.end(); ++s) {
+      if (started)
+        for (i = 0; i < len; ++i) {
+          for (j = 0; j < s->threes; ++j)
+            cub(C[lo+i], C[lo+i]);
+          for (j = 0; j < s->twos; ++j)
+            sqr(C[lo+i], C[lo+i]);
+        }
+
+      if (s->digit == 0)
+        continue;
+
+      x = (s->basethrees > 0) ? nodd + s->basethrees - 1
+                              : (((s->digit > 0) ? s->digit : -s->digit) - 1) / 2;
+
+      for (i = 0; i < len; ++i) {
+        const T &B = tab[i*width + x];
+        if (s->digit > 0) {
+          if (started)
+            mul(C[lo+i], C[lo+i], B);
+          else
+            assign(C[lo+i], B);
+        }
+        else if (invert) {
+          if (started)
+            mul(C[lo+i], C[lo+i], tabInv[i*width + x]);
+          else
+            assign(C[lo+i], tabInv[i*width + x]);
+        }
+        else {
+          if (started)
+            mulinv(C[lo+i], C[lo+i], B, scratch);
+          else
+            inv(C[lo+i], B);
+        }
+      }
+      started = true;
+    }
+  }
+}
+
+
+//
+// compute C[i] = A[i]^n with the current recoding, the bases split over the
+// threads
+//
+template < class T >
+void
+ExponentiationBatch<T>::power (vector<T> &C, const vector<T> &A) const
+{
+  long n = A.size();
+  long nt = (threads < n) ? threads : n;
+
+  if (recoding.length() == 0)
+    LogicError("ExponentiationBatch: zero exponent");
+
+  C.resize(n);
+
+  if (nt <= 1) {
+    powerRange(C, A, 0, n);
+    return;
+  }
+
+  thread_context<T> context;
+  context.save();
+
+  vector<std::thread> workers;
+  for (long w = 0; w < nt; w++)
+    workers.push_back(std::thread([&, w] () {
+      context.restore();
+      powerRange(C, A, (n*w)/nt, (n*(w+1))/nt);
+    }));
+  for (long w = 0; w < nt; w++)
+    workers[w].join();
+}
+
+
+//
+// compute C[i] = A[i]^n, recoding n if it is not the current exponent
+//
+template < class T >
+void
+ExponentiationBatch<T>::power (vector<T> &C, const vector<T> &A, const ZZ &n)
+{
+  if (recoding.length() == 0 || recoding.getExponent() != n)
+    initialize(n);
+  power(C, A);
+}
+
+
+//
+// compute C = A^n, recoding n if it is not the current exponent
+//
+template < class T >
+void
+ExponentiationBatch<T>::power (T &C, const T &A, const ZZ &n)
+{
+  if (recoding.length() == 0 || recoding.getExponent() != n)
+    initialize(n);
+  recoding.power(C, A);
+}
@@ -17,6 +17,7 @@ ExponentiationDoubleBaseSignedGreedy<T>::initializeExponent(const ZZ &n)
 {
 
     initializedExponent = n;
+    representation.clear();
     //check if bounds have been explicitly set
     if(!boundsSet){
         powerOfThreeBound = ceil(0.5*NumBits(n));
@@ -66,7 +67,7 @@ ExponentiationDoubleBaseSignedGreedy<T>::initializeExponent(const ZZ &n)
       testElem.adjustedPower = ex << twoOffset;
 
         //use upper_bound to find the location in the set for ex
-      typename std::set<powerOfThreeElem>::iterator upper, lower;
+      typename std::set<powerOfThreeElem, comparePowers>::iterator upper, lower;
       upper = powersOfThree.upper_bound(testElem);
       lower = powersOfThree.upper_bound(testElem);
 
@@ -161,16 +162,14 @@ ExponentiationDoubleBaseSignedGreedy<T>::power (T &C, const T &A, const ZZ & n)
    if(n != initializedExponent){
         initializeExponent(n);
    }
-   if(cubes.empty()){
+   if((long) cubes.size() != powerOfThreeBound + 1){  //not yet, or not for the current bounds
         initializeBase(A);
    }else if(!equals(A, cubes[0])){
         initializeBase(A);
    }
 
 
-   typename std::set<repElement>::iterator twoIter = representation.end();
-
-   twoIter--;
+   typename std::set<repElement, comparePowersOfTwo>::reverse_iterator twoIter = representation.rbegin();
 
 
    long x = (*twoIter).powerOfTwo;
@@ -178,27 +177,27 @@ ExponentiationDoubleBaseSignedGreedy<T>::power (T &C, const T &A, const ZZ & n)
    if((*twoIter).sign == -1){
       inv(C,C);
    }
-   twoIter--;
+   ++twoIter;
    while(x > 0){
-     if(x == (*twoIter).powerOfTwo){
+     if(twoIter != representation.rend() && x == (*twoIter).powerOfTwo){
           if((*twoIter).sign == 1){
              mul(C,C,cubes[(*twoIter).powerOfThree]);
           }else{
              mul(C,C,inverseCubes[(*twoIter).powerOfThree]);
           }
-          --twoIter;
+          ++twoIter;
      }else{
           sqr(C,C);
           x--;
      }
    }
-   while(twoIter != representation.end()){
+   while(twoIter != representation.rend()){
       if((*twoIter).sign == 1){
              mul(C,C,cubes[(*twoIter).powerOfThree]);
           }else{
              mul(C,C,inverseCubes[(*twoIter).powerOfThree]);
           }
-      twoIter--;
+      ++twoIter;
    }
 
 }
@@ -19,6 +19,21 @@ ExponentiationDoubleBaseStrictChain<T>::initialize(const T &A)
 }
 
 
+//
+// set a precomputed chain
+//
+template < class T >
+void
+ExponentiationDoubleBaseStrictChain<T>::setChain(const ExponentRecoding &R)
+{
+  if (R.getType() != ExponentRecoding::STRICT_CHAIN)
+    LogicError("ExponentiationDoubleBaseStrictChain: not a strict chain");
+
+  chain = R;
+  useChain = true;
+}
+
+
 //
 // compute A^n using double base strict chain method
 //
@@ -26,6 +41,12 @@ template < class T >
 void 
 ExponentiationDoubleBaseStrictChain<T>::power (T &C, const T &A, const ZZ & n)
 {
+  // use the precomputed chain if it is for n
+  if (useChain && n == chain.getExponent()) {
+    chain.power(C, A);
+    return;
+  }
+
   // compute double base expansion of n (right-to-left)
   ZZ ex = abs (n);
   std::vector<chainElement> e;
@@ -62,7 +62,7 @@ ExponentiationDoubleBaseUnsignedGreedy<T>::power (T &C, const T &A, const ZZ & n
       testElem.adjustedPower = ex << twoOffset;
 
         //use upper_bound to find the location in the set for ex
-      typename std::set<powerOfThreeElem>::iterator upper;
+      typename std::set<powerOfThreeElem, comparePowers>::iterator upper;
       upper = powersOfThree.upper_bound(testElem);
 
       //use this to find the best approximation to ex
@@ -100,24 +100,23 @@ ExponentiationDoubleBaseUnsignedGreedy<T>::power (T &C, const T &A, const ZZ & n
         //From largest power of two down, multiply in the powers of three, squaring in between 
 
 
-   typename std::set<repElement>::iterator twoIter = representation.end();
-   twoIter--;
+   typename std::set<repElement, comparePowersOfTwo>::reverse_iterator twoIter = representation.rbegin();
 
    long x = (*twoIter).powerOfTwo;
    assign(C,cubes[(*twoIter).powerOfThree]);
-   twoIter--;
+   ++twoIter;
    while(x > 0){
-     if(x == (*twoIter).powerOfTwo){
+     if(twoIter != representation.rend() && x == (*twoIter).powerOfTwo){
           mul(C,C,cubes[(*twoIter).powerOfThree]);
-          --twoIter;
+          ++twoIter;
      }else{
           sqr(C,C);
           x--;
      }
    }
-   while(twoIter != representation.end()){
+   while(twoIter != representation.rend()){
       mul(C,C,cubes[(*twoIter).powerOfThree]);
-      twoIter--;
+      ++twoIter;
    }
 
 }
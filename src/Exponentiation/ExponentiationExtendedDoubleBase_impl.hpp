@@ -15,6 +15,7 @@ ExponentiationExtendedDoubleBase<T>::initializeExponent(const ZZ &n)
 {
 
     initializedExponent = n;
+    representation.clear();
     //check if bounds have been explicitly set
     if(!boundsSet){
         powerOfThreeBound = ceil(0.5*NumBits(n));
@@ -27,7 +28,7 @@ ExponentiationExtendedDoubleBase<T>::initializeExponent(const ZZ &n)
         ZZ adjustedPowerOfThree = ZZ(1);
         long currExponent = 0;
         powerOfThreeElem currElem;
-        long highestNumBits = ceil(1.585*powerOfThreeBound); // This should be the number of bits of 3^(threeBound).  
+        long highestNumBits = ceil(1.585*powerOfThreeBound) + NumBits(3*digitSetSize); // This should be the number of bits of the largest digit times 3^(threeBound).
     						 // Every element in powersOfThree will have this number of bits
         while(currExponent <= powerOfThreeBound){
            for(int i = 0; i < digitSetSize; i++){
@@ -51,7 +52,7 @@ ExponentiationExtendedDoubleBase<T>::initializeExponent(const ZZ &n)
     currRepElem.sign = 1;
     powerOfThreeElem testElem;
     long twoOffset;
-    long highestNumBits = ceil(1.585*powerOfThreeBound);
+    long highestNumBits = ceil(1.585*powerOfThreeBound) + NumBits(3*digitSetSize);
     bool foundFlag = false;
     long twosInUpperRep = 0;
     long threesInUpperRep = 0;
@@ -69,7 +70,7 @@ ExponentiationExtendedDoubleBase<T>::initializeExponent(const ZZ &n)
       testElem.adjustedPower = ex << twoOffset;
 
         //use upper_bound to find the location in the set for ex
-      typename std::set<powerOfThreeElem>::iterator upper, lower;
+      typename std::set<powerOfThreeElem, comparePowers>::iterator upper, lower;
       upper = powersOfThree.upper_bound(testElem);
       lower = powersOfThree.upper_bound(testElem);
 
@@ -204,16 +205,14 @@ ExponentiationExtendedDoubleBase<T>::power (T &C, const T &A, const ZZ & n)
    if(n != initializedExponent){
         initializeExponent(n);
    }
-   if(cubes.empty()){
+   if((long) cubes.size() != powerOfThreeBound + 1){  //not yet, or not for the current bounds
         initializeBase(A);
    }else if(!equals(A, cubes[0][0])){
         initializeBase(A);
    }
 
 
-   typename std::set<repElement>::iterator twoIter = representation.end();
-
-   twoIter--;
+   typename std::set<repElement, comparePowersOfTwo>::reverse_iterator twoIter = representation.rbegin();
 
 
    long x = (*twoIter).powerOfTwo;
@@ -221,27 +220,27 @@ ExponentiationExtendedDoubleBase<T>::power (T &C, const T &A, const ZZ & n)
    if((*twoIter).sign == -1){
       inv(C,C);
    }
-   twoIter--;
+   ++twoIter;
    while(x > 0){
-     if(x == (*twoIter).powerOfTwo){
+     if(twoIter != representation.rend() && x == (*twoIter).powerOfTwo){
           if((*twoIter).sign == 1){
              mul(C,C,cubes[(*twoIter).powerOfThree][(*twoIter).digitIndex]);
           }else{
              mul(C,C,inverseCubes[(*twoIter).powerOfThree][(*twoIter).digitIndex]);
           }
-          --twoIter;
+          ++twoIter;
      }else{
           sqr(C,C);
           x--;
      }
    }
-   while(twoIter != representation.end()){
+   while(twoIter != representation.rend()){
       if((*twoIter).sign == 1){
              mul(C,C,cubes[(*twoIter).powerOfThree][(*twoIter).digitIndex]);
           }else{
              mul(C,C,inverseCubes[(*twoIter).powerOfThree][(*twoIter).digitIndex]);
           }
-      twoIter--;
+      ++twoIter;
    }
 
 }
@@ -0,0 +1,225 @@
+/**
+ * @file ExponentiationFixedBase_impl.hpp
+ * @brief generic implementation of templated methods from ExponentiationFixedBase class
+ */
+
+using namespace ANTL;
+
+//
+// choose h and v with the smallest evaluation cost
+//
+template < class T >
+void
+ExponentiationFixedBase<T>::chooseParameters(long bits, long maxTable)
+{
+  double cost, best = -1;
+  long hh, vv, aa, bb;
+
+  if (maxTable < 1)
+    maxTable = 1;
+
+  h = v = 1;
+  for (hh = 1; hh <= 20 && (1L << hh) - 1 <= maxTable; ++hh) {
+    aa = (bits + hh - 1) / hh;
+    for (vv = 1; vv <= aa && vv*((1L << hh) - 1) <= maxTable; ++vv) {
+      bb = (aa + vv - 1) / vv;
+      // b - 1 squarings, and a multiplication for each nonzero column
+      cost = (bb - 1) + aa*(1.0 - 1.0/(1L << hh));
+      if (best < 0 || cost < best) {
+        best = cost;
+        h = hh;
+        v = vv;
+      }
+    }
+  }
+}
+
+
+//
+// build the tables:  G[s][2^i] = A^(2^(i*a + s*b)) from repeated squaring,
+// and G[s][u] = G[s][u - 2^i] G[s][2^i] for the highest bit 2^i of u
+//
+template < class T >
+void
+ExponentiationFixedBase<T>::precompute()
+{
+  long size = 1L << h;
+  long i, s, u, top, k;
+  T X;
+
+  a = (l + h - 1) / h;
+  b = (a + v - 1) / v;
+  v = (a + b - 1) / b;       // drop empty tables
+
+  G.clear();
+  G.resize(v*size);
+
+  // X runs through A^(2^k), k = 0, ..., (h-1)*a + (v-1)*b
+  assign(X, base);
+  k = 0;
+  for (i = 0; i < h; ++i)
+    for (s = 0; s < v; ++s) {
+      for (; k < i*a + s*b; ++k)
+        sqr(X, X);
+      assign(G[s*size + (1L << i)], X);
+    }
+
+  for (s = 0; s < v; ++s) {
+    top = 1;
+    for (u = 2; u < size; ++u) {
+      if ((u & (u - 1)) == 0) {
+        top = u;
+        continue;
+      }
+      mul(G[s*size + u], G[s*size + (u - top)], G[s*size + top]);
+    }
+  }
+}
+
+
+//
+// initialize the tables with given parameters
+//
+template < class T >
+void
+ExponentiationFixedBase<T>::initialize(const T &A, long bits, long rows, long numTables)
+{
+  if (bits < 1 || rows < 1 || rows > 20 || numTables < 1)
+    LogicError("ExponentiationFixedBase: bad parameters");
+
+  assign(base, A);
+  l = bits;
+  h = rows;
+  v = numTables;
+  if (v > (l + h - 1) / h)
+    v = (l + h - 1) / h;
+
+  precompute();
+}
+
+
+//
+// initialize the tables with at most maxTable elements
+//
+template < class T >
+void
+ExponentiationFixedBase<T>::initialize(const T &A, long bits, long maxTable)
+{
+  if (bits < 1)
+    LogicError("ExponentiationFixedBase: bad parameters");
+
+  assign(base, A);
+  l = bits;
+  chooseParameters(bits, maxTable);
+
+  precompute();
+}
+
+
+//
+// compute A^n using the comb tables
+//
+template < class T >
+void
+ExponentiationFixedBase<T>::power (T &C, const ZZ & n) const
+{
+  long size = 1L << h;
+  long i, j, k, s, u;
+  bool started = false;
+
+  if (sign(n) <= 0)
+    LogicError("ExponentiationFixedBase: exponent must be positive");
+  if (NumBits(n) > l)
+    LogicError("ExponentiationFixedBase: exponent too long");
+
+  for (k = b - 1; k >= 0; --k) {
+    if (started)
+      sqr(C, C);
+
+    for (s = v - 1; s >= 0; --s) {
+      j = s*b + k;
+      if (j >= a)
+        continue;
+
+      u = 0;
+      for (i = h - 1; i >= 0; --i)
+        u = (u << 1) | bit(n, i*a + j);
+
+      if (u != 0) {
+        if (started)
+          mul(C, C, G[s*size + u]);
+        else {
+          assign(C, G[s*size + u]);
+          started = true;
+        }
+      }
+    }
+  }
+}
+
+
+//
+// compute A^n, rebuilding the tables if necessary
+//
+template < class T >
+void
+ExponentiationFixedBase<T>::power (T &C, const T &A, const ZZ & n)
+{
+  if (sign(n) <= 0)
+    LogicError("ExponentiationFixedBase: exponent must be positive");
+
+  if (G.empty() || !equals(A, base) || NumBits(n) > l) {
+    if (G.empty())
+      initialize(A, NumBits(n));
+    else
+      initialize(A, std::max(l, NumBits(n)), h, v);
+  }
+
+  power(C, n);
+}
+
+
+//
+// write the parameters and tables
+//
+template < class T >
+void
+ExponentiationFixedBase<T>::write (std::ostream &out) const
+{
+  long size = 1L << h;
+  long s, u;
+
+  out << l << " " << h << " " << v << " " << b << std::endl;
+  out << base << std::endl;
+  for (s = 0; s < v; ++s)
+    for (u = 1; u < size; ++u)
+      out << G[s*size + u] << std::endl;
+}
+
+
+//
+// read the parameters and tables
+//
+template < class T >
+void
+ExponentiationFixedBase<T>::read (std::istream &in)
+{
+  long size, s, u;
+
+  in >> l >> h >> v >> b;
+  if (!in || l < 1 || h < 1 || h > 20 || v < 1 || b < 1)
+    LogicError("ExponentiationFixedBase: bad table header");
+
+  a = (l + h - 1) / h;
+  size = 1L << h;
+
+  in >> base;
+  G.clear();
+  G.resize(v*size);
+  for (s = 0; s < v; ++s)
+    for (u = 1; u < size; ++u)
+      in >> G[s*size + u];
+
+  if (!in)
+    LogicError("ExponentiationFixedBase: truncated table");
+}
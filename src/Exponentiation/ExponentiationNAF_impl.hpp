@@ -13,8 +13,9 @@ template < class T >
 void 
 ExponentiationNAF<T>::initialize(const T &A, const ZZ & n)
 {
-  // compute A^-1
-  inv(Ainv,A);
+  // compute A^-1 (unless it is computed on the fly)
+  if (!is_inversion_free<T>::value)
+    inv(Ainv,A);
 
   // initialize digit vector to size NumBits(n)+1
   e.reserve(NumBits(n)+1);
@@ -29,6 +30,7 @@ void
 ExponentiationNAF<T>::power (T &C, const T &A, const ZZ & n)
 {
   // compute NAF expansion of n (right-to-left)
+  e.clear();
   ZZ ex = abs (n);
   while (ex > 0)
     {
@@ -49,7 +51,11 @@ ExponentiationNAF<T>::power (T &C, const T &A, const ZZ & n)
       sqr(C, C);
       if (e.at(j) == 1)
 	mul(C, C, A);
-      else if (e.at(j) == -1)
-	mul(C,C,Ainv);
+      else if (e.at(j) == -1) {
+        if (is_inversion_free<T>::value)
+          mulinv(C,C,A,Ainv);
+        else
+	  mul(C,C,Ainv);
+      }
     }
 }
@@ -19,17 +19,23 @@ ExponentiationWNAF<T>::initialize(const T &A, const ZZ & n, const short width)
   //create precomputed array, precomp[i] corresponds to A^{2i+1}
   int len = 1 << (w - 2);
 
-  precomp = new T[len];
-  precompInv = new T[len];
+  precomp.resize(len);
 
   T square;
   sqr(square, A);
   assign(precomp[0], A);
-  inv(precompInv[0],precomp[0]);
 
   for(int i = 1; i < len; i++){
     mul(precomp[i],precomp[i-1],square);
-    inv(precompInv[i],precomp[i]);
+  }
+
+  // inverses of the precomputed values (unless computed on the fly)
+  if (is_inversion_free<T>::value)
+    precompInv.clear();
+  else {
+    precompInv.resize(len);
+    for(int i = 0; i < len; i++)
+      inv(precompInv[i],precomp[i]);
   }
 
 
@@ -46,6 +52,7 @@ void
 ExponentiationWNAF<T>::power (T &C, const T &A, const ZZ & n)
 {
   // compute NAF expansion of n (right-to-left)
+  e.clear();
   ZZ ex = abs (n);
   while (ex > 0)
     {
@@ -62,6 +69,7 @@ ExponentiationWNAF<T>::power (T &C, const T &A, const ZZ & n)
     }
 
   register int x;
+  T inverse;
   // compute C = A^n from left-to-right using NAF digits in e
   x = (e.at(e.size() - 1) - 1)/2;
   assign(C,precomp[x]);
@@ -74,7 +82,10 @@ ExponentiationWNAF<T>::power (T &C, const T &A, const ZZ & n)
       }
       else if (e.at(j) < 0){
         x = ((-1)*e.at(j) - 1)/2;
-	mul(C,C,precompInv[x]);
+        if (is_inversion_free<T>::value)
+          mulinv(C,C,precomp[x],inverse);
+        else
+	  mul(C,C,precompInv[x]);
       }
     }
 }	
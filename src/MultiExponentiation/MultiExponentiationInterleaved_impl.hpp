@@ -0,0 +1,235 @@
+/**
+ * @file MultiExponentiationInterleaved_impl.hpp
+ * @brief generic implementation of templated methods from MultiExponentiationInterleaved class
+ */
+
+using namespace ANTL;
+
+//
+// MultiExponentiationInterleaved<T>::chooseWidth()
+//
+// Task:
+//      minimizes the cost of the table (2^(w-2) entries, each costing a
+//      multiplication, plus three more for its inverse unless T is inversion
+//      free) plus the expected number bits/(w+1) of nonzero digits
+//
+template < class T >
+short
+MultiExponentiationInterleaved<T>::chooseWidth(const long bits)
+{
+  double entryCost = is_inversion_free<T>::value ? 1.0 : 4.0;
+  double cost, best = 0;
+  short width, bestWidth = 2;
+
+  for (width = 2; width <= 8; ++width) {
+    cost = entryCost*(1L << (width - 2)) + double(bits)/(width + 1);
+    if (width == 2 || cost < best) {
+      best = cost;
+      bestWidth = width;
+    }
+  }
+  return bestWidth;
+}
+
+
+//
+// initialize tables for exponents of the given bit lengths
+//
+template < class T >
+void
+MultiExponentiationInterleaved<T>::initialize(const vector<T> &A, const vector<long> &bits)
+{
+  vector<short> inw(A.size());
+
+  if (bits.size() != A.size())
+    LogicError("MultiExponentiationInterleaved: number of bases and exponents differ");
+
+  for (size_t i = 0; i < A.size(); ++i)
+    inw[i] = chooseWidth(bits[i]);
+  initializeWidths(A, inw);
+}
+
+
+//
+// initialize tables with the given window widths
+//
+template < class T >
+void
+MultiExponentiationInterleaved<T>::initializeWidths(const vector<T> &A, const vector<short> &inw)
+{
+  size_t k = A.size(), i, j, total = 0;
+
+  if (inw.size() != k)
+    LogicError("MultiExponentiationInterleaved: number of bases and widths differ");
+
+  w = inw;
+  precomp.resize(k);
+  e.resize(k);
+
+  // precomp[i][j] = A[i]^(2j+1)
+  for (i = 0; i < k; ++i) {
+    if (w[i] < 2 || w[i] > 15)
+      LogicError("MultiExponentiationInterleaved: window width out of range");
+
+    size_t len = 1L << (w[i] - 2);
+    precomp[i].resize(len);
+    assign(precomp[i][0], A[i]);
+    if (len > 1) {
+      T square;
+      sqr(square, A[i]);
+      for (j = 1; j < len; ++j)
+        mul(precomp[i][j], precomp[i][j-1], square);
+    }
+    total += len;
+  }
+
+  if (is_inversion_free<T>::value || total == 0) {
+    precompInv.clear();
+    return;
+  }
+
+  // inverses of all entries with one inversion
+  vector<T> flat, flatInv, prefix;
+  size_t t = 0;
+
+  flat.resize(total);
+  for (i = 0; i < k; ++i)
+    for (j = 0; j < precomp[i].size(); ++j, ++t)
+      assign(flat[t], precomp[i][j]);
+
+  batchinv(flatInv, flat, prefix);
+
+  precompInv.resize(k);
+  for (i = 0, t = 0; i < k; ++i) {
+    precompInv[i].resize(precomp[i].size());
+    for (j = 0; j < precomp[i].size(); ++j, ++t)
+      assign(precompInv[i][j], flatInv[t]);
+  }
+}
+
+
+//
+// width-w NAF of n (least significant digit first), negated if n < 0
+//
+template < class T >
+void
+MultiExponentiationInterleaved<T>::recode(vector<short> &digits, const ZZ &n, const short width)
+{
+  ZZ ex = abs(n);
+  long mask = 1L << width;
+  short ei;
+
+  digits.clear();
+  while (ex > 0)
+    {
+      if (IsOdd(ex)) {
+        ei = (short) rem(ex, mask);
+        if (ei > (mask >> 1))
+          ei = ei - mask;
+        digits.push_back(ei);
+        sub(ex, ex, ei);
+      }
+      else
+        digits.push_back(0);
+      RightShift(ex, ex, 1);
+    }
+
+  if (sign(n) < 0)
+    for (size_t j = 0; j < digits.size(); ++j)
+      digits[j] = -digits[j];
+}
+
+
+//
+// compute C = prod A[i]^n[i] with the current tables
+//
+template < class T >
+void
+MultiExponentiationInterleaved<T>::power(T &C, const vector<ZZ> &n)
+{
+  size_t k = precomp.size(), i;
+  long len = 0, j, x;
+  short d;
+  bool started = false;
+
+  if (n.size() != k)
+    LogicError("MultiExponentiationInterleaved: number of bases and exponents differ");
+
+  for (i = 0; i < k; ++i) {
+    recode(e[i], n[i], w[i]);
+    if ((long) e[i].size() > len)
+      len = e[i].size();
+  }
+  if (len == 0)
+    LogicError("MultiExponentiationInterleaved: all exponents are zero");
+
+  // one squaring per digit position, shared by all bases
+  for (j = len - 1; j >= 0; --j) {
+    if (started)
+      sqr(C, C);
+
+    for (i = 0; i < k; ++i) {
+      if (j >= (long) e[i].size() || (d = e[i][j]) == 0)
+        continue;
+
+      x = ((d > 0) ? d - 1 : -d - 1) / 2;
+      if (!started) {
+        if (d > 0)
+          assign(C, precomp[i][x]);
+        else if (is_inversion_free<T>::value)
+          inv(C, precomp[i][x]);
+        else
+          assign(C, precompInv[i][x]);
+        started = true;
+      }
+      else if (d > 0)
+        mul(C, C, precomp[i][x]);
+      else if (is_inversion_free<T>::value)
+        mulinv(C, C, precomp[i][x], scratch);
+      else
+        mul(C, C, precompInv[i][x]);
+    }
+  }
+}
+
+
+//
+// compute C = prod A[i]^n[i], with tables chosen for the lengths of n
+//
+template < class T >
+void
+MultiExponentiationInterleaved<T>::power(T &C, const vector<T> &A, const vector<ZZ> &n)
+{
+  vector<long> bits(n.size());
+
+  for (size_t i = 0; i < n.size(); ++i)
+    bits[i] = NumBits(n[i]);
+  initialize(A, bits);
+  power(C, n);
+}
+
+
+//
+// compute C[j] = prod A[i]^n[j][i], with tables chosen for the longest
+// exponent of each base
+//
+template < class T >
+void
+MultiExponentiationInterleaved<T>::power(vector<T> &C, const vector<T> &A, const vector<vector<ZZ> > &n)
+{
+  vector<long> bits(A.size(), 0);
+  size_t i, j;
+
+  for (j = 0; j < n.size(); ++j) {
+    if (n[j].size() != A.size())
+      LogicError("MultiExponentiationInterleaved: number of bases and exponents differ");
+    for (i = 0; i < A.size(); ++i)
+      if (NumBits(n[j][i]) > bits[i])
+        bits[i] = NumBits(n[j][i]);
+  }
+
+  initialize(A, bits);
+  C.resize(n.size());
+  for (j = 0; j < n.size(); ++j)
+    power(C[j], n[j]);
+}
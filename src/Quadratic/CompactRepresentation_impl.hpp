@@ -0,0 +1,375 @@
+/**
+ * @file CompactRepresentation_impl.hpp
+ * @remarks compact representations of elements of real quadratic orders.
+ */
+
+//
+// constructor and destructor
+//
+
+template <class T> CompactRepresentation<T>::CompactRepresentation (QuadraticOrder<T> & inQO)
+{
+  QO = &inQO;
+  conv(Delta, QO->getDiscriminant());
+}
+
+template <class T> CompactRepresentation<T>::~CompactRepresentation () {}
+
+
+
+//
+// CompactRepresentation<T>::assign_one(), append()
+//
+// Task:
+//      sets the element to 1, resp. multiplies it by
+//      ((x + y sqrt(Delta))/z)^(2^e)
+//
+
+template <class T> void CompactRepresentation<T>::assign_one ()
+{
+  factors.clear();
+}
+
+template <class T> void CompactRepresentation<T>::append (const ZZ & x, const ZZ & y, const ZZ & z, long e)
+{
+  Factor f;
+  f.x = x;
+  f.y = y;
+  f.z = z;
+  f.e = e;
+  factors.push_back(f);
+}
+
+
+
+//
+// CompactRepresentation<T>::size_in_bits()
+//
+// Task:
+//      returns the number of bits needed to store the factors
+//
+
+template <class T> long CompactRepresentation<T>::size_in_bits () const
+{
+  long bits = 0;
+
+  for (long i = 0; i < (long) factors.size(); ++i)
+    bits += NumBits(factors[i].x) + NumBits(factors[i].y) + NumBits(factors[i].z) + NumBits(factors[i].e);
+
+  return bits;
+}
+
+
+
+//
+// CompactRepresentation<T>::sign_of()
+//
+// Task:
+//      returns the sign of x + y sqrt(D)
+//
+
+template <class T> long CompactRepresentation<T>::sign_of (const ZZ & x, const ZZ & y, const ZZ & D)
+{
+  ZZ x2, y2;
+
+  if (NTL::sign(x) == NTL::sign(y) || IsZero(y))
+    return NTL::sign(x);
+  if (IsZero(x))
+    return NTL::sign(y);
+
+  // opposite signs:  compare x^2 and y^2 D
+  sqr(x2, x);
+  sqr(y2, y);
+  mul(y2, y2, D);
+
+  return (x2 > y2) ? NTL::sign(x) : NTL::sign(y);
+}
+
+
+
+//
+// CompactRepresentation<T>::sign()
+//
+// Task:
+//      returns the sign of the element.  Factors with e > 0 are squares,
+//      so only the factors with e = 0 contribute.
+//
+
+template <class T> long CompactRepresentation<T>::sign () const
+{
+  long s = 1;
+
+  for (long i = 0; i < (long) factors.size(); ++i)
+    if (factors[i].e == 0)
+      s *= sign_of(factors[i].x, factors[i].y, Delta) * NTL::sign(factors[i].z);
+
+  return s;
+}
+
+
+
+//
+// CompactRepresentation<T>::norm()
+//
+// Task:
+//      returns the sign of the norm of the element, which is the norm if
+//      the element is a unit.  As for sign(), only the factors with e = 0
+//      contribute.
+//
+
+template <class T> long CompactRepresentation<T>::norm () const
+{
+  ZZ x2, y2;
+  long s = 1;
+
+  for (long i = 0; i < (long) factors.size(); ++i)
+    if (factors[i].e == 0) {
+      sqr(x2, factors[i].x);
+      sqr(y2, factors[i].y);
+      mul(y2, y2, Delta);
+      s *= compare(x2, y2);
+    }
+
+  return s;
+}
+
+
+
+//
+// CompactRepresentation<T>::eval_mod()
+//
+// Task:
+//      computes u, v such that the element is congruent to u + v sqrt(Delta)
+//      in (Z/pZ)[sqrt(Delta)] (p odd).  Each factor needs e squarings.
+//      Returns false if p divides one of the denominators.
+//
+
+template <class T> bool CompactRepresentation<T>::eval_mod (ZZ & u, ZZ & v, const ZZ & p) const
+{
+  ZZ zi, fx, fy, t1, t2, Dp;
+
+  rem(Dp, Delta, p);
+  set(u);
+  clear(v);
+
+  for (long i = 0; i < (long) factors.size(); ++i) {
+    rem(zi, factors[i].z, p);
+    if (IsZero(zi))
+      return false;
+    InvMod(zi, zi, p);
+
+    MulMod(fx, factors[i].x % p, zi, p);
+    MulMod(fy, factors[i].y % p, zi, p);
+
+    for (long j = 0; j < factors[i].e; ++j) {
+      // (fx + fy sqrt(D))^2 = fx^2 + fy^2 D + 2 fx fy sqrt(D)
+      SqrMod(t1, fx, p);
+      SqrMod(t2, fy, p);
+      MulMod(t2, t2, Dp, p);
+      MulMod(fy, fx, fy, p);
+      AddMod(fy, fy, fy, p);
+      AddMod(fx, t1, t2, p);
+    }
+
+    // (u + v sqrt(D)) (fx + fy sqrt(D))
+    MulMod(t1, u, fx, p);
+    MulMod(t2, v, fy, p);
+    MulMod(t2, t2, Dp, p);
+    AddMod(t1, t1, t2, p);
+
+    MulMod(t2, u, fy, p);
+    MulMod(v, v, fx, p);
+    AddMod(v, v, t2, p);
+    u = t1;
+  }
+
+  return true;
+}
+
+
+
+//
+// CompactRepresentation<T>::log()
+//
+// Task:
+//      computes log|gamma| = sum 2^e_i log|(x_i + y_i sqrt(Delta))/z_i|.  If
+//      x_i and y_i have opposite signs, the conjugate is used to avoid
+//      cancellation.
+//
+
+template <class T> void CompactRepresentation<T>::log (RR & l) const
+{
+  RR t, rD;
+  ZZ n;
+
+  SqrRoot(rD, to_RR(Delta));
+  clear(l);
+
+  for (long i = 0; i < (long) factors.size(); ++i) {
+    const Factor & f = factors[i];
+
+    if (NTL::sign(f.x) * NTL::sign(f.y) >= 0)
+      t = NTL::log(abs(to_RR(f.x) + to_RR(f.y)*rD));
+    else {
+      // |x + y sqrt(D)| = |x^2 - y^2 D| / |x - y sqrt(D)|
+      n = f.x*f.x - f.y*f.y*Delta;
+      t = NTL::log(abs(to_RR(n))) - NTL::log(abs(to_RR(f.x) - to_RR(f.y)*rD));
+    }
+    t -= NTL::log(abs(to_RR(f.z)));
+
+    l += t * power2_RR(f.e);
+  }
+}
+
+
+
+//
+// mul(C, A, B), inv(C, A)
+//
+// Task:
+//      C = A*B (the factors are concatenated), C = 1/A
+//      (1/((x + y sqrt(D))/z) = z (x - y sqrt(D))/(x^2 - y^2 D))
+//
+
+template <class T> void ANTL::mul (CompactRepresentation<T> &C, const CompactRepresentation<T> &A, const CompactRepresentation<T> &B)
+{
+  std::vector<typename CompactRepresentation<T>::Factor> fac(A.factors);
+  fac.insert(fac.end(), B.factors.begin(), B.factors.end());
+
+  C.QO = A.QO;
+  C.Delta = A.Delta;
+  C.factors.swap(fac);
+}
+
+template <class T> void ANTL::inv (CompactRepresentation<T> &C, const CompactRepresentation<T> &A)
+{
+  ZZ n, g;
+
+  C.QO = A.QO;
+  C.Delta = A.Delta;
+  if (&C != &A)
+    C.factors = A.factors;
+
+  for (long i = 0; i < (long) C.factors.size(); ++i) {
+    typename CompactRepresentation<T>::Factor & f = C.factors[i];
+
+    n = f.x*f.x - f.y*f.y*A.Delta;
+    f.x *= f.z;
+    f.y *= -f.z;
+    f.z = n;
+
+    GCD(g, f.x, f.y);
+    GCD(g, g, f.z);
+    if (NTL::sign(f.z) < 0)
+      NTL::negate(g, g);
+    div(f.x, f.x, g);
+    div(f.y, f.y, g);
+    div(f.z, f.z, g);
+  }
+}
+
+
+
+//
+// operator <<
+//
+
+template <class T> std::ostream & ANTL::operator << (std::ostream & out, const CompactRepresentation<T> &A)
+{
+  out << "[";
+  for (long i = 0; i < (long) A.factors.size(); ++i) {
+    if (i > 0)
+      out << " * ";
+    out << "((" << A.factors[i].x << " + " << A.factors[i].y << " sqrt(" << A.Delta << "))/"
+        << A.factors[i].z << ")^(2^" << A.factors[i].e << ")";
+  }
+  out << "]";
+  return out;
+}
+
+
+
+//
+// compact_representation(E, eps)
+//
+// Task:
+//      computes a compact representation of the element with (f,p)
+//      approximation eps (eps must be the order itself with theta ~ epsilon,
+//      e.g., the fundamental unit from RegulatorBSGS<T>).
+//
+//      With l such that theta^(2^-l) < 2, the target distances
+//      t_j = theta^(2^(j-l)) are obtained by fixed-point square roots.
+//      Starting with b_0 = O, b_j is obtained by squaring b_{j-1} and moving
+//      to the reduced ideal closest to the left of t_j; the exact relative
+//      generator gamma_j of this step (b_j = gamma_j b_{j-1}^2) is recorded.
+//      Finally b_l is moved to O, and
+//          epsilon = prod_j gamma_j^(2^(l-j)).
+//      If O is not within two baby steps of b_l, the distance of eps is not
+//      that of O (or not precise enough), and an error is raised.
+//
+
+template <class T> void ANTL::compact_representation (CompactRepresentation<T> &E, const FPRepresentation<T> &eps)
+{
+  long p = eps.get_precision();
+  long l, j, i;
+  ZZ x, y, z, xn, yn, zn, m;
+
+  // targets t_j = (td[j], tk[j])
+  l = NumBits(eps.get_k() + 1) + 1;
+  std::vector<ZZ> td(l + 1);
+  std::vector<long> tk(l + 1);
+
+  td[l] = eps.get_d();
+  tk[l] = eps.get_k();
+  for (j = l; j > 0; --j) {
+    LeftShift(m, td[j], p);
+    tk[j-1] = tk[j];
+    if (tk[j-1] & 1) {
+      LeftShift(m, m, 1);
+      --tk[j-1];
+    }
+    SqrRoot(td[j-1], m);
+    tk[j-1] /= 2;
+  }
+
+  FPRepresentation<T> B(*eps.get_QO(), p), N(*eps.get_QO(), p);
+  E.assign_one();
+
+  for (j = 1; j <= l; ++j) {
+    sqr(B, x, y, z, B);
+
+    while (B.compare_distance(td[j], tk[j]) > 0)
+      B.rho_inverse(x, y, z);
+
+    while (true) {
+      N = B;
+      xn = x; yn = y; zn = z;
+      N.rho(xn, yn, zn);
+      if (N.compare_distance(td[j], tk[j]) > 0)
+        break;
+      B = N;
+      x = xn; y = yn; z = zn;
+    }
+
+    if (j == l && !B.IsOne()) {
+      // t_l is only an approximation of the distance of O
+      N = B;
+      xn = x; yn = y; zn = z;
+      for (i = 0; i < 2 && !N.IsOne(); ++i)
+        N.rho(xn, yn, zn);
+
+      if (N.IsOne()) {
+        x = xn; y = yn; z = zn;
+      }
+      else {
+        for (i = 0; i < 2 && !B.IsOne(); ++i)
+          B.rho_inverse(x, y, z);
+      }
+
+      if (!B.IsOne())
+        LogicError("compact_representation: eps is not at the distance of the order");
+    }
+
+    E.append(x, y, z, l - j);
+  }
+}
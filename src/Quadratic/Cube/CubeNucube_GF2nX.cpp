@@ -0,0 +1,10 @@
+/**
+ * @file CubeNucube_GF2nX.cpp
+ * @remark Specialization of the CubeNucube class for GF2nX.
+ */
+
+#include <ANTL/Quadratic/Cube/CubeNucube.hpp>
+
+template <> void CubeNucube<GF2nX>::cube(QuadraticIdealBase<GF2nX> & C, const QuadraticIdealBase<GF2nX> & A) {
+  cube_char2(C,A);
+}
@@ -15,9 +15,9 @@ template <> void CubeNucube<ZZ>::init(const ZZ & delta_in, const ZZ & h_in, long
 
 
 template <> void CubeNucube<ZZ>::cube(QuadraticIdealBase<ZZ> &C, const QuadraticIdealBase<ZZ> &A) {
-  static ZZ a, b, c, Ca, Cb, Cc;
-  static ZZ SP, S, v1, u2, v2, N, K, L, T, temp, temp2;
-  static ZZ B, R1, R2, C1, C2, BB, M1, M2;
+  static thread_local ZZ a, b, c, Ca, Cb, Cc;
+  static thread_local ZZ SP, S, v1, u2, v2, N, K, L, T, temp, temp2;
+  static thread_local ZZ B, R1, R2, C1, C2, BB, M1, M2;
 
   a = A.get_a();
   b = A.get_b();
@@ -1,7 +1,8 @@
 /**
  * @file qo_nucube_long.cpp
  * @author Michael Jacobson
- * @remark Specialization of the qo_nucube class for long.
+ * @remark Specialization of the qo_nucube class for long.  The products are
+ * of size about |Delta|^(3/2), so |Delta| must be less than 2^42.
   */
 
 #include <ANTL/Quadratic/Cube/CubeNucube.hpp>
@@ -15,9 +16,9 @@ template <> void CubeNucube<long>::init(const long & delta_in, const long & h_in
 
 
 template <> void CubeNucube<long>::cube(QuadraticIdealBase<long> &C, const QuadraticIdealBase<long> &A) {
-  static long a, b, c, Ca, Cb, Cc;
-  static long SP, S, v1, u2, v2, N, K, L, T, temp, temp2;
-  static long B, R1, R2, C1, C2, BB, M1, M2;
+  static thread_local long a, b, c, Ca, Cb, Cc;
+  static thread_local long SP, S, v1, u2, v2, N, K, L, T, temp, temp2;
+  static thread_local long B, R1, R2, C1, C2, BB, M1, M2;
 
   a = A.get_a();
   b = A.get_b();
@@ -33,13 +34,21 @@ template <> void CubeNucube<long>::cube(QuadraticIdealBase<long> &C, const Quadr
     // L = a^2
     L = a*a;
 
-    // K = c v1 (v1(b - a c v1) - 2) mod L
+    // K = c v1 (v1(b - a c v1) - 2) mod L, with 0 <= K < L (as for ZZ:
+    // the partial reduction needs a nonnegative K, and the products need
+    // MulMod to avoid overflow)
     v1 %= L;
-    temp = (v1*c) % L;
+    if (v1 < 0) v1 += L;
+    temp = MulMod(v1, c % L, L);
 
-    K = (temp*a) % L;
-    K = ((b - K)*v1) % L;
-    K = ((K - 2)*temp) % L;
+    temp2 = b % L;
+    if (temp2 < 0) temp2 += L;
+
+    K = MulMod(temp, a % L, L);
+    K = SubMod(temp2, K, L);
+    K = MulMod(K, v1, L);
+    K = SubMod(K, 2 % L, L);
+    K = MulMod(K, temp, L);
   }
   else {
     // S = u2 (a SP) + v2 (b^2 - ac)
@@ -57,14 +66,22 @@ template <> void CubeNucube<long>::cube(QuadraticIdealBase<long> &C, const Quadr
     // L = N a
     L = N*a;
 
-    // K = -c(v1 u2 a + v2 b) mod L
+    // K = -c(v1 u2 a + v2 b) mod L, with 0 <= K < L
+    v1 %= L;
+    if (v1 < 0) v1 += L;
+    u2 %= L;
+    if (u2 < 0) u2 += L;
     v2 %= L;
-    K = (v1*u2) % L;
-    K = (K*a) % L;
-    temp = (v2*b) % L;
-    K = K + temp;
-    K = (K*c) % L;
-    K = L - K;
+    if (v2 < 0) v2 += L;
+    temp2 = b % L;
+    if (temp2 < 0) temp2 += L;
+
+    K = MulMod(v1, u2, L);
+    K = MulMod(K, a % L, L);
+    temp = MulMod(v2, temp2, L);
+    K = AddMod(K, temp, L);
+    K = MulMod(K, c % L, L);
+    K = SubMod(0, K, L);
 
     // C = Sc
     c *= S;
@@ -7,8 +7,8 @@
 #include <ANTL/Quadratic/Cube/CubePlain.hpp>
 
 template <> void CubePlain<ZZ>::cube (QuadraticIdealBase<ZZ> &C, const QuadraticIdealBase<ZZ> &A) {
-  static ZZ a, b, c, Ca, Cb, Cc;
-  static ZZ SP, S, v1, u2, v2, N, K, L, T, temp;
+  static thread_local ZZ a, b, c, Ca, Cb, Cc;
+  static thread_local ZZ SP, S, v1, u2, v2, N, K, L, T, temp;
 
   a = A.get_a();
   b = A.get_b();
@@ -7,8 +7,8 @@
 #include <ANTL/Quadratic/Cube/CubePlain.hpp>
 
 template <> void CubePlain<long>::cube (QuadraticIdealBase<long> &C, const QuadraticIdealBase<long> &A) {
-  static long a, b, c, Ca, Cb, Cc;
-  static long SP, S, v1, u2, v2, N, K, L, T, temp;
+  static thread_local long a, b, c, Ca, Cb, Cc;
+  static thread_local long SP, S, v1, u2, v2, N, K, L, T, temp;
 
   a = A.get_a();
   b = A.get_b();
@@ -0,0 +1,413 @@
+/**
+ * @file ExplicitFormulas_zz_pX.cpp
+ * @remarks Explicit genus 2 and genus 3 ideal arithmetic over zz_p.
+ *
+ * Polynomials of bounded degree are handled as arrays of coefficients
+ * (index = degree).  The genus 2 formulas compute u' = P/(s1^2 u2) with
+ * P = s^2 u1 + 2 s v1 - k1 from the two leading coefficients of P only; the
+ * genus 3 formulas compute P and the reduction step with the array helpers.
+ */
+
+#include <ANTL/Quadratic/ExplicitFormulas.hpp>
+
+namespace ANTL
+{
+
+//
+// set_poly()
+//
+// Task:
+//      x = c[0] + c[1] X + ... + c[n-1] X^(n-1)
+//
+
+static inline void set_poly (zz_pX & x, const zz_p *c, long n)
+{
+  x.rep.SetLength(n);
+  for (long i = 0; i < n; ++i)
+    x.rep[i] = c[i];
+  x.normalize();
+}
+
+//
+// get_poly()
+//
+// Task:
+//      c[0..n-1] = coefficients of x (deg x < n)
+//
+
+static inline void get_poly (zz_p *c, const zz_pX & x, long n)
+{
+  for (long i = 0; i < n; ++i)
+    c[i] = coeff(x, i);
+}
+
+//
+// mul_coeffs()
+//
+// Task:
+//      c[0..na+nb-2] = a[0..na-1] b[0..nb-1]  (c must not alias a or b)
+//
+
+static void mul_coeffs (zz_p *c, const zz_p *a, long na, const zz_p *b, long nb)
+{
+  long i, j;
+
+  for (i = 0; i < na + nb - 1; ++i)
+    clear(c[i]);
+
+  for (i = 0; i < na; ++i)
+    for (j = 0; j < nb; ++j)
+      c[i+j] += a[i]*b[j];
+}
+
+//
+// div_monic()
+//
+// Task:
+//      q[0..na-nb] = a / b and a[0..nb-2] = a mod b, for b[0..nb-1] monic
+//      (a is overwritten)
+//
+
+static void div_monic (zz_p *q, zz_p *a, long na, const zz_p *b, long nb)
+{
+  long m = nb - 1;
+
+  for (long i = na - 1; i >= m; --i) {
+    q[i-m] = a[i];
+    for (long j = 0; j < m; ++j)
+      a[i-m+j] -= q[i-m]*b[j];
+  }
+}
+
+//
+// is_generic()
+//
+// Task:
+//      tests whether (a, b) is a reduced ideal with deg a = g
+//
+
+static inline bool is_generic (const zz_pX & a, const zz_pX & b, long g)
+{
+  return deg(a) == g && IsOne(LeadCoeff(a)) && deg(b) < g;
+}
+
+
+
+//
+// compose_g2()
+//
+// Task:
+//      computes the reduced ideal C from u1 = X^2 + a1 X + a0, v1 = b1 X + b0,
+//      u2 = X^2 + c1 X + c0, where s = t/e mod u2 (t, e linear) and
+//      k1 = (f - v1^2)/u1.  Returns false if Res(u2, e) = 0 or s1 = 0.
+//
+
+static bool compose_g2 (zz_pX & Ca, zz_pX & Cb, zz_pX & Cc,
+                        const zz_p & a1, const zz_p & a0, const zz_p & b1, const zz_p & b0,
+                        const zz_p & c1, const zz_p & c0,
+                        const zz_p & t1, const zz_p & t0, const zz_p & e1, const zz_p & e0,
+                        const zz_pX & f)
+{
+  zz_p g0, r, s1, s0, w, iota, sigma, k12, u1, u0, W2, W1, W0, V[4], U[3], B[2], Q[4];
+  zz_p f5, f4, f3, f2;
+
+  f5 = coeff(f, 5);
+  f4 = coeff(f, 4);
+  f3 = coeff(f, 3);
+  f2 = coeff(f, 2);
+
+  // r = Res(u2, e), s' = r s = r t/e mod u2
+  g0 = e0 - c1*e1;
+  r = e0*g0 + c0*e1*e1;
+  s1 = t1*e0 - t0*e1;
+  s0 = t0*g0 + t1*e1*c0;
+
+  if (IsZero(r) || IsZero(s1))
+    return false;
+
+  // w = 1/(r s1'), iota = 1/s1, sigma = s0/s1, s = s'/r
+  w = inv(r*s1);
+  iota = r*r*w;
+  sigma = s0*r*w;
+  s0 = s0*s1*w;
+  s1 = s1*s1*w;
+
+  // u' = P/(s1^2 u2), monic of degree 2
+  k12 = f4 - f5*a1;
+  u1 = a1 + 2*sigma - f5*iota*iota;
+  u0 = a0 + 2*sigma*a1 + sigma*sigma + 2*b1*iota - k12*iota*iota;
+  u1 -= c1;
+  u0 -= c1*u1 + c0;
+
+  // v' = -(v1 + s u1) mod u'
+  V[3] = s1;
+  V[2] = s1*a1 + s0;
+  V[1] = s1*a0 + s0*a1 + b1;
+  V[0] = s0*a0 + b0;
+
+  W2 = V[2] - V[3]*u1;
+  W1 = V[1] - V[3]*u0 - W2*u1;
+  W0 = V[0] - W2*u0;
+
+  U[2] = 1;
+  U[1] = u1;
+  U[0] = u0;
+  NTL::negate(B[1], W1);
+  NTL::negate(B[0], W0);
+
+  // c' = (v'^2 - f)/u'
+  NTL::negate(Q[3], f5);
+  Q[2] = -f4 - u1*Q[3];
+  Q[1] = -f3 - u1*Q[2] - u0*Q[3];
+  Q[0] = B[1]*B[1] - f2 - u1*Q[1] - u0*Q[2];
+
+  set_poly(Ca, U, 3);
+  set_poly(Cb, B, 2);
+  set_poly(Cc, Q, 4);
+
+  return true;
+}
+
+
+
+//
+// compose_g3()
+//
+// Task:
+//      computes the reduced ideal C from u1, v1, k1 = (f - v1^2)/u1 and u2
+//      (deg u1 = deg u2 = 3), where s = t/e mod u2 (deg t, e <= 2).  s is
+//      found by Cramer's rule (the determinant is Res(u2, e)), then
+//      u'' = P/(s2^2 u2) (degree 4) is reduced once.  Returns false if
+//      Res(u2, e) = 0 or s2 = 0.
+//
+
+static bool compose_g3 (zz_pX & Ca, zz_pX & Cb, zz_pX & Cc,
+                        const zz_p *u1, const zz_p *v1, const zz_p *k1, const zz_p *u2,
+                        const zz_p *t, const zz_p *e, const zz_p *F)
+{
+  zz_p M[3][3], S[3], det, w, is2, n, P[8], SS[5], SV[5], V[6], UU[5], VV[4], G[8], H[7], UN[4], VN[3], Q[5];
+  long i, j, i1, i2, j1, j2;
+
+  // columns of M:  e, X e mod u2, X^2 e mod u2
+  for (i = 0; i < 3; ++i)
+    M[i][0] = e[i];
+  for (j = 1; j < 3; ++j) {
+    M[0][j] = -M[2][j-1]*u2[0];
+    M[1][j] = M[0][j-1] - M[2][j-1]*u2[1];
+    M[2][j] = M[1][j-1] - M[2][j-1]*u2[2];
+  }
+
+  // s' = adj(M) t, det = det(M)
+  clear(S[0]);
+  clear(S[1]);
+  clear(S[2]);
+  clear(det);
+  for (i = 0; i < 3; ++i) {
+    i1 = (i + 1) % 3;
+    i2 = (i + 2) % 3;
+    for (j = 0; j < 3; ++j) {
+      j1 = (j + 1) % 3;
+      j2 = (j + 2) % 3;
+      w = M[i1][j1]*M[i2][j2] - M[i1][j2]*M[i2][j1];
+      S[j] += w*t[i];
+      if (i == 0)
+        det += M[0][j]*w;
+    }
+  }
+
+  if (IsZero(det) || IsZero(S[2]))
+    return false;
+
+  // w = 1/(det s2'), s = s'/det, is2 = 1/s2
+  w = inv(det*S[2]);
+  is2 = det*det*w;
+  w *= S[2];
+  S[0] *= w;
+  S[1] *= w;
+  S[2] *= w;
+
+  // P = (s^2 u1 + 2 s v1 - k1)/s2^2, u'' = P/u2
+  mul_coeffs(SS, S, 3, S, 3);
+  mul_coeffs(P, SS, 5, u1, 4);
+  mul_coeffs(SV, S, 3, v1, 3);
+  for (i = 0; i < 5; ++i)
+    P[i] += 2*SV[i] - k1[i];
+
+  n = is2*is2;
+  for (i = 0; i < 8; ++i)
+    P[i] *= n;
+
+  div_monic(UU, P, 8, u2, 4);
+
+  // v'' = -(v1 + s u1) mod u''
+  mul_coeffs(V, S, 3, u1, 4);
+  for (i = 0; i < 3; ++i)
+    V[i] += v1[i];
+
+  div_monic(Q, V, 6, UU, 5);
+  for (i = 0; i < 4; ++i)
+    NTL::negate(VV[i], V[i]);
+
+  // reduction:  u''' = (f - v''^2)/u'' made monic, v''' = -v'' mod u'''
+  mul_coeffs(H, VV, 4, VV, 4);
+  for (i = 0; i < 8; ++i)
+    G[i] = F[i];
+  for (i = 0; i < 7; ++i)
+    G[i] -= H[i];
+
+  div_monic(UN, G, 8, UU, 5);
+  inv(n, UN[3]);
+  for (i = 0; i < 4; ++i)
+    UN[i] *= n;
+
+  div_monic(Q, VV, 4, UN, 4);
+  for (i = 0; i < 3; ++i)
+    NTL::negate(VN[i], VV[i]);
+
+  // c = (v'''^2 - f)/u'''
+  mul_coeffs(SS, VN, 3, VN, 3);
+  for (i = 0; i < 8; ++i)
+    NTL::negate(G[i], F[i]);
+  for (i = 0; i < 5; ++i)
+    G[i] += SS[i];
+
+  div_monic(Q, G, 8, UN, 4);
+
+  set_poly(Ca, UN, 4);
+  set_poly(Cb, VN, 3);
+  set_poly(Cc, Q, 5);
+
+  return true;
+}
+
+
+
+//
+// explicit_add()
+//
+// Task:
+//      C = reduced ideal equivalent to A B, if A and B are in general position
+//
+
+bool explicit_add (zz_pX & Ca, zz_pX & Cb, zz_pX & Cc,
+                   const zz_pX & a1, const zz_pX & b1,
+                   const zz_pX & a2, const zz_pX & b2,
+                   const zz_pX & f, long genus)
+{
+  if (!is_generic(a1, b1, genus) || !is_generic(a2, b2, genus))
+    return false;
+
+  if (genus == 2) {
+    zz_p A1, A0, B1, B0, C1, C0;
+
+    A1 = coeff(a1, 1);
+    A0 = coeff(a1, 0);
+    B1 = coeff(b1, 1);
+    B0 = coeff(b1, 0);
+    C1 = coeff(a2, 1);
+    C0 = coeff(a2, 0);
+
+    // t = v2 - v1, e = u1 - u2
+    return compose_g2(Ca, Cb, Cc, A1, A0, B1, B0, C1, C0,
+                      coeff(b2, 1) - B1, coeff(b2, 0) - B0, A1 - C1, A0 - C0, f);
+  }
+
+  if (genus == 3) {
+    zz_p U1[4], V1[3], U2[4], V2[3], F[8], G[8], K1[5], T[3], E[3], SQ[5];
+    long i;
+
+    get_poly(U1, a1, 4);
+    get_poly(V1, b1, 3);
+    get_poly(U2, a2, 4);
+    get_poly(V2, b2, 3);
+    get_poly(F, f, 8);
+
+    // k1 = (f - v1^2)/u1
+    mul_coeffs(SQ, V1, 3, V1, 3);
+    for (i = 0; i < 8; ++i)
+      G[i] = F[i];
+    for (i = 0; i < 5; ++i)
+      G[i] -= SQ[i];
+    div_monic(K1, G, 8, U1, 4);
+
+    for (i = 0; i < 3; ++i) {
+      T[i] = V2[i] - V1[i];
+      E[i] = U1[i] - U2[i];
+    }
+
+    return compose_g3(Ca, Cb, Cc, U1, V1, K1, U2, T, E, F);
+  }
+
+  return false;
+}
+
+
+
+//
+// explicit_dbl()
+//
+// Task:
+//      C = reduced ideal equivalent to A^2, if A is in general position
+//
+
+bool explicit_dbl (zz_pX & Ca, zz_pX & Cb, zz_pX & Cc,
+                   const zz_pX & a, const zz_pX & b,
+                   const zz_pX & f, long genus)
+{
+  if (!is_generic(a, b, genus))
+    return false;
+
+  if (genus == 2) {
+    zz_p a1, a0, b1, b0, k3, k2, k1, k0, t1, t0;
+
+    a1 = coeff(a, 1);
+    a0 = coeff(a, 0);
+    b1 = coeff(b, 1);
+    b0 = coeff(b, 0);
+
+    // k = (f - v^2)/u, t = k mod u
+    k3 = coeff(f, 5);
+    k2 = coeff(f, 4) - a1*k3;
+    k1 = coeff(f, 3) - a1*k2 - a0*k3;
+    k0 = coeff(f, 2) - b1*b1 - a1*k1 - a0*k2;
+
+    t1 = k3*(a1*a1 - a0) - k2*a1 + k1;
+    t0 = k3*a1*a0 - k2*a0 + k0;
+
+    // e = 2 v
+    return compose_g2(Ca, Cb, Cc, a1, a0, b1, b0, a1, a0,
+                      t1, t0, 2*b1, 2*b0, f);
+  }
+
+  if (genus == 3) {
+    zz_p U[4], V[3], F[8], G[8], K[5], KR[5], T[3], E[3], SQ[5], Q[2];
+    long i;
+
+    get_poly(U, a, 4);
+    get_poly(V, b, 3);
+    get_poly(F, f, 8);
+
+    // k = (f - v^2)/u, t = k mod u
+    mul_coeffs(SQ, V, 3, V, 3);
+    for (i = 0; i < 8; ++i)
+      G[i] = F[i];
+    for (i = 0; i < 5; ++i)
+      G[i] -= SQ[i];
+    div_monic(K, G, 8, U, 4);
+
+    for (i = 0; i < 5; ++i)
+      KR[i] = K[i];
+    div_monic(Q, KR, 5, U, 4);
+
+    for (i = 0; i < 3; ++i) {
+      T[i] = KR[i];
+      E[i] = 2*V[i];
+    }
+
+    return compose_g3(Ca, Cb, Cc, U, V, K, U, T, E, F);
+  }
+
+  return false;
+}
+
+} // ANTL
@@ -0,0 +1,69 @@
+/**
+ * @file PrimeTable.cpp
+ * @brief implementation of the shared prime table
+ */
+
+#include <algorithm>
+
+#include <ANTL/Quadratic/Lfunction/PrimeTable.hpp>
+
+namespace ANTL
+{
+  std::vector<long> PrimeTable::table;
+  long PrimeTable::limit = 0;
+  std::mutex PrimeTable::lock;
+
+  //
+  // PrimeTable::extend(bound)
+  //
+  // Task:
+  //      makes sure that all primes <= bound are in the table
+  //
+
+  void PrimeTable::extend (long bound)
+  {
+    std::lock_guard<std::mutex> guard(lock);
+
+    if (bound <= limit)
+      return;
+
+    long n = std::max(bound, 2*limit);
+    std::vector<char> composite(n + 1, 0);
+    long i, j;
+
+    table.clear();
+    for (i = 2; i <= n; ++i) {
+      if (composite[i])
+        continue;
+      table.push_back(i);
+      if (i <= n / i)
+        for (j = i*i; j <= n; j += i)
+          composite[j] = 1;
+    }
+
+    limit = n;
+  }
+
+
+
+  //
+  // PrimeTable::primes(bound), count(bound)
+  //
+  // Task:
+  //      returns the table (extended to include all primes <= bound), resp.
+  //      the number of primes <= bound
+  //
+
+  const std::vector<long> & PrimeTable::primes (long bound)
+  {
+    extend(bound);
+    return table;
+  }
+
+  long PrimeTable::count (long bound)
+  {
+    const std::vector<long> & P = primes(bound);
+    return std::upper_bound(P.begin(), P.end(), bound) - P.begin();
+  }
+
+} // ANTL
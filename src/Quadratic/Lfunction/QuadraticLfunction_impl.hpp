@@ -0,0 +1,241 @@
+/**
+ * @file QuadraticLfunction_impl.hpp
+ * @remarks approximation of L(1,chi) for quadratic orders.
+ */
+
+//
+// constructor and destructor
+//
+
+template <class T> QuadraticLfunction<T>::QuadraticLfunction (QuadraticOrder<T> & inQO)
+  : QO(&inQO),
+    Q(0),
+    block(256),
+    A(8.795),
+    B(13.2),
+    computed(false),
+    logL(0)
+{
+  conv(Delta, QO->getDiscriminant());
+  set_error(std::log(std::sqrt(2.0)));
+}
+
+template <class T> QuadraticLfunction<T>::~QuadraticLfunction () {}
+
+
+
+//
+// QuadraticLfunction<T>::set_Q(), set_error(), set_error_constants(),
+// set_block_size()
+//
+// Task:
+//      sets the parameters.  set_error() chooses the smallest Q for which
+//      error_bound() <= err (see choose_Q()).
+//
+
+template <class T> void QuadraticLfunction<T>::set_Q (long inQ)
+{
+  Q = max(inQ, 2L);
+  computed = false;
+}
+
+template <class T> void QuadraticLfunction<T>::set_error (double err)
+{
+  set_Q(choose_Q(Delta, err, A, B));
+}
+
+template <class T> void QuadraticLfunction<T>::set_error_constants (double inA, double inB)
+{
+  A = inA;
+  B = inB;
+}
+
+template <class T> void QuadraticLfunction<T>::set_block_size (long inblock)
+{
+  block = max(inblock, 1L);
+}
+
+
+
+//
+// QuadraticLfunction<T>::error_bound()
+//
+// Task:
+//      returns (A log|Delta| + B) / (sqrt(Q) log(Q)), the bound (under ERH)
+//      on the error in log L(1,chi)
+//
+
+template <class T> double QuadraticLfunction<T>::error_bound (const ZZ & D, long inQ, double inA, double inB)
+{
+  double lD = NTL::log(abs(D));
+  return (inA*lD + inB) / (std::sqrt(double(inQ)) * std::log(double(inQ)));
+}
+
+template <class T> double QuadraticLfunction<T>::error_bound () const
+{
+  return error_bound(Delta, Q, A, B);
+}
+
+
+
+//
+// QuadraticLfunction<T>::choose_Q()
+//
+// Task:
+//      returns the smallest Q with error_bound(D, Q, A, B) <= err
+//
+
+template <class T> long QuadraticLfunction<T>::choose_Q (const ZZ & D, double err, double inA, double inB)
+{
+  long lo, hi, mid;
+
+  hi = 2;
+  while (error_bound(D, hi, inA, inB) > err && hi < (NTL_MAX_LONG >> 2))
+    hi <<= 1;
+
+  lo = max(2L, hi >> 1);
+  while (lo < hi) {
+    mid = lo + ((hi - lo) >> 1);
+    if (error_bound(D, mid, inA, inB) > err)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return hi;
+}
+
+
+
+//
+// QuadraticLfunction<T>::kronecker()
+//
+// Task:
+//      returns (Delta/p) for a prime p, resp. computes chi[i] = (Delta/P[i])
+//      for a block of primes
+//
+
+template <class T> long QuadraticLfunction<T>::kronecker (long p) const
+{
+  long r;
+
+  if (p == 2) {
+    r = rem(Delta, 8);
+    if (IsZero(r & 1))
+      return 0;
+    return (r == 1 || r == 7) ? 1 : -1;
+  }
+
+  r = rem(Delta, p);
+  return Jacobi_base(r, p);
+}
+
+template <class T> void QuadraticLfunction<T>::kronecker (long *chi, const long *P, long len) const
+{
+  std::vector<long> r(len);
+  long i;
+
+  for (i = 0; i < len; ++i)
+    r[i] = (P[i] == 2) ? 1 : rem(Delta, P[i]);
+
+  Jacobi_base(chi, r.data(), P, len);
+
+  for (i = 0; i < len; ++i)
+    if (P[i] == 2)
+      chi[i] = kronecker(2);
+}
+
+
+
+//
+// QuadraticLfunction<T>::compute()
+//
+// Task:
+//      computes the weighted Euler product approximation of log L(1,chi)
+//
+
+template <class T> void QuadraticLfunction<T>::compute ()
+{
+  long i, j, len, n, p, k, N;
+  double S, W, term, c;
+
+  if (computed)
+    return;
+
+  // tail weights tail[t] = sum_{i >= t} a_i
+  std::vector<double> tail(Q + 1);
+  tail[Q] = 0;
+  S = 0;
+  for (i = Q - 1; i >= 0; --i) {
+    S += double(Q + i) * std::log(double(Q + i));
+    tail[i] = S;
+  }
+  for (i = 0; i < Q; ++i)
+    tail[i] /= S;
+
+  N = 2*Q - 1;
+  const std::vector<long> & P = PrimeTable::primes(N);
+  long np = PrimeTable::count(N - 1);
+
+  std::vector<long> chi(block);
+  logL = 0;
+
+  for (i = 0; i < np; i += block) {
+    len = min(block, np - i);
+    kronecker(chi.data(), &P[i], len);
+
+    for (j = 0; j < len; ++j) {
+      if (chi[j] == 0)
+        continue;
+
+      p = P[i + j];
+      c = chi[j];
+      term = c / double(p);
+      for (n = p, k = 1; n < N; ++k) {
+        W = (n < Q) ? 1.0 : tail[n - Q + 1];
+        logL += W * term / double(k);
+
+        if (n > (N - 1) / p)
+          break;
+        n *= p;
+        term *= c / double(p);
+      }
+    }
+  }
+
+  computed = true;
+}
+
+
+
+//
+// QuadraticLfunction<T>::log_L(), L(), bounds()
+//
+// Task:
+//      returns the approximation of log L(1,chi), resp. L(1,chi), resp.
+//      lower and upper bounds for L(1,chi) (valid under ERH)
+//
+
+template <class T> void QuadraticLfunction<T>::log_L (RR & l)
+{
+  compute();
+  conv(l, logL);
+}
+
+template <class T> void QuadraticLfunction<T>::L (RR & l)
+{
+  compute();
+  conv(l, logL);
+  l = exp(l);
+}
+
+template <class T> void QuadraticLfunction<T>::bounds (RR & lower, RR & upper)
+{
+  double err = error_bound();
+
+  compute();
+  conv(lower, logL - err);
+  conv(upper, logL + err);
+  lower = exp(lower);
+  upper = exp(upper);
+}
@@ -0,0 +1,82 @@
+/**
+ * @file QuadraticLpolynomial_GF2EX.cpp
+ * @remark Specialization of the QuadraticLpolynomial class for GF2EX.
+ */
+
+#include <ANTL/Quadratic/Lfunction/QuadraticLpolynomial.hpp>
+
+//
+// QuadraticLpolynomial<GF2EX>::character()
+//
+// Task:
+//      returns chi(P) for y^2 + h y = f, i.e., 0 if P | h, and 1 (resp. -1)
+//      if y^2 + h y - f = 0 (mod P) is solvable (resp. unsolvable)
+//
+
+template <> long QuadraticLpolynomial<GF2EX>::character (const GF2EX & P) const
+{
+  return ::Jacobi(h, f, P);
+}
+
+
+
+//
+// QuadraticLpolynomial<GF2EX>::character()
+//
+// Task:
+//      returns chi(x) for x in F_q[x]/(P), i.e., 0 if h(x) = 0, and 1
+//      (resp. -1) if y^2 + h(x) y = f(x) is solvable (resp. unsolvable),
+//      determined by the trace of f(x)/h(x)^2
+//
+
+template <> long QuadraticLpolynomial<GF2EX>::character (const GF2EX & x, const GF2EX & P) const
+{
+  GF2EX fx, hx;
+  long i;
+
+  // f(x), h(x) mod P (Horner)
+  clear(fx);
+  for (i = deg(f); i >= 0; --i) {
+    MulMod(fx, fx, x, P);
+    add(fx, fx, coeff(f, i));
+  }
+
+  clear(hx);
+  for (i = deg(h); i >= 0; --i) {
+    MulMod(hx, hx, x, P);
+    add(hx, hx, coeff(h, i));
+  }
+
+  return ::Jacobi(hx, fx, P);
+}
+
+
+
+//
+// QuadraticLpolynomial<GF2EX>::element()
+//
+// Task:
+//      sets x to the polynomial whose coefficients are the q-adic digits
+//      of X (the binary digits of a digit are the coefficients of its
+//      representation in GF(2)[t])
+//
+
+template <> void QuadraticLpolynomial<GF2EX>::element (GF2EX & x, const ZZ & X) const
+{
+  GF2X crep;
+  GF2E c;
+  ZZ a, b;
+  long i, j;
+
+  clear(x);
+  a = X;
+  for (i = 0; !IsZero(a); ++i) {
+    DivRem(a, b, a, q);
+    clear(crep);
+    for (j = 0; j < NumBits(b); ++j)
+      if (bit(b, j))
+        SetCoeff(crep, j);
+    conv(c, crep);
+    SetCoeff(x, i, c);
+  }
+}
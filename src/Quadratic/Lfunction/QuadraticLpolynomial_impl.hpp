@@ -0,0 +1,489 @@
+/**
+ * @file QuadraticLpolynomial_impl.hpp
+ * @remarks L-polynomials of hyperelliptic function fields.
+ */
+
+//
+// constructor and destructor
+//
+
+template <class T> QuadraticLpolynomial<T>::QuadraticLpolynomial (QuadraticOrder<T> & inQO)
+  : QO(&inQO),
+    point_counting(false),
+    threads(1),
+    computed(false)
+{
+  ZZ bound;
+  long i;
+
+  f = QO->getDiscriminant();
+  h = QO->getH();
+  q = CARDINALITY<T>();
+  g = QO->getGenus();
+
+  if (QO->IsReal())
+    chi_inf = 1;
+  else if (QO->IsImaginary())
+    chi_inf = 0;
+  else
+    chi_inf = -1;
+
+  // default degree bound
+  power(bound, q, g);
+  if (bound <= (1L << 20))
+    lambda = g;
+  else {
+    set(bound);
+    for (i = 0; i < g && bound*q <= (1L << 16); ++i)
+      bound *= q;
+    lambda = max(i, 1L);
+  }
+}
+
+template <class T> QuadraticLpolynomial<T>::~QuadraticLpolynomial () {}
+
+
+
+//
+// QuadraticLpolynomial<T>::set_degree_bound()
+//
+// Task:
+//      sets the maximal degree of the primes in the Euler product
+//
+
+template <class T> void QuadraticLpolynomial<T>::set_degree_bound (long inlambda)
+{
+  lambda = max(inlambda, 1L);
+  computed = false;
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::set_point_counting()
+//
+// Task:
+//      selects point counting (true) or the Euler product (false) for the
+//      sums t_nu
+//
+
+template <class T> void QuadraticLpolynomial<T>::set_point_counting (bool flag)
+{
+  point_counting = flag;
+  computed = false;
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::element()
+//
+// Task:
+//      sets x to the polynomial whose coefficients are the q-adic digits
+//      of X
+//
+
+template <class T> void QuadraticLpolynomial<T>::element (T & x, const ZZ & X) const
+{
+  typename T::coeff_type c;
+  ZZ a, b;
+  long i;
+
+  clear(x);
+  a = X;
+  for (i = 0; !IsZero(a); ++i) {
+    DivRem(a, b, a, q);
+    conv(c, b);
+    SetCoeff(x, i, c);
+  }
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::character()
+//
+// Task:
+//      returns chi(P) = (Delta/P) for a monic irreducible P, resp. the
+//      quadratic character chi(x) = (f(x)/P) of F_q[x]/(P) at x
+//
+
+template <class T> long QuadraticLpolynomial<T>::character (const T & P) const
+{
+  return Jacobi(f, P);
+}
+
+template <class T> long QuadraticLpolynomial<T>::character (const T & x, const T & P) const
+{
+  T fx;
+  long i;
+
+  // f(x) mod P (Horner)
+  clear(fx);
+  for (i = deg(f); i >= 0; --i) {
+    MulMod(fx, fx, x, P);
+    add(fx, fx, coeff(f, i));
+  }
+
+  return Jacobi(fx, P);
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::prime_sums()
+//
+// Task:
+//      computes tnu[nu] = sum_{deg P | nu} deg P chi(P)^(nu/deg P) for
+//      nu <= lambda from the primes of degree <= lambda
+//
+
+template <class T> void QuadraticLpolynomial<T>::prime_sums (std::vector<ZZ> & tnu) const
+{
+  ZZ X, qn, end;
+  T P;
+  long n, nu, chi;
+
+  set(qn);
+  for (n = 1; n <= lambda; ++n) {
+    qn *= q;
+    end = 2*qn;
+
+    for (X = qn; X < end; ++X) {
+      element(P, X);
+      if (!DetIrredTest(P))
+        continue;
+
+      chi = character(P);
+      if (chi == 0)
+        continue;
+
+      for (nu = n; nu <= lambda; nu += n) {
+        if (chi > 0 || ((nu / n) & 1) == 0)
+          tnu[nu] += n;
+        else
+          tnu[nu] -= n;
+      }
+    }
+  }
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::character_sum()
+//
+// Task:
+//      computes t_nu = sum_{x in F_q^nu} chi_nu(x), where F_q^nu is
+//      represented as F_q[x]/(P) for an irreducible P of degree nu.  The
+//      elements (q-adic indices 0 .. q^nu - 1) are split into blocks, one per
+//      worker thread.
+//
+
+template <class T> long QuadraticLpolynomial<T>::character_sum (const T & P, const ZZ & first, const ZZ & last) const
+{
+  ZZ X;
+  T x;
+  long t = 0;
+
+  for (X = first; X < last; ++X) {
+    element(x, X);
+    t += character(x, P);
+  }
+
+  return t;
+}
+
+template <class T> void QuadraticLpolynomial<T>::character_sum (ZZ & t, long nu) const
+{
+  ZZ total;
+  T P;
+  long nt, w;
+
+  if (nu < 1)
+    LogicError("QuadraticLpolynomial: extension degree out of range");
+
+  BuildIrred(P, nu);
+  power(total, q, nu);
+
+  nt = (total < threads) ? to_long(total) : threads;
+  if (nt <= 1) {
+    conv(t, character_sum(P, ZZ::zero(), total));
+    return;
+  }
+
+  typename T::coeff_type::context_type context;
+  context.save();
+
+  std::vector<long> partial(nt, 0);
+  std::vector<std::thread> workers;
+
+  for (w = 0; w < nt; ++w)
+    workers.push_back(std::thread([&, w] () {
+      context.restore();
+      partial[w] = character_sum(P, (total * w) / nt, (total * (w + 1)) / nt);
+    }));
+
+  for (w = 0; w < nt; ++w)
+    workers[w].join();
+
+  clear(t);
+  for (w = 0; w < nt; ++w)
+    t += partial[w];
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::count_points()
+//
+// Task:
+//      computes the number of points N_nu = q^nu + t_nu + 1 + chi(inf)^nu
+//      of the curve over F_q^nu (including the points at infinity)
+//
+
+template <class T> void QuadraticLpolynomial<T>::count_points (ZZ & N, long nu) const
+{
+  ZZ t;
+
+  character_sum(t, nu);
+  power(N, q, nu);
+  N += t + 1;
+  if (chi_inf > 0 || (chi_inf < 0 && (nu & 1) == 0))
+    N += 1;
+  else if (chi_inf < 0)
+    N -= 1;
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::compute()
+//
+// Task:
+//      computes the power sums s_nu and the coefficients a_i of L(u) for
+//      nu, i <= lambda, either from the primes of degree <= lambda or by
+//      counting points over F_q^nu
+//
+
+template <class T> void QuadraticLpolynomial<T>::compute ()
+{
+  std::vector<ZZ> tnu;
+  ZZ temp;
+  long n, nu, i, j;
+
+  if (computed)
+    return;
+
+  // tnu[nu] = sum_{deg P | nu} deg P chi(P)^(nu/deg P)
+  tnu.assign(lambda + 1, ZZ::zero());
+
+  if (point_counting) {
+    for (nu = 1; nu <= lambda; ++nu)
+      character_sum(tnu[nu], nu);
+  }
+  else
+    prime_sums(tnu);
+
+  s.assign(lambda + 1, ZZ::zero());
+  for (nu = 1; nu <= lambda; ++nu) {
+    negate(s[nu], tnu[nu]);
+    if (chi_inf > 0 || (chi_inf < 0 && (nu & 1) == 0))
+      s[nu] -= 1;
+    else if (chi_inf < 0)
+      s[nu] += 1;
+  }
+
+  // Newton's identities:  i a_i = -sum_{j=1}^{i} s_j a_{i-j}
+  n = min(lambda, g);
+  a.assign(n + 1, ZZ::zero());
+  set(a[0]);
+  for (i = 1; i <= n; ++i) {
+    for (j = 1; j <= i; ++j) {
+      mul(temp, s[j], a[i-j]);
+      a[i] -= temp;
+    }
+    a[i] /= i;
+  }
+
+  computed = true;
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::power_sum(), coefficient()
+//
+// Task:
+//      returns s_nu (1 <= nu <= lambda), resp. a_i (0 <= i <= min(lambda,g))
+//
+
+template <class T> void QuadraticLpolynomial<T>::power_sum (ZZ & x, long nu)
+{
+  compute();
+  if (nu < 1 || nu > lambda)
+    LogicError("QuadraticLpolynomial: power sum index out of range");
+  x = s[nu];
+}
+
+template <class T> void QuadraticLpolynomial<T>::coefficient (ZZ & x, long i)
+{
+  compute();
+  if (i < 0 || i >= (long) a.size())
+    LogicError("QuadraticLpolynomial: coefficient index out of range");
+  x = a[i];
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::polynomial()
+//
+// Task:
+//      sets L to the coefficients of L(u) (lambda >= g only, otherwise
+//      false is returned)
+//
+
+template <class T> bool QuadraticLpolynomial<T>::polynomial (std::vector<ZZ> & L)
+{
+  ZZ qi;
+  long i;
+
+  if (!is_exact())
+    return false;
+
+  compute();
+
+  L.resize(2*g + 1);
+  set(qi);
+  for (i = g; i >= 0; --i) {
+    L[i] = a[i];
+    mul(L[2*g - i], qi, a[i]);
+    qi *= q;
+  }
+
+  return true;
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::jacobian_order()
+//
+// Task:
+//      sets N = L(1), the order of the Jacobian (lambda >= g only,
+//      otherwise false is returned)
+//
+
+template <class T> bool QuadraticLpolynomial<T>::jacobian_order (ZZ & N)
+{
+  std::vector<ZZ> L;
+  long i;
+
+  if (!polynomial(L))
+    return false;
+
+  clear(N);
+  for (i = 0; i <= 2*g; ++i)
+    N += L[i];
+
+  return true;
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::error_bound()
+//
+// Task:
+//      returns the bound on |log L(1) - log E| (0 if lambda >= g)
+//
+
+template <class T> double QuadraticLpolynomial<T>::error_bound () const
+{
+  double rq;
+
+  if (is_exact())
+    return 0.0;
+
+  rq = std::sqrt(to_double(q));
+  return (2.0*g / (lambda + 1)) * std::pow(rq, -double(lambda + 1)) / (1.0 - 1.0/rq);
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::estimate()
+//
+// Task:
+//      computes the approximation E of L(1) (exact if lambda >= g)
+//
+
+template <class T> void QuadraticLpolynomial<T>::estimate (RR & E)
+{
+  ZZ N, qn;
+  RR sum, temp;
+  long nu;
+
+  if (jacobian_order(N)) {
+    conv(E, N);
+    return;
+  }
+
+  compute();
+
+  clear(sum);
+  set(qn);
+  for (nu = 1; nu <= lambda; ++nu) {
+    qn *= q;
+    conv(temp, s[nu]);
+    temp /= to_RR(qn) * nu;
+    sum += temp;
+  }
+
+  power(qn, q, g);
+  E = to_RR(qn) * exp(-sum);
+}
+
+
+
+//
+// QuadraticLpolynomial<T>::bounds()
+//
+// Task:
+//      computes lower <= L(1) <= upper, using the approximation E and the
+//      Hasse-Weil bounds (sqrt(q) - 1)^(2g) <= L(1) <= (sqrt(q) + 1)^(2g)
+//
+
+template <class T> void QuadraticLpolynomial<T>::bounds (ZZ & lower, ZZ & upper)
+{
+  RR E, psi, rq, temp;
+  ZZ hw;
+
+  if (jacobian_order(lower)) {
+    upper = lower;
+    return;
+  }
+
+  estimate(E);
+  conv(psi, error_bound());
+
+  mul(temp, E, exp(-psi));
+  CeilToZZ(lower, temp);
+  mul(temp, E, exp(psi));
+  FloorToZZ(upper, temp);
+
+  // Hasse-Weil
+  SqrRoot(rq, to_RR(q));
+  power(temp, rq - 1, 2*g);
+  CeilToZZ(hw, temp);
+  if (lower < hw)
+    lower = hw;
+  if (lower < 1)
+    set(lower);
+
+  power(temp, rq + 1, 2*g);
+  FloorToZZ(hw, temp);
+  if (upper > hw)
+    upper = hw;
+}
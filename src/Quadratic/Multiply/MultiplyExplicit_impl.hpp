@@ -0,0 +1,10 @@
+/**
+ * @file MultiplyExplicit_impl.hpp
+ * @remarks Generic implementation of the MultiplyExplicit class:  no explicit
+ * formulas are available, so NUCOMP is used.
+ */
+
+template < class T > void MultiplyExplicit<T>::multiply(QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> & A, const QuadraticIdealBase<T> & B) {
+  ++fallbacks;
+  nucomp.multiply(C,A,B);
+}
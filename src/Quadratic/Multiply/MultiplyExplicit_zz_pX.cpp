@@ -0,0 +1,30 @@
+/**
+ * @file MultiplyExplicit_zz_pX.cpp
+ * @remark Specialization of the MultiplyExplicit class for zz_pX.
+ */
+
+#include <ANTL/Quadratic/Multiply/MultiplyExplicit.hpp>
+
+template <> void MultiplyExplicit<zz_pX>::multiply(QuadraticIdealBase<zz_pX> & C, const QuadraticIdealBase<zz_pX> & A, const QuadraticIdealBase<zz_pX> & B) {
+  static thread_local zz_pX a1, b1, a2, b2, Ca, Cb, Cc;
+  bool done = false;
+
+  if (is_init && IsZero(hx) && (genus == 2 || genus == 3) && zz_p::modulus() != 2) {
+    a1 = A.get_a();
+    b1 = A.get_b();
+    a2 = B.get_a();
+    b2 = B.get_b();
+
+    if (a1 == a2 && b1 == b2)
+      done = explicit_dbl(Ca, Cb, Cc, a1, b1, Delta, genus);
+    else
+      done = explicit_add(Ca, Cb, Cc, a1, b1, a2, b2, Delta, genus);
+  }
+
+  if (done)
+    C.assign(Ca, Cb, Cc);
+  else {
+    ++fallbacks;
+    nucomp.multiply(C, A, B);
+  }
+}
@@ -0,0 +1,10 @@
+/**
+ * @file MultiplyNucomp_GF2nX.cpp
+ * @remark Specialization of the MultiplyNucomp class for GF2nX.
+ */
+
+#include <ANTL/Quadratic/Multiply/MultiplyNucomp.hpp>
+
+template <> void MultiplyNucomp<GF2nX>::multiply(QuadraticIdealBase<GF2nX> & C, const QuadraticIdealBase<GF2nX> & A, const QuadraticIdealBase<GF2nX> & B) {
+  multiply_char2(C,A,B);
+}
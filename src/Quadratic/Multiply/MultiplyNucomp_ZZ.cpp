@@ -13,9 +13,9 @@ template <> void MultiplyNucomp<ZZ>::init(const ZZ & delta_in, const ZZ & h_in,
 }
 
 template <> void MultiplyNucomp<ZZ>::multiply(QuadraticIdealBase<ZZ> & C, const QuadraticIdealBase<ZZ> & A, const QuadraticIdealBase<ZZ> & B) {
-  static ZZ a1, a2, b1, b2, c2, Ca, Cb, Cc, ss, m;
-  static ZZ SP, S, v1, u2, v2, K, T, temp;
-  static ZZ R1, R2, C1, C2, M1, M2;
+  static thread_local ZZ a1, a2, b1, b2, c2, Ca, Cb, Cc, ss, m;
+  static thread_local ZZ SP, S, v1, u2, v2, K, T, temp;
+  static thread_local ZZ R1, R2, C1, C2, M1, M2;
 
   // want a1 to be the smaller of the two a coefficients, because initial
   // computations are done mod a1
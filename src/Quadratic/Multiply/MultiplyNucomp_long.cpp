@@ -13,9 +13,9 @@ template <> void MultiplyNucomp<long>::init(const long & delta_in, const long &
 }
 
 template <> void MultiplyNucomp<long>::multiply(QuadraticIdealBase<long> & C, const QuadraticIdealBase<long> & A, const QuadraticIdealBase<long> & B) {
-  static long a1, a2, b1, b2, c2, Ca, Cb, Cc, ss, m;
-  static long SP, S, v1, u2, v2, K, T, temp;
-  static long R1, R2, C1, C2, M1, M2;
+  static thread_local long a1, a2, b1, b2, c2, Ca, Cb, Cc, ss, m;
+  static thread_local long SP, S, v1, u2, v2, K, T, temp;
+  static thread_local long R1, R2, C1, C2, M1, M2;
 
   // want a1 to be the smaller of the two a coefficients, because initial
   // computations are done mod a1
@@ -59,6 +59,10 @@ template <> void MultiplyNucomp<long>::multiply(QuadraticIdealBase<long> & C, co
     }
   }
 
+  // 0 <= K < L, as for ZZ (the partial reduction needs a nonnegative K)
+  K %= a1;
+  if (K < 0) K += a1;
+
   // N = a2;  L = a1;
 
   // check if NUCOMP steps are required
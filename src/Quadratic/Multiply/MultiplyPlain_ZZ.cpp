@@ -8,8 +8,8 @@
 #include <ANTL/Quadratic/QuadraticIdealBase.hpp>
 
 template <> void MultiplyPlain<ZZ>::multiply (QuadraticIdealBase<ZZ> & C, const QuadraticIdealBase<ZZ> & A, const QuadraticIdealBase<ZZ> & B) {
-  static ZZ a1, a2, b1, b2, c2, Ca, Cb, Cc;
-  static ZZ SP, S, ab2, v1, u2, v2, K, T, temp;
+  static thread_local ZZ a1, a2, b1, b2, c2, Ca, Cb, Cc;
+  static thread_local ZZ SP, S, ab2, v1, u2, v2, K, T, temp;
 
   a1 = A.get_a();
   a2 = B.get_a();
@@ -8,8 +8,8 @@
 #include <ANTL/Quadratic/QuadraticIdealBase.hpp>
 
 template <> void MultiplyPlain<long>::multiply (QuadraticIdealBase<long> & C, const QuadraticIdealBase<long> & A, const QuadraticIdealBase<long> & B) {
-  static long a1, a2, b1, b2, c2, Ca, Cb, Cc;
-  static long SP, S, ab2, v1, u2, v2, K, T, temp;
+  static thread_local long a1, a2, b1, b2, c2, Ca, Cb, Cc;
+  static thread_local long SP, S, ab2, v1, u2, v2, K, T, temp;
 
   a1 = A.get_a();
   a2 = B.get_a();
@@ -0,0 +1,159 @@
+/**
+ * @file PrimeIdealBatch_impl.hpp
+ * @remarks batched generation of prime ideals of quadratic orders.
+ */
+
+#include <algorithm>
+
+//
+// constructor and destructor
+//
+
+template <class T> PrimeIdealBatch<T>::PrimeIdealBatch (QuadraticOrder<T> & inQO, long inblock)
+  : QO(&inQO),
+    block((inblock > 0) ? inblock : 1)
+{
+  const long sixteen = 16;
+
+  Delta = QO->getDiscriminant();
+  rem_block(&D16, Delta, &sixteen, 1);
+}
+
+template <class T> PrimeIdealBatch<T>::~PrimeIdealBatch () {}
+
+
+
+//
+// PrimeIdealBatch<T>::process()
+//
+// Task:
+//      appends the prime forms for the block of primes P[0], ..., P[len-1]
+//
+
+template <class T> void PrimeIdealBatch<T>::process (const long *P, long len)
+{
+  std::vector<long> r(len), a(len), chi(len);
+  PrimeForm F;
+  long i, p, p2, r2, b;
+  const long odd = D16 & 1;
+
+  // Delta mod p for the whole block
+  rem_block(r.data(), Delta, P, len);
+
+  // Kronecker symbols for the odd primes (p = 2 is handled separately)
+  for (i = 0; i < len; ++i)
+    a[i] = (P[i] == 2) ? 1 : r[i];
+  Jacobi_base(chi.data(), a.data(), P, len);
+
+  for (i = 0; i < len; ++i) {
+    p = P[i];
+
+    if (p == 2) {
+      if (!odd) {
+        // 2 | Delta:  Delta = 4 m requires m = 3 (mod 4)
+        if ((D16 & 3) == 0 && (D16 >> 2) != 3)
+          continue;
+        F.b = 2;
+      }
+      else if ((D16 & 7) == 1)
+        F.b = 1;
+      else
+        continue;
+    }
+    else if (r[i] == 0) {
+      // ramified:  p^2 must not divide Delta
+      p2 = p*p;
+      rem_block(&r2, Delta, &p2, 1);
+      if (r2 == 0)
+        continue;
+      F.b = odd ? p : 0;
+    }
+    else if (chi[i] < 0)
+      continue;
+    else {
+      ressol_long(b, r[i], p);
+      if ((b & 1) != odd)
+        b = p - b;
+      F.b = b;
+    }
+
+    F.p = p;
+    forms.push_back(F);
+  }
+}
+
+
+
+//
+// PrimeIdealBatch<T>::generate()
+//
+// Task:
+//      appends the prime forms for all primes p <= bound (at most count
+//      forms if count > 0), resp. for the primes in P.  Returns the number of
+//      forms appended.
+//
+
+template <class T> long PrimeIdealBatch<T>::generate (long bound, long count)
+{
+  const std::vector<long> & P = PrimeTable::primes(bound);
+  long start = forms.size();
+  long end = std::upper_bound(P.begin(), P.end(), bound) - P.begin();
+  long i;
+
+  for (i = 0; i < end; i += block) {
+    process(&P[i], std::min(block, end - i));
+
+    if (count > 0 && (long) forms.size() - start >= count) {
+      forms.resize(start + count);
+      break;
+    }
+  }
+
+  return forms.size() - start;
+}
+
+template <class T> long PrimeIdealBatch<T>::generate (const std::vector<long> & P)
+{
+  long start = forms.size();
+  long n = P.size();
+  long i;
+
+  for (i = 0; i < n; i += block)
+    process(&P[i], std::min(block, n - i));
+
+  return forms.size() - start;
+}
+
+
+
+//
+// PrimeIdealBatch<T>::assign()
+//
+// Task:
+//      sets A to the i-th prime form (p, b, (b^2 - Delta)/4p), resp. the
+//      vector A to all prime forms
+//
+
+template <class T> void PrimeIdealBatch<T>::assign (QuadraticIdealBase<T> & A, long i) const
+{
+  T a, b, c;
+
+  a = to<T>(forms[i].p);
+  b = to<T>(forms[i].b);
+  c = b*b - Delta;
+  c /= 4*a;
+
+  A.assign(a, b, c);
+}
+
+template <class T> void PrimeIdealBatch<T>::assign (std::vector< QuadraticIdealBase<T> > & A) const
+{
+  long i, n = forms.size();
+
+  A.clear();
+  A.reserve(n);
+  for (i = 0; i < n; ++i) {
+    A.push_back(QuadraticIdealBase<T>(*QO));
+    assign(A.back(), i);
+  }
+}
@@ -0,0 +1,126 @@
+/**
+ * @file QuadraticIdealBase_GF2nX.cpp
+ * @remark Reduced quadratic ideal function specializations (GF2nX base type).
+ */
+
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+
+namespace ANTL
+{
+  //
+  // assign_prime()
+  //
+  // Task:
+  //      computes a reduced representative of the equivalence class containing
+  //      the ideal lying over the prime p.  If such an ideal doesnot exist,
+  //      false is returned.  For p = x + alpha, b is a root of
+  //      z^2 + h(alpha) z + f(alpha); otherwise the GF2EX version of ressol
+  //      is used.
+  //
+
+  template <>
+  bool
+  QuadraticIdealBase<GF2nX>::assign_prime (const GF2nX & p)
+  {
+    GF2nX temp;
+    long jac;
+
+    if (deg(p) < 1)
+      return false;
+
+    a = p;
+    MakeMonic(a);
+
+    if (deg(a) == 1) {
+      GF2n alpha, F, H, z;
+
+      alpha = ConstTerm(a);
+      eval(F, QO->getDiscriminant(), alpha);
+      eval(H, QO->getH(), alpha);
+
+      if (IsZero(H)) {
+        // ramified:  b^2 = f(alpha)
+        SqrRoot(z, F);
+        jac = 0;
+      }
+      else {
+        // b = H z with z^2 + z = F / H^2
+        GF2n t;
+        sqr(t, H);
+        div(t, F, t);
+        if (!SolveArtinSchreier(z, t))
+          return false;
+        mul(z, z, H);
+        jac = 1;
+      }
+
+      b = GF2nX(z);
+    }
+    else {
+      GF2EX P, Hx, Fx, B;
+
+      conv(P, a);
+      conv(Hx, QO->getH());
+      conv(Fx, QO->getDiscriminant());
+
+      if (!DetIrredTest(P))
+        return false;
+
+      jac = ressol(B, Hx, Fx, P);
+      if (jac < 0)
+        return false;
+
+      conv(b, B);
+    }
+
+    // c = (b * b + b*hx +  fx) / a;
+    sqr(c,b);
+    mul(temp,b,QO->getH());
+    add(c,c,temp);
+    add(c,c,QO->getDiscriminant());
+    div(c,c,a);
+
+    if (jac == 0) {
+      // non-invertible if gcd(a,h,(f+bh+b^2)/a) <> 1
+      GCD(temp,a,QO->getH());
+      GCD(temp,temp,c);
+      if (!IsOne(temp))
+        return false;
+    }
+
+    return true;
+  }
+
+
+
+  //
+  // conjugate()
+  //
+  // Task:
+  //      computes the conjugate of A, (a, b + h, c') with b + h taken mod a
+  //
+
+  template <>
+  void
+  conjugate (QuadraticIdealBase<GF2nX> &C, const QuadraticIdealBase<GF2nX> &A)
+  {
+    GF2nX temp, hx = A.QO->getH();
+
+    C.QO = A.QO;
+    C.a = A.a;
+    add(C.b,A.b,hx);
+    if (deg(C.b) < deg(C.a))
+      C.c = A.c;
+    else {
+      rem(C.b,C.b,C.a);
+
+      // C.c = (C.b * C.b + C.b * hx +  fx) / C.a;
+      sqr(C.c,C.b);
+      mul(temp,C.b,hx);
+      add(C.c,C.c,temp);
+      add(C.c,C.c,A.QO->getDiscriminant());
+      div(C.c,C.c,C.a);
+    }
+  }
+
+} // ANTL
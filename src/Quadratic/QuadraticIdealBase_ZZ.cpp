@@ -188,7 +188,7 @@ template <> bool QuadraticIdealBase<ZZ>::is_reduced() {
 }
 
 template <> void QuadraticIdealBase<ZZ>::normalize() {
-  static ZZ a2, delta, rootDelta, temp, s;
+  static thread_local ZZ a2, delta, rootDelta, temp, s;
 
   // delta = b^2 - 4ac
   mul(temp, a, c);
@@ -121,6 +121,13 @@ template <class T> void conjugate (QuadraticIdealBase<T> &C, const QuadraticIdea
   C.c = A.c;
 }
 
+// inv()
+//
+// Task:computes the inverse of the class of A (its conjugate)
+template <class T> void ANTL::inv (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A) {
+  conjugate(C, A);
+}
+
 template <class T> void ANTL::mul(QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A, const QuadraticIdealBase<T> &B) {
   C.QO->get_mul_best()->multiply(C, A, B);
 }
@@ -158,6 +165,9 @@ template <class T> void QuadraticIdealBase<T>::reduce(ANTL::QuadraticNumber<T> &
 //
 // Task: tests if the ideal is the unit ideal
 template <class T> bool QuadraticIdealBase<T>::IsOne () const {
+  // the member IsOne() hides the free functions:  bring in NTL's (ZZ, long),
+  // and argument-dependent lookup finds those of other types (e.g. GF2nX)
+  using NTL::IsOne;
   return (IsOne (a));
 }
 
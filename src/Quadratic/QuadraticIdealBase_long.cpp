@@ -179,7 +179,7 @@ template <> bool QuadraticIdealBase<long>::is_reduced () {
 }
 
 template <> void QuadraticIdealBase<long>::normalize() {
-  static long a2, delta, rootDelta, s;
+  static thread_local long a2, delta, rootDelta, s;
 
   delta = b*b - 4*a*c;
 
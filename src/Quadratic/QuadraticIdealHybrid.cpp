@@ -0,0 +1,778 @@
+/**
+ * @file QuadraticIdealHybrid.cpp
+ * @remark Quadratic ideals with word sized coefficients, promoted to ZZ on
+ * overflow.
+ */
+
+#include <ANTL/Quadratic/QuadraticIdealHybrid.hpp>
+#include <NTL/RR.h>
+
+using namespace ANTL;
+
+
+//
+// checked word arithmetic
+//
+// Task: r = x * y, x + y, x - y; false on overflow
+//
+
+static inline bool mul_ok (long & r, long x, long y) { return !__builtin_mul_overflow(x, y, &r); }
+static inline bool add_ok (long & r, long x, long y) { return !__builtin_add_overflow(x, y, &r); }
+static inline bool sub_ok (long & r, long x, long y) { return !__builtin_sub_overflow(x, y, &r); }
+
+// floor(x/y) and x - floor(x/y) y (as NTL's div and rem)
+static inline long floor_div (long x, long y)
+{
+  long q = x / y;
+  if ((x % y != 0) && ((x < 0) != (y < 0)))
+    --q;
+  return q;
+}
+
+static inline long floor_rem (long x, long y)
+{
+  long r = x % y;
+  if ((r != 0) && ((r < 0) != (y < 0)))
+    r += y;
+  return r;
+}
+
+static inline long sign_of (long x) { return (x > 0) - (x < 0); }
+
+
+
+//
+// HybridCounters
+//
+
+void HybridCounters::clear ()
+{
+  mul_word = mul_promoted = mul_ZZ = 0;
+  sqr_word = sqr_promoted = sqr_ZZ = 0;
+  red_word = red_promoted = red_ZZ = 0;
+  demotions = 0;
+}
+
+std::ostream & ANTL::operator << (std::ostream & out, const HybridCounters & N)
+{
+  out << "mul: " << N.mul_word << " word, " << N.mul_promoted << " promoted, " << N.mul_ZZ << " ZZ; ";
+  out << "sqr: " << N.sqr_word << " word, " << N.sqr_promoted << " promoted, " << N.sqr_ZZ << " ZZ; ";
+  out << "reduce: " << N.red_word << " word, " << N.red_promoted << " promoted, " << N.red_ZZ << " ZZ; ";
+  out << "demotions: " << N.demotions;
+  return out;
+}
+
+
+
+//
+// QuadraticHybridOrder
+//
+
+QuadraticHybridOrder::QuadraticHybridOrder (QuadraticOrder<ZZ> & inQO)
+  : QO(&inQO),
+    Delta(0),
+    NC_BOUND(0),
+    rootD(0)
+{
+  ZZ D = QO->getDiscriminant();
+
+  imaginary = QO->IsImaginary();
+  word = fits(D);
+
+  if (word) {
+    conv(Delta, D);
+    conv(NC_BOUND, FloorToZZ(sqrt(sqrt(abs(to_RR(D))))));
+    if (!imaginary)
+      conv(rootD, SqrRoot(D));
+  }
+
+  mul_nucomp.init(D, QO->getH());
+  sqr_nudupl.init(D, QO->getH());
+}
+
+QuadraticHybridOrder::~QuadraticHybridOrder () {}
+
+
+
+//
+// QuadraticHybridOrder::xgcd_partial()
+//
+// Task: partial extended Euclidean algorithm as XGCD_PARTIAL (plain
+//       version):  stops as soon as R1 <= bound.  All values are bounded by
+//       the input, so no overflow checks are needed.
+//
+
+void QuadraticHybridOrder::xgcd_partial (long & R2, long & R1, long & C2, long & C1, long bound)
+{
+  long q, t;
+
+  C2 = 0;
+  C1 = -1;
+
+  while (R1 != 0 && R1 > bound) {
+    q = R2 / R1;
+
+    t = R2 - q*R1;
+    R2 = R1;
+    R1 = t;
+
+    t = C2 - q*C1;
+    C2 = C1;
+    C1 = t;
+  }
+
+  if (R2 < 0) {
+    C2 = -C2;
+    C1 = -C1;
+    R2 = -R2;
+  }
+}
+
+
+
+//
+// QuadraticHybridOrder::nucomp()
+//
+// Task: NUCOMP as in MultiplyNucomp<ZZ>::multiply (without the final
+//       reduction), (Ca, Cb, Cc) = (a1, b1, c1) (a2, b2, c2).  Returns false
+//       on overflow.
+//
+
+bool QuadraticHybridOrder::nucomp (long & Ca, long & Cb, long & Cc, long a1, long b1, long c1, long a2, long b2, long c2) const
+{
+  long ss, m, SP, S, v1, u2, v2, K, T, temp;
+  long R1, R2, C1, C2, M1, M2;
+
+  // want a1 to be the smaller of the two a coefficients, because initial
+  // computations are done mod a1
+  if (a1 >= a2) {
+    std::swap(a1, a2);
+    std::swap(b1, b2);
+    c2 = c1;
+  }
+
+  // s = (b1 + b2)/2, m = (b1 - b2)/2
+  if (!add_ok(ss, b1, b2) || !sub_ok(m, b1, b2))
+    return false;
+  ss /= 2;
+  m /= 2;
+
+  // solve SP = v1 a2 + u1 a1 (only need v1)
+  XGCD_LEFT (SP, v1, a2, a1);
+
+  // K = v1 (b1 - b2) / 2 (mod L)
+  if (!mul_ok(K, m, v1))
+    return false;
+  K = floor_rem(K, a1);
+
+  if (SP != 1) {
+    XGCD (S, u2, v2, SP, ss);
+
+    // K = u2 K - v2 c2 (mod L)
+    if (!mul_ok(K, K, u2) || !mul_ok(temp, v2, c2) || !sub_ok(K, K, temp))
+      return false;
+
+    if (S != 1) {
+      a1 /= S;
+      a2 /= S;
+      if (!mul_ok(c2, c2, S))
+        return false;
+    }
+
+    K = floor_rem(K, a1);
+  }
+
+  // N = a2;  L = a1;
+
+  if (a1 < NC_BOUND) {
+    // regular multiplication formula
+
+    // T = NK, C.a = NL, C.b = b2 + 2T, C.c = (S c2 + K (b2 + T)) / L
+    if (!mul_ok(T, a2, K) || !mul_ok(Ca, a2, a1))
+      return false;
+    if (!add_ok(Cb, T, T) || !add_ok(Cb, Cb, b2))
+      return false;
+    if (!add_ok(Cc, b2, T) || !mul_ok(Cc, Cc, K) || !add_ok(Cc, Cc, c2))
+      return false;
+    Cc = floor_div(Cc, a1);
+  }
+  else {
+    // NUCOMP formulas
+    R2 = a1;
+    R1 = K;
+    xgcd_partial(R2, R1, C2, C1, NC_BOUND);
+
+    // M1 = (N R1 + (b1 - b2) C1 / 2) / L  (T = N R1)
+    if (!mul_ok(T, a2, R1) || !mul_ok(M1, m, C1) || !add_ok(M1, M1, T))
+      return false;
+    M1 = floor_div(M1, a1);
+
+    // M2 = (R1(b1 + b2)/2 - c2 S C1) / L
+    if (!mul_ok(M2, ss, R1) || !mul_ok(temp, c2, C1) || !sub_ok(M2, M2, temp))
+      return false;
+    M2 = floor_div(M2, a1);
+
+    // C.a = (-1)^(i-1) (R1 M1 - C1 M2)
+    if (!mul_ok(Ca, R1, M1) || !mul_ok(temp, C1, M2))
+      return false;
+    if (C1 < 0) {
+      if (!sub_ok(Ca, Ca, temp))
+        return false;
+    }
+    else if (!sub_ok(Ca, temp, Ca))
+      return false;
+
+    // C.b = 2 (N R1 - C.a C2) / C1 - b2 (mod 2a)
+    if (!mul_ok(Cb, Ca, C2) || !sub_ok(Cb, T, Cb) || !add_ok(Cb, Cb, Cb))
+      return false;
+    Cb = floor_div(Cb, C1);
+    if (!sub_ok(Cb, Cb, b2) || !add_ok(temp, Ca, Ca))
+      return false;
+    Cb = floor_rem(Cb, temp);
+
+    // C.c = (C.b^2 - Delta) / 4 C.a
+    if (!mul_ok(Cc, Cb, Cb) || !sub_ok(Cc, Cc, Delta))
+      return false;
+    Cc = floor_div(Cc, Ca) / 4;
+
+    if (Ca < 0) {
+      Ca = -Ca;
+      Cc = -Cc;
+    }
+  }
+
+  return fits(Ca) && fits(Cb) && fits(Cc);
+}
+
+
+
+//
+// QuadraticHybridOrder::nudupl()
+//
+// Task: one NUDUPL step as in SquareNudupl<ZZ>::nudupl, in place.  Returns
+//       false on overflow (a, b, c unchanged).
+//
+
+bool QuadraticHybridOrder::nudupl (long & a, long & b, long & c) const
+{
+  long a1, b1, c1, Ca, Cb, Cc;
+  long S, v1, K, T, temp;
+  long R1, R2, C1, C2, M2;
+
+  a1 = a;
+  b1 = b;
+  c1 = c;
+
+  // solve S = v1 b1 + u1 a1 (only need v1)
+  XGCD_LEFT (S, v1, b1, a1);
+
+  // K = -v1 c1 (mod L)
+  if (!mul_ok(K, v1, c1) || !sub_ok(K, 0, K))
+    return false;
+
+  if (S != 1) {
+    a1 /= S;
+    if (!mul_ok(c1, c1, S))
+      return false;
+  }
+
+  K = floor_rem(K, a1);
+
+  // N = L = a1;
+
+  if (a1 < NC_BOUND) {
+    // regular squaring formula
+
+    // T = NK, C.a = N^2, C.b = b1 + 2T, C.c = (S c1 + K (b1 + T)) / L
+    if (!mul_ok(T, a1, K) || !mul_ok(Ca, a1, a1))
+      return false;
+    if (!add_ok(Cb, T, T) || !add_ok(Cb, Cb, b1))
+      return false;
+    if (!add_ok(Cc, b1, T) || !mul_ok(Cc, Cc, K) || !add_ok(Cc, Cc, c1))
+      return false;
+    Cc = floor_div(Cc, a1);
+  }
+  else {
+    // NUCOMP formulas
+    R2 = a1;
+    R1 = K;
+    xgcd_partial(R2, R1, C2, C1, NC_BOUND);
+
+    // M2 = (R1 b1 - c1 S C1) / L
+    if (!mul_ok(M2, R1, b1) || !mul_ok(temp, c1, C1) || !sub_ok(M2, M2, temp))
+      return false;
+    M2 = floor_div(M2, a1);
+
+    // C.a = (-1)^(i-1) (R1^2 - C1 M2)
+    if (!mul_ok(Ca, R1, R1) || !mul_ok(temp, C1, M2))
+      return false;
+    if (C1 < 0) {
+      if (!sub_ok(Ca, Ca, temp))
+        return false;
+    }
+    else if (!sub_ok(Ca, temp, Ca))
+      return false;
+
+    // C.b = 2 (N R1 - C.a C2) / C1 - b1 (mod 2a)
+    if (!mul_ok(Cb, Ca, C2) || !mul_ok(temp, a1, R1) || !sub_ok(Cb, temp, Cb) || !add_ok(Cb, Cb, Cb))
+      return false;
+    Cb = floor_div(Cb, C1);
+    if (!sub_ok(Cb, Cb, b1) || !add_ok(temp, Ca, Ca))
+      return false;
+    Cb = floor_rem(Cb, temp);
+
+    // C.c = (C.b^2 - Delta) / 4 C.a
+    if (!mul_ok(Cc, Cb, Cb) || !sub_ok(Cc, Cc, Delta))
+      return false;
+    Cc = floor_div(Cc, Ca) / 4;
+
+    if (Ca < 0) {
+      Ca = -Ca;
+      Cc = -Cc;
+    }
+  }
+
+  if (!fits(Ca) || !fits(Cb) || !fits(Cc))
+    return false;
+
+  a = Ca;
+  b = Cb;
+  c = Cc;
+  return true;
+}
+
+
+
+//
+// QuadraticHybridOrder::reduce(), reduce_imag()
+//
+// Task: reduces (a, b, c) in place as ReducePlainImag<ZZ> resp.
+//       ReducePlainReal<ZZ>.  Returns false on overflow (a, b, c unchanged).
+//
+
+bool QuadraticHybridOrder::reduce (long & a, long & b, long & c) const
+{
+  return imaginary ? reduce_imag(a, b, c) : reduce_real(a, b, c);
+}
+
+bool QuadraticHybridOrder::reduce_imag (long & a, long & b, long & c) const
+{
+  long na, nb, nc, q, r, a2, temp;
+
+  na = a;
+  nb = b;
+  nc = c;
+
+  // normalize ideal
+  if (nb <= -na || nb > na) {
+    if (!add_ok(a2, na, na))
+      return false;
+
+    // q = b/2a
+    q = floor_div(nb, a2);
+    r = floor_rem(nb, a2);
+
+    if (r > na) {
+      r -= a2;
+      ++q;
+    }
+
+    // c -= q (b + r) / 2
+    if (!add_ok(temp, nb, r) || !mul_ok(temp, temp / 2, q) || !sub_ok(nc, nc, temp))
+      return false;
+
+    // b = r
+    nb = r;
+  }
+
+  // reduce
+  while (na > nc) {
+    a2 = nc << 1;
+
+    // -b = 2q * na + nb
+    q = floor_div(-nb, a2);
+    r = floor_rem(-nb, a2);
+
+    if (r > nc) {
+      r -= a2;
+      ++q;
+    }
+
+    // c = a - q * (nb - b)/2
+    if (!mul_ok(temp, (r - nb) / 2, q) || !sub_ok(temp, na, temp))
+      return false;
+
+    na = nc;
+    nb = r;
+    nc = temp;
+  }
+
+  // account for special case
+  if ((na == nc) && (nb < 0))
+    nb = -nb;
+
+  if (!fits(nc))
+    return false;
+
+  a = na;
+  b = nb;
+  c = nc;
+  return true;
+}
+
+
+
+//
+// QuadraticHybridOrder::is_normal_real(), is_reduced_real(), normalize_real()
+//
+// Task: as QuadraticIdealBase<ZZ>::is_normal(), is_reduced() and normalize()
+//       for real orders (Delta > 0)
+//
+
+bool QuadraticHybridOrder::is_normal_real (long a, long b) const
+{
+  long aa = (a < 0) ? -a : a;
+
+  if (aa > rootD)
+    return (-aa < b && b <= aa);
+  else
+    return (rootD - 2*aa < b && b <= rootD);
+}
+
+bool QuadraticHybridOrder::is_reduced_real (long a, long b) const
+{
+  long lbound = rootD - 2*((a < 0) ? -a : a);
+
+  if (lbound < 0)
+    lbound = -lbound;
+
+  return lbound < b && b <= rootD;
+}
+
+bool QuadraticHybridOrder::normalize_real (long & a, long & b, long & c) const
+{
+  long aa = (a < 0) ? -a : a;
+  long a2, s, temp, nb, nc;
+
+  // a2 = 2 |a|, s = floor((rootD - b) / 2|a|) sign(a) (a <= rootD), resp.
+  // s = floor((|a| - b) / 2|a|) sign(a)
+  a2 = 2*aa;
+  if (!sub_ok(temp, (a <= rootD) ? rootD : aa, b))
+    return false;
+  s = floor_div(temp, a2) * sign_of(a);
+
+  // c = a s^2 + b s + c, b = b + 2 s a
+  if (!mul_ok(temp, s, s) || !mul_ok(temp, temp, a) || !add_ok(nc, c, temp))
+    return false;
+  if (!mul_ok(temp, b, s) || !add_ok(nc, nc, temp))
+    return false;
+  if (!mul_ok(temp, a2 * sign_of(a), s) || !add_ok(nb, b, temp))
+    return false;
+
+  if (!fits(nb) || !fits(nc))
+    return false;
+
+  b = nb;
+  c = nc;
+  return true;
+}
+
+
+
+//
+// QuadraticHybridOrder::reduce_real()
+//
+
+bool QuadraticHybridOrder::reduce_real (long & a, long & b, long & c) const
+{
+  long na = a, nb = b, nc = c, temp;
+
+  // normalize ideal
+  if (!is_normal_real(na, nb) && !normalize_real(na, nb, nc))
+    return false;
+
+  // reduce
+  while (!is_reduced_real(na, nb)) {
+    temp = na;
+    na = nc;
+    nb = -nb;
+    nc = temp;
+
+    if (!normalize_real(na, nb, nc))
+      return false;
+  }
+
+  a = na;
+  b = nb;
+  c = nc;
+  return true;
+}
+
+
+
+//
+// QuadraticIdealHybrid
+//
+
+QuadraticIdealHybrid::QuadraticIdealHybrid (QuadraticHybridOrder & inHO)
+  : HO(&inHO),
+    word(false),
+    a(0), b(0), c(0),
+    I(*inHO.get_QO())
+{
+  assign_one();
+}
+
+QuadraticIdealHybrid::~QuadraticIdealHybrid () {}
+
+
+
+//
+// QuadraticIdealHybrid::assign_word(), demote()
+//
+// Task: stores (a, b, c) as words, resp. moves the ZZ representation to
+//       words if it fits (returns true in this case)
+//
+
+void QuadraticIdealHybrid::assign_word (long na, long nb, long nc)
+{
+  word = true;
+  a = na;
+  b = nb;
+  c = nc;
+}
+
+bool QuadraticIdealHybrid::demote ()
+{
+  if (word)
+    return true;
+
+  if (!HO->word || !QuadraticHybridOrder::fits(I.get_a()) ||
+      !QuadraticHybridOrder::fits(I.get_b()) || !QuadraticHybridOrder::fits(I.get_c()))
+    return false;
+
+  word = true;
+  conv(a, I.get_a());
+  conv(b, I.get_b());
+  conv(c, I.get_c());
+  return true;
+}
+
+
+
+//
+// QuadraticIdealHybrid::assign_one(), assign_prime(), assign()
+//
+
+void QuadraticIdealHybrid::assign_one ()
+{
+  if (HO->word) {
+    long nb = (floor_rem(HO->Delta, 4) == 1) ? 1 : 0;
+    assign_word(1, nb, (nb - HO->Delta) / 4);
+  }
+  else {
+    word = false;
+    I.assign_one();
+  }
+}
+
+bool QuadraticIdealHybrid::assign_prime (const ZZ & p)
+{
+  if (!I.assign_prime(p))
+    return false;
+
+  word = false;
+  demote();
+  return true;
+}
+
+void QuadraticIdealHybrid::assign (const QuadraticIdealHybrid & B)
+{
+  HO = B.HO;
+  word = B.word;
+  if (word)
+    assign_word(B.a, B.b, B.c);
+  else
+    I.assign(B.I);
+}
+
+void QuadraticIdealHybrid::assign (const QuadraticIdealBase<ZZ> & B)
+{
+  word = false;
+  I.assign(B);
+  demote();
+}
+
+void QuadraticIdealHybrid::assign (const ZZ & na, const ZZ & nb, const ZZ & nc)
+{
+  word = false;
+  I.assign(na, nb, nc);
+  demote();
+}
+
+QuadraticIdealHybrid & QuadraticIdealHybrid::operator = (const QuadraticIdealHybrid & B)
+{
+  assign(B);
+  return *this;
+}
+
+
+
+//
+// QuadraticIdealHybrid::get(), get_a(), get_b(), get_c()
+//
+
+void QuadraticIdealHybrid::get (QuadraticIdealBase<ZZ> & B) const
+{
+  if (word)
+    B.assign(to_ZZ(a), to_ZZ(b), to_ZZ(c));
+  else
+    B.assign(I);
+}
+
+ZZ QuadraticIdealHybrid::get_a () const { return word ? to_ZZ(a) : I.get_a(); }
+ZZ QuadraticIdealHybrid::get_b () const { return word ? to_ZZ(b) : I.get_b(); }
+ZZ QuadraticIdealHybrid::get_c () const { return word ? to_ZZ(c) : I.get_c(); }
+
+
+
+//
+// QuadraticIdealHybrid::reduce()
+//
+// Task: reduces the ideal
+//
+
+void QuadraticIdealHybrid::reduce ()
+{
+  if (word) {
+    if (HO->reduce(a, b, c)) {
+      ++HO->counters.red_word;
+      return;
+    }
+
+    ++HO->counters.red_promoted;
+    get(I);
+    word = false;
+  }
+  else
+    ++HO->counters.red_ZZ;
+
+  I.reduce();
+  if (demote())
+    ++HO->counters.demotions;
+}
+
+
+
+//
+// mul(), sqr()
+//
+// Task: C = reduced ideal equivalent to A B, resp. A^2.  Word arithmetic is
+//       used if A and B are word sized and it does not overflow.
+//
+
+void ANTL::mul (QuadraticIdealHybrid &C, const QuadraticIdealHybrid &A, const QuadraticIdealHybrid &B)
+{
+  QuadraticHybridOrder *HO = A.HO;
+  long Ca, Cb, Cc;
+
+  if (A.word && B.word) {
+    if (HO->nucomp(Ca, Cb, Cc, A.a, A.b, A.c, B.a, B.b, B.c) && HO->reduce(Ca, Cb, Cc)) {
+      ++HO->counters.mul_word;
+      C.HO = HO;
+      C.assign_word(Ca, Cb, Cc);
+      return;
+    }
+    ++HO->counters.mul_promoted;
+  }
+  else
+    ++HO->counters.mul_ZZ;
+
+  QuadraticIdealBase<ZZ> AZ(*HO->QO), BZ(*HO->QO);
+  A.get(AZ);
+  B.get(BZ);
+
+  // MultiplyNucomp<ZZ> reduces the result
+  HO->mul_nucomp.multiply(C.I, AZ, BZ);
+  C.HO = HO;
+  C.word = false;
+  if (C.demote())
+    ++HO->counters.demotions;
+}
+
+void ANTL::sqr (QuadraticIdealHybrid &C, const QuadraticIdealHybrid &A)
+{
+  QuadraticHybridOrder *HO = A.HO;
+  long Ca, Cb, Cc;
+
+  if (A.word) {
+    Ca = A.a;
+    Cb = A.b;
+    Cc = A.c;
+    if (HO->nudupl(Ca, Cb, Cc) && HO->reduce(Ca, Cb, Cc)) {
+      ++HO->counters.sqr_word;
+      C.HO = HO;
+      C.assign_word(Ca, Cb, Cc);
+      return;
+    }
+    ++HO->counters.sqr_promoted;
+  }
+  else
+    ++HO->counters.sqr_ZZ;
+
+  QuadraticIdealBase<ZZ> AZ(*HO->QO);
+  A.get(AZ);
+
+  HO->sqr_nudupl.square(C.I, AZ);
+  C.I.reduce();
+  C.HO = HO;
+  C.word = false;
+  if (C.demote())
+    ++HO->counters.demotions;
+}
+
+
+
+//
+// QuadraticIdealHybrid::IsOne(), IsEqual(), operator ==, operator !=
+//
+
+bool QuadraticIdealHybrid::IsOne () const
+{
+  return word ? (a == 1) : I.IsOne();
+}
+
+bool QuadraticIdealHybrid::IsEqual (const QuadraticIdealHybrid & B) const
+{
+  if (word && B.word)
+    return a == B.a && b == B.b;
+
+  return get_a() == B.get_a() && get_b() == B.get_b();
+}
+
+bool ANTL::operator == (const QuadraticIdealHybrid &A, const QuadraticIdealHybrid &B)
+{
+  return A.IsEqual(B);
+}
+
+bool ANTL::operator != (const QuadraticIdealHybrid &A, const QuadraticIdealHybrid &B)
+{
+  return !A.IsEqual(B);
+}
+
+
+
+//
+// operator <<
+//
+// Task: outputs the ideal as (a, b, c)
+//
+
+std::ostream & ANTL::operator << (std::ostream & out, const QuadraticIdealHybrid &A)
+{
+  if (A.word)
+    out << "(" << A.a << ", " << A.b << ", " << A.c << ")";
+  else
+    out << A.I;
+  return out;
+}
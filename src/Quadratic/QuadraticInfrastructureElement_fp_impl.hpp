@@ -0,0 +1,796 @@
+/**
+ * @file QuadraticInfrastructureElement_fp_impl.hpp
+ * @author Reginald Lybbert
+ * @remarks (f,p) representations of reduced ideals in real quadratic orders.
+ */
+
+//
+// constructors and destructor
+//
+
+template <class T> FPRepresentation<T>::FPRepresentation (QuadraticOrder<T> & inQO, long prec)
+{
+  assign_order(inQO, prec);
+}
+
+template <class T> FPRepresentation<T>::FPRepresentation (const FPRepresentation<T> & A)
+{
+  assign(A);
+}
+
+template <class T> FPRepresentation<T>::~FPRepresentation () {}
+
+template <class T> FPRepresentation<T> & FPRepresentation<T>::operator = (const FPRepresentation<T> &A)
+{
+  assign(A);
+  return *this;
+}
+
+
+
+//
+// FPRepresentation<T>::init_constants()
+//
+// Task:
+//      precomputes floor(sqrt(Delta)) and floor(sqrt(Delta) 2^s).  s = p+4
+//      guard bits keep the error of every baby step factor below 2^(-p-2).
+//
+
+template <class T> void FPRepresentation<T>::init_constants ()
+{
+  conv(Delta, QO->getDiscriminant());
+  SqrRoot(rootD, Delta);
+
+  s = p + 4;
+  SqrRoot(rootD_s, Delta << (2*s));
+}
+
+
+
+//
+// FPRepresentation<T>::assign_order()
+//
+// Task:
+//      switches to the order QO with precision prec and sets the
+//      representation to the order itself.  The coefficients keep their
+//      allocations.
+//
+
+template <class T> void FPRepresentation<T>::assign_order (QuadraticOrder<T> & inQO, long prec)
+{
+  QO = &inQO;
+  p = prec;
+  init_constants();
+  assign_one();
+}
+
+
+
+//
+// FPRepresentation<T>::assign_one()
+//
+// Task:
+//      sets the representation to the order itself with distance 0
+//
+
+template <class T> void FPRepresentation<T>::assign_one ()
+{
+  set(a);
+  if (IsOdd(Delta))
+    set(b);
+  else
+    clear(b);
+  normalize();
+  clear_distance();
+}
+
+
+
+//
+// FPRepresentation<T>::assign(A)
+//
+// Task:
+//      sets the representation to a reduced ideal equivalent to A.  The
+//      distance is measured from A.
+//
+
+template <class T> void FPRepresentation<T>::assign (const QuadraticIdealBase<T> &A)
+{
+  conv(a, A.get_a());
+  conv(b, A.get_b());
+  abs(a, a);
+  clear_distance();
+  reduce();
+}
+
+template <class T> void FPRepresentation<T>::assign (const FPRepresentation<T> &A)
+{
+  if (this == &A)
+    return;
+
+  QO = A.QO;
+  a = A.a;
+  b = A.b;
+  c = A.c;
+  d = A.d;
+  k = A.k;
+  p = A.p;
+  Delta = A.Delta;
+  rootD = A.rootD;
+  rootD_s = A.rootD_s;
+  s = A.s;
+}
+
+template <class T> void FPRepresentation<T>::assign (const ZZ & na, const ZZ & nb)
+{
+  a = na;
+  b = nb;
+  normalize();
+}
+
+
+
+//
+// FPRepresentation<T>::set_distance() / clear_distance()
+//
+// Task:
+//      sets theta = nd 2^(nk-p) (nd must be normalized), resp. theta = 1
+//
+
+template <class T> void FPRepresentation<T>::set_distance (const ZZ & nd, long nk)
+{
+  d = nd;
+  k = nk;
+}
+
+template <class T> void FPRepresentation<T>::clear_distance ()
+{
+  set(d);
+  d <<= p;
+  k = 0;
+}
+
+
+
+//
+// FPRepresentation<T>::add_distance(), sub_distance(), add_log()
+//
+// Task:
+//      theta = theta * nd 2^(nk-p),  theta = theta / (nd 2^(nk-p)), and
+//      theta = theta * x, resp.
+//
+
+template <class T> void FPRepresentation<T>::add_distance (const ZZ & nd, long nk)
+{
+  ZZ one;
+  set(one);
+  one <<= p;
+  scale(nd, one, nk);
+}
+
+template <class T> void FPRepresentation<T>::sub_distance (const ZZ & nd, long nk)
+{
+  ZZ one;
+  set(one);
+  one <<= p;
+  scale(one, nd, -nk);
+}
+
+template <class T> void FPRepresentation<T>::add_log (const ZZ & x)
+{
+  ZZ one;
+  set(one);
+  scale(x, one, 0);
+}
+
+
+
+//
+// FPRepresentation<T>::get_ideal(A)
+//
+// Task:
+//      copies the reduced ideal into A
+//
+
+template <class T> void FPRepresentation<T>::get_ideal (QuadraticIdealBase<T> &A) const
+{
+  T ta, tb, tc;
+  conv(ta, a);
+  conv(tb, b);
+  conv(tc, c);
+  A.assign(ta, tb, tc);
+}
+
+
+
+//
+// FPRepresentation<T>::distance()
+//
+// Task:
+//      returns log(theta) = log(d) + (k-p) log(2).  This is the only place
+//      where floating point arithmetic is used.
+//
+
+template <class T> RR FPRepresentation<T>::distance () const
+{
+  RRPush push;
+  RR::SetPrecision(p + NumBits(k) + 16);
+  return log(to_RR(d)) + to_RR(k - p)*log(to_RR(2));
+}
+
+
+
+//
+// FPRepresentation<T>::scale(num, den, e)
+//
+// Task:
+//      theta = theta * (num/den) 2^e, with num,den > 0.  The quotient is
+//      truncated to p+2 bits and the product renormalized to p+1 bits.
+//
+
+template <class T> void FPRepresentation<T>::scale (const ZZ & num, const ZZ & den, long e)
+{
+  ZZ q;
+  long t, sh;
+
+  t = p + 2 + NumBits(den) - NumBits(num);
+  if (t >= 0)
+    LeftShift(q, num, t);
+  else
+    RightShift(q, num, -t);
+  div(q, q, den);
+
+  mul(d, d, q);
+  sh = NumBits(d) - (p + 1);
+  if (sh >= 0)
+    RightShift(d, d, sh);
+  else
+    LeftShift(d, d, -sh);
+
+  k += e - t + sh;
+}
+
+
+
+//
+// FPRepresentation<T>::normalize()
+//
+// Task:
+//      normalizes b modulo 2a (sqrt(Delta) - 2a < b < sqrt(Delta) if
+//      a < sqrt(Delta), -a < b <= a otherwise) and recomputes c
+//
+
+template <class T> void FPRepresentation<T>::normalize ()
+{
+  ZZ a2, q, temp;
+
+  add(a2, a, a);
+  if (a <= rootD) {
+    sub(temp, rootD, b);
+    rem(temp, temp, a2);
+    sub(b, rootD, temp);
+  }
+  else {
+    sub(temp, a, b);
+    div(q, temp, a2);
+    mul(temp, q, a2);
+    add(b, b, temp);
+  }
+
+  sqr(temp, b);
+  sub(temp, temp, Delta);
+  LeftShift(a2, a, 2);
+  div(c, temp, a2);
+}
+
+
+
+//
+// FPRepresentation<T>::is_reduced()
+//
+// Task:
+//      returns true if the (normalized) ideal is reduced, i.e.,
+//      0 < b < sqrt(Delta) and sqrt(Delta) - b < 2a < sqrt(Delta) + b
+//
+
+template <class T> bool FPRepresentation<T>::is_reduced () const
+{
+  ZZ a2, temp;
+
+  if (sign(b) <= 0 || b > rootD)
+    return false;
+
+  add(a2, a, a);
+  sub(temp, rootD, b);
+  if (a2 <= temp)
+    return false;
+
+  add(temp, rootD, b);
+  return (a2 <= temp);
+}
+
+
+
+//
+// FPRepresentation<T>::reduce()
+//
+// Task:
+//      applies baby steps until the ideal is reduced.  theta is multiplied
+//      by the relative generator of the reduction.
+//
+
+template <class T> void FPRepresentation<T>::reduce ()
+{
+  normalize();
+  while (!is_reduced())
+    rho();
+}
+
+
+
+//
+// FPRepresentation<T>::rho()
+//
+// Task:
+//      one baby step:  with phi = (b + sqrt(Delta))/(2a) and q = floor(phi),
+//      the next ideal is [-C, (-B + sqrt(Delta))/2] with B = b - 2aq and
+//      C = (B^2 - Delta)/4a, and theta is multiplied by
+//      psi = 1/(phi - q) = (-B + sqrt(Delta))/(-2C).
+//
+//      psi is evaluated in fixed point from floor(sqrt(Delta) 2^s).  For
+//      -B < 0 the conjugate form psi = 2a/(sqrt(Delta) + B) is used to
+//      avoid cancellation.
+//
+
+template <class T> void FPRepresentation<T>::rho ()
+{
+  ZZ a2, q, B, C, num, den;
+
+  add(a2, a, a);
+  add(q, b, rootD);
+  div(q, q, a2);
+
+  mul(B, a2, q);
+  sub(B, b, B);
+
+  sqr(C, B);
+  sub(C, C, Delta);
+  LeftShift(num, a, 2);
+  div(C, C, num);
+
+  // new ideal is (-C, -B, -a)
+  NTL::negate(B, B);
+  if (sign(B) >= 0) {
+    LeftShift(num, B, s);
+    add(num, num, rootD_s);
+    LeftShift(den, C, 1);
+    abs(den, den);
+    scale(num, den, -s);
+  }
+  else {
+    LeftShift(num, a2, s);
+    LeftShift(den, B, s);
+    sub(den, rootD_s, den);
+    scale(num, den, 0);
+  }
+
+  abs(a, C);
+  b = B;
+  normalize();
+}
+
+
+
+//
+// FPRepresentation<T>::rho_inverse()
+//
+// Task:
+//      inverse baby step (the ideal must be reduced).  The previous ideal is
+//      obtained by conjugating, applying rho, and conjugating again, and
+//      theta is divided by psi = (b + sqrt(Delta))/2a of the current ideal.
+//
+
+template <class T> void FPRepresentation<T>::rho_inverse ()
+{
+  ZZ num, den, dd;
+  long kk;
+
+  LeftShift(num, b, s);
+  add(num, num, rootD_s);
+  add(den, a, a);
+  scale(den, num, s);
+
+  dd = d;
+  kk = k;
+
+  NTL::negate(b, b);
+  normalize();
+  rho();
+  NTL::negate(b, b);
+  normalize();
+
+  d = dd;
+  k = kk;
+}
+
+
+
+//
+// FPRepresentation<T>::mul_relative(x, y, z, u, v, w)
+//
+// Task:
+//      (x + y sqrt(Delta))/z = (x + y sqrt(Delta))/z * (u + v sqrt(Delta))/w,
+//      with common factors removed and z > 0
+//
+
+template <class T> void FPRepresentation<T>::mul_relative (ZZ & x, ZZ & y, ZZ & z, const ZZ & u, const ZZ & v, const ZZ & w) const
+{
+  ZZ nx, ny, temp, g;
+
+  mul(nx, x, u);
+  mul(temp, y, v);
+  mul(temp, temp, Delta);
+  add(nx, nx, temp);
+
+  mul(ny, x, v);
+  mul(temp, y, u);
+  add(ny, ny, temp);
+
+  mul(z, z, w);
+  x = nx;
+  y = ny;
+
+  GCD(g, x, y);
+  GCD(g, g, z);
+  if (!NTL::IsOne(g)) {
+    div(x, x, g);
+    div(y, y, g);
+    div(z, z, g);
+  }
+
+  if (sign(z) < 0) {
+    NTL::negate(x, x);
+    NTL::negate(y, y);
+    NTL::negate(z, z);
+  }
+}
+
+
+
+//
+// FPRepresentation<T>::rho(x, y, z), rho_inverse(x, y, z), reduce(x, y, z)
+//
+// Task:
+//      as rho(), rho_inverse(), and reduce(), but the exact relative
+//      generator (x + y sqrt(Delta))/z is multiplied by the factor of the
+//      step, i.e., psi = (-B + sqrt(Delta))/(-2C) for rho() and
+//      1/psi = (b - sqrt(Delta))/2c for rho_inverse().
+//
+
+template <class T> void FPRepresentation<T>::rho (ZZ & x, ZZ & y, ZZ & z)
+{
+  ZZ a2, q, B, C, one;
+
+  add(a2, a, a);
+  add(q, b, rootD);
+  div(q, q, a2);
+
+  mul(B, a2, q);
+  sub(B, b, B);
+
+  sqr(C, B);
+  sub(C, C, Delta);
+  LeftShift(a2, a, 2);
+  div(C, C, a2);
+
+  NTL::negate(B, B);
+  LeftShift(C, C, 1);
+  NTL::negate(C, C);
+  set(one);
+  mul_relative(x, y, z, B, one, C);
+
+  rho();
+}
+
+template <class T> void FPRepresentation<T>::rho_inverse (ZZ & x, ZZ & y, ZZ & z)
+{
+  ZZ one, c2;
+
+  set(one);
+  NTL::negate(one, one);
+  add(c2, c, c);
+  mul_relative(x, y, z, b, one, c2);
+
+  rho_inverse();
+}
+
+template <class T> void FPRepresentation<T>::reduce (ZZ & x, ZZ & y, ZZ & z)
+{
+  normalize();
+  while (!is_reduced())
+    rho(x, y, z);
+}
+
+
+
+//
+// FPRepresentation<T>::compare_distance()
+//
+// Task:
+//      returns -1, 0, 1 if theta is less than, equal to, or greater than
+//      the given value (td 2^(tk-p), td normalized).
+//
+
+template <class T> long FPRepresentation<T>::compare_distance (const ZZ & td, long tk) const
+{
+  if (k != tk)
+    return (k < tk) ? -1 : 1;
+  return compare(d, td);
+}
+
+template <class T> long FPRepresentation<T>::compare_distance (const FPRepresentation<T> &B) const
+{
+  return compare_distance(B.d, B.k);
+}
+
+
+
+//
+// FPRepresentation<T>::wnear()
+//
+// Task:
+//      moves the ideal along the cycle so that it is the reduced ideal
+//      closest to the left of the target distance, i.e.,
+//          theta <= target < theta psi(rho(b)).
+//      wnear(w) uses the target 2^w.
+//
+
+template <class T> void FPRepresentation<T>::wnear (const ZZ & td, long tk)
+{
+  while (compare_distance(td, tk) > 0)
+    rho_inverse();
+
+  FPRepresentation<T> next(*this);
+  next.rho();
+  while (next.compare_distance(td, tk) <= 0) {
+    assign(next);
+    next.rho();
+  }
+}
+
+template <class T> void FPRepresentation<T>::wnear (long w)
+{
+  ZZ td;
+  set(td);
+  td <<= p;
+  wnear(td, w);
+}
+
+
+
+//
+// FPRepresentation<T>::IsOne(), IsEqual()
+//
+// Task:
+//      compare the ideals only (distances are not compared)
+//
+
+template <class T> bool FPRepresentation<T>::IsOne () const
+{
+  return NTL::IsOne(a);
+}
+
+template <class T> bool FPRepresentation<T>::IsEqual (const FPRepresentation<T> &B) const
+{
+  return (a == B.a && b == B.b);
+}
+
+
+
+//
+// FPRepresentation<T>::compose(A, B)
+//
+// Task:
+//      sets the ideal to the primitive part of A*B (without reduction,
+//      Cohen Alg. 5.4.7) and theta to theta_A theta_B S, where S is the
+//      content of A*B.  The caller is responsible for reducing.
+//
+
+template <class T> void FPRepresentation<T>::compose (const FPRepresentation<T> &A, const FPRepresentation<T> &B, ZZ & S)
+{
+  ZZ s1, n, dd, d1, u, v, x2, y1, y2, v1, v2, r, temp, dB;
+  long kB;
+
+  dB = B.d;
+  kB = B.k;
+
+  if (&A == &B) {
+    // duplication:  y1 = 0, s = b, n = 0
+    XGCD(d1, u, v, A.b, A.a);
+    div(v1, A.a, d1);
+
+    mul(r, u, A.c);
+    NTL::negate(r, r);
+    rem(r, r, v1);
+
+    mul(temp, v1, r);
+    LeftShift(temp, temp, 1);
+    add(b, A.b, temp);
+    sqr(a, v1);
+  }
+  else {
+    add(s1, A.b, B.b);
+    RightShift(s1, s1, 1);
+    sub(n, B.b, s1);
+
+    XGCD(dd, y1, v, B.a, A.a);
+
+    if (divide(s1, dd)) {
+      set(y2);
+      NTL::negate(y2, y2);
+      clear(x2);
+      d1 = dd;
+    }
+    else {
+      XGCD(d1, x2, y2, s1, dd);
+      NTL::negate(y2, y2);
+    }
+
+    div(v1, A.a, d1);
+    div(v2, B.a, d1);
+
+    mul(r, y1, y2);
+    mul(r, r, n);
+    mul(temp, x2, B.c);
+    sub(r, r, temp);
+    rem(r, r, v1);
+
+    mul(temp, v2, r);
+    LeftShift(temp, temp, 1);
+    add(b, B.b, temp);
+    mul(a, v1, v2);
+  }
+
+  S = d1;
+
+  d = A.d;
+  k = A.k;
+  mul(dB, dB, d1);
+  LeftShift(temp, ZZ(1), p);
+  scale(dB, temp, kB);
+
+  normalize();
+}
+
+
+
+//
+// mul(C, A, B), sqr(C, A)
+//
+// Task:
+//      computes the (f,p) representation of the reduced product.  The
+//      distance of C is the sum of the distances of A and B plus the
+//      distance covered by the reduction.
+//
+
+template <class T> void ANTL::mul (FPRepresentation<T> &C, const FPRepresentation<T> &A, const FPRepresentation<T> &B)
+{
+  if (&C != &A) {
+    C.QO = A.QO;
+    C.p = A.p;
+    C.Delta = A.Delta;
+    C.rootD = A.rootD;
+    C.rootD_s = A.rootD_s;
+    C.s = A.s;
+  }
+
+  ZZ S;
+
+  C.compose(A, B, S);
+  C.reduce();
+}
+
+template <class T> void ANTL::sqr (FPRepresentation<T> &C, const FPRepresentation<T> &A)
+{
+  mul(C, A, A);
+}
+
+
+
+//
+// sqr(C, x, y, z, A)
+//
+// Task:
+//      as sqr(C, A), but also returns the exact relative generator
+//      gamma = (x + y sqrt(Delta))/z of the reduction, i.e.,
+//      theta_C = gamma theta_A^2.  gamma has small height (polynomial in
+//      Delta), which is used for compact representations.
+//
+
+template <class T> void ANTL::sqr (FPRepresentation<T> &C, ZZ & x, ZZ & y, ZZ & z, const FPRepresentation<T> &A)
+{
+  if (&C != &A) {
+    C.QO = A.QO;
+    C.p = A.p;
+    C.Delta = A.Delta;
+    C.rootD = A.rootD;
+    C.rootD_s = A.rootD_s;
+    C.s = A.s;
+  }
+
+  C.compose(A, A, x);
+  clear(y);
+  set(z);
+  C.reduce(x, y, z);
+}
+
+
+
+//
+// inv(C, A)
+//
+// Task:
+//      C is the conjugate of A (which is reduced), with theta_C = 1/(a theta_A)
+//
+
+template <class T> void ANTL::inv (FPRepresentation<T> &C, const FPRepresentation<T> &A)
+{
+  ZZ num, den;
+  long kA = A.k;
+
+  mul(den, A.a, A.d);
+  C.assign(A);
+
+  NTL::negate(C.b, C.b);
+  C.normalize();
+
+  C.clear_distance();
+  set(num);
+  num <<= C.p;
+  C.scale(num, den, -kA);
+}
+
+
+
+//
+// comparisons and output
+//
+
+template <class T> bool ANTL::operator == (const FPRepresentation<T> &A, const FPRepresentation<T> &B)
+{
+  return (A.IsEqual(B) && A.d == B.d && A.k == B.k && A.p == B.p);
+}
+
+template <class T> bool ANTL::operator != (const FPRepresentation<T> &A, const FPRepresentation<T> &B)
+{
+  return !(A == B);
+}
+
+template <class T> std::ostream & ANTL::operator << (std::ostream & out, const FPRepresentation<T> &A)
+{
+  out << "([" << A.a << ", " << A.b << ", " << A.c << "], " << A.d << ", " << A.k << ")";
+  return out;
+}
+
+
+
+//
+// regulator_fp(R, QO, prec)
+//
+// Task:
+//      computes the regulator of a real quadratic order by walking the
+//      principal cycle with prec-bit (f,p) arithmetic.  Only the final
+//      conversion of theta uses RR.  O(sqrt(Delta)) baby steps, so this is
+//      only suitable for small discriminants.
+//
+
+template <class T> void ANTL::regulator_fp (RR & R, QuadraticOrder<T> & QO, long prec)
+{
+  FPRepresentation<T> A(QO, prec);
+
+  do {
+    A.rho();
+  } while (!A.IsOne());
+
+  R = A.distance();
+}
@@ -0,0 +1,94 @@
+/**
+ * @file QuadraticOrder_GF2nX.cpp
+ * @remark Quadratic order function specializations (GF2nX base type).
+ */
+
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+
+namespace ANTL
+{
+  //
+  // QuadraticOrder<GF2nX>::QuadraticOrder(const T & f, const T & h)
+  //
+  // Task:
+  //    set to the quadratic order defined by y^2 + h y = f.
+  //
+
+  template <>
+  QuadraticOrder<GF2nX>::QuadraticOrder(const GF2nX & newf, const GF2nX & newh)
+  {
+    // degree must be >= 3
+    if (deg (newf) >= 3) {
+      Delta = newf;
+      hx = newh;
+
+      // compute genus
+      if (IsReal())
+        g = deg(hx) - 1;
+      else if (deg(Delta) & 1)
+        g = (deg(Delta) - 1) >> 1;
+      else
+        g = (deg(Delta) >> 1) - 1;
+    }
+  }
+
+
+  //
+  // QuadraticOrder<GF2nX>::IsImaginary()
+  //
+  // Task:
+  //      returns true if the function field is imaginary
+  //
+
+  template <>
+  bool
+  QuadraticOrder < GF2nX >::IsImaginary () const
+  {
+    return ((deg (Delta) & 1) && (deg(hx) <= ((deg(Delta)-1) >> 1)));
+  }
+
+
+
+  //
+  // QuadraticOrder<GF2nX>::IsReal()
+  //
+  // Task:
+  //      returns true if the function field is real, i.e., deg f < 2 deg h,
+  //      or deg f = 2 deg h and z^2 + z = lc(f)/lc(h)^2 has a solution in
+  //      GF(2^n) (the infinite place splits)
+  //
+
+  template <>
+  bool
+  QuadraticOrder < GF2nX >::IsReal () const
+  {
+    GF2n lc, z;
+
+    if (deg(Delta) < 2*deg(hx))
+      return true;
+    if ((deg(Delta) & 1) || deg(hx) != (deg(Delta) >> 1))
+      return false;
+
+    sqr(lc, LeadCoeff(hx));
+    div(lc, LeadCoeff(Delta), lc);
+    return SolveArtinSchreier(z, lc);
+  }
+
+
+
+  //
+  // QuadraticOrder<GF2nX>::IsUnusual()
+  //
+  // Task:
+  //      returns true if the function field is unusual (the infinite place
+  //      is inert)
+  //
+
+  template <>
+  bool
+  QuadraticOrder < GF2nX >::IsUnusual () const
+  {
+    return (!(deg(Delta) & 1) && !IsReal());
+  }
+
+} // ANTL
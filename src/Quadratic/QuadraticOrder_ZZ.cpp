@@ -4,6 +4,7 @@
  */
 
 #include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/Regulator/RegulatorBSGS.hpp>
 
 using namespace ANTL;
 
@@ -79,6 +80,29 @@ using namespace ANTL;
   }
 
 
+
+  //
+  // QuadraticOrder<ZZ>::regulator()
+  //
+  // Task:
+  //      returns the regulator of a real quadratic order (0 otherwise),
+  //      computed to 64 bits after the binary point with the
+  //      baby-step giant-step algorithm in (f,p) arithmetic.
+  //
+
+  template <> RR QuadraticOrder < ZZ >::regulator ()
+  {
+    RR R;
+
+    if (IsReal()) {
+      RegulatorBSGS<ZZ> bsgs(*this, 64);
+      bsgs.regulator(R);
+    }
+
+    return R;
+  }
+
+
   /*
   //
   // randomImaginaryOrder
@@ -0,0 +1,519 @@
+/**
+ * @file ClassGroupRank_impl.hpp
+ * @remarks p-ranks of class groups of quadratic orders for small p.
+ */
+
+//
+// constructor and destructor
+//
+
+template <class T> ClassGroupRank<T>::ClassGroupRank (QuadraticOrder<T> & inQO)
+  : QO(&inQO),
+    factored(false),
+    num_chars(0),
+    all_plus(true),
+    samples(20),
+    smooth(0),
+    max_size(59049),
+    discarded(0)
+{
+  conv(Delta, QO->getDiscriminant());
+
+  mul_nucomp.init(QO->getDiscriminant(), QO->getH());
+  sqr_nudupl.init(QO->getDiscriminant(), QO->getH());
+  cube_nucube.init(QO->getDiscriminant(), QO->getH());
+}
+
+template <class T> ClassGroupRank<T>::~ClassGroupRank () {}
+
+
+
+//
+// ClassGroupRank<T>::pollard_brent()
+//
+// Task:
+//      finds a non-trivial factor f of the odd composite n with Brent's
+//      variant of Pollard's rho method
+//
+
+template <class T> void ClassGroupRank<T>::pollard_brent (ZZ & f, const ZZ & n)
+{
+  ZZ x, y, ys, q, t;
+  long r, i, k, m = 128;
+
+  for (long c = 1; ; ++c) {
+    y = 2;
+    set(q);
+    set(f);
+    r = 1;
+
+    do {
+      x = y;
+      for (i = 0; i < r; ++i) {
+        SqrMod(y, y, n);
+        AddMod(y, y, c, n);
+      }
+
+      k = 0;
+      do {
+        ys = y;
+        for (i = 0; i < m && i < r - k; ++i) {
+          SqrMod(y, y, n);
+          AddMod(y, y, c, n);
+          SubMod(t, x, y, n);
+          MulMod(q, q, t, n);
+        }
+        GCD(f, q, n);
+        k += m;
+      } while (k < r && IsOne(f));
+
+      r <<= 1;
+    } while (IsOne(f));
+
+    if (f == n) {
+      // backtrack from ys
+      do {
+        SqrMod(ys, ys, n);
+        AddMod(ys, ys, c, n);
+        SubMod(t, x, ys, n);
+        GCD(f, t, n);
+      } while (IsOne(f));
+    }
+
+    if (f != n)
+      return;
+  }
+}
+
+
+
+//
+// ClassGroupRank<T>::factor()
+//
+// Task:
+//      appends the distinct prime divisors of the odd integer n > 0 to fact
+//      (trial division by the primes in PrimeTable, then Pollard-Brent rho)
+//
+
+template <class T> void ClassGroupRank<T>::factor (std::vector<ZZ> & fact, const ZZ & n)
+{
+  static const long bound = 1L << 16;
+  ZZ m, f;
+  long i, j, np;
+
+  m = n;
+
+  const std::vector<long> & P = PrimeTable::primes(bound);
+  np = PrimeTable::count(bound);
+  for (i = 1; i < np && !IsOne(m); ++i) {
+    if (divide(m, P[i])) {
+      fact.push_back(ZZ(P[i]));
+      while (divide(m, m, P[i]));
+    }
+    if (m < P[i]*P[i]) {
+      if (!IsOne(m)) {
+        fact.push_back(m);
+        set(m);
+      }
+      break;
+    }
+  }
+
+  if (IsOne(m))
+    return;
+
+  // all remaining prime factors are > bound
+  std::vector<ZZ> todo(1, m);
+  while (!todo.empty()) {
+    m = todo.back();
+    todo.pop_back();
+
+    if (ProbPrime(m)) {
+      for (j = 0; j < (long) fact.size() && fact[j] != m; ++j);
+      if (j == (long) fact.size())
+        fact.push_back(m);
+      continue;
+    }
+
+    pollard_brent(f, m);
+    todo.push_back(f);
+    todo.push_back(m / f);
+  }
+}
+
+
+
+//
+// ClassGroupRank<T>::genus()
+//
+// Task:
+//      determines the generic characters of Delta.  For Delta = 1 mod 4,
+//      these are (./p) for the odd primes p | Delta.  For Delta = -4n,
+//      delta = (-1/.) and/or epsilon = (2/.) are added:
+//          n = 3 mod 4:  none,          n = 1 mod 4:  delta,
+//          n = 2 mod 8:  delta epsilon, n = 6 mod 8:  epsilon,
+//          n = 4 mod 8:  delta,         n = 0 mod 8:  delta, epsilon.
+//      The values on -1 are (-1/p) = (-1)^((p-1)/2), delta(-1) = -1,
+//      epsilon(-1) = 1, delta epsilon(-1) = -1.
+//
+
+template <class T> void ClassGroupRank<T>::genus ()
+{
+  ZZ m;
+  long n8, i;
+
+  if (factored)
+    return;
+
+  primes.clear();
+  abs(m, Delta);
+  MakeOdd(m);
+  if (!IsOne(m))
+    factor(primes, m);
+
+  num_chars = primes.size();
+  all_plus = true;
+  for (i = 0; i < (long) primes.size(); ++i)
+    if (rem(primes[i], 4) == 3)
+      all_plus = false;
+
+  if (!IsOdd(Delta)) {
+    // n = -Delta/4 mod 8
+    n8 = rem(-Delta, 32) >> 2;
+
+    switch (n8) {
+    case 1: case 5: case 4:
+      // delta
+      ++num_chars;
+      all_plus = false;
+      break;
+    case 2:
+      // delta epsilon
+      ++num_chars;
+      all_plus = false;
+      break;
+    case 6:
+      // epsilon
+      ++num_chars;
+      break;
+    case 0:
+      // delta and epsilon
+      num_chars += 2;
+      all_plus = false;
+      break;
+    default:
+      break;
+    }
+  }
+
+  factored = true;
+}
+
+
+
+//
+// ClassGroupRank<T>::get_prime_divisors()
+//
+// Task:
+//      returns the odd primes dividing Delta
+//
+
+template <class T> const std::vector<ZZ> & ClassGroupRank<T>::get_prime_divisors ()
+{
+  genus();
+  return primes;
+}
+
+
+
+//
+// ClassGroupRank<T>::narrow_two_rank(), two_rank()
+//
+// Task:
+//      returns the 2-rank of the narrow class group (mu - 1), resp. of the
+//      class group.  For imaginary orders, both agree.  For real orders,
+//      the class group is the narrow class group modulo the class of
+//      (sqrt(Delta)), which is a square in the narrow class group if and
+//      only if all generic characters are 1 on -1.
+//
+
+template <class T> long ClassGroupRank<T>::narrow_two_rank ()
+{
+  genus();
+  return num_chars - 1;
+}
+
+template <class T> long ClassGroupRank<T>::two_rank ()
+{
+  genus();
+
+  if (NTL::sign(Delta) < 0 || all_plus)
+    return num_chars - 1;
+  else
+    return num_chars - 2;
+}
+
+
+
+//
+// ClassGroupRank<T>::lookup(), insert()
+//
+// Task:
+//      returns the index of the reduced ideal A in the enumerated subgroup H
+//      (-1 if A is not in H), resp. appends A with exponent vector e to H
+//
+
+template <class T> long ClassGroupRank<T>::lookup (const QuadraticIdealBase<T> &A) const
+{
+  ZZ a;
+
+  conv(a, A.get_a());
+
+  auto range = table.equal_range(a);
+  for (auto it = range.first; it != range.second; ++it)
+    if (H[it->second].get_b() == A.get_b())
+      return it->second;
+
+  return -1;
+}
+
+template <class T> void ClassGroupRank<T>::insert (const QuadraticIdealBase<T> &A, const std::vector<long> &e)
+{
+  ZZ a;
+
+  conv(a, A.get_a());
+  table.insert(std::make_pair(a, (long) H.size()));
+  H.push_back(A);
+  coords.push_back(e);
+}
+
+
+
+//
+// ClassGroupRank<T>::rank_mod3()
+//
+// Task:
+//      returns the rank over F_3 of the matrix whose rows are R (entries
+//      mod 3, rows of length at most n, missing entries are 0).  R is
+//      overwritten.
+//
+
+template <class T> long ClassGroupRank<T>::rank_mod3 (std::vector< std::vector<long> > & R, long n)
+{
+  long i, j, c, r, f;
+
+  for (i = 0; i < (long) R.size(); ++i) {
+    R[i].resize(n, 0);
+    for (c = 0; c < n; ++c)
+      R[i][c] = ((R[i][c] % 3) + 3) % 3;
+  }
+
+  r = 0;
+  for (c = 0; c < n && r < (long) R.size(); ++c) {
+    for (i = r; i < (long) R.size() && R[i][c] == 0; ++i);
+    if (i == (long) R.size())
+      continue;
+    swap(R[r], R[i]);
+
+    // normalize the pivot to 1 (2 = -1 is its own inverse)
+    if (R[r][c] == 2)
+      for (j = c; j < n; ++j)
+        R[r][j] = (3 - R[r][j]) % 3;
+
+    for (i = r + 1; i < (long) R.size(); ++i) {
+      f = R[i][c];
+      if (f != 0)
+        for (j = c; j < n; ++j)
+          R[i][j] = (R[i][j] + 2*f*R[r][j]) % 3;
+    }
+    ++r;
+  }
+
+  return r;
+}
+
+
+
+//
+// ClassGroupRank<T>::power(), cube()
+//
+// Task:
+//      C = A^n (left-to-right binary with NUDUPL and NUCOMP), resp.
+//      C = A^3 (NUCUBE), reduced
+//
+
+template <class T> void ClassGroupRank<T>::power (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A, const ZZ & n)
+{
+  QuadraticIdealBase<T> B(*QO);
+  B.assign(A);
+
+  C.assign_one();
+  for (long i = NumBits(n) - 1; i >= 0; --i) {
+    sqr_nudupl.square(C, C);
+    C.reduce();
+
+    if (bit(n, i)) {
+      mul_nucomp.multiply(C, C, B);
+      C.reduce();
+    }
+  }
+}
+
+template <class T> void ClassGroupRank<T>::cube (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A)
+{
+  cube_nucube.cube(C, A);
+  C.reduce();
+}
+
+
+
+//
+// ClassGroupRank<T>::three_rank()
+//
+// Task:
+//      returns a lower bound for the 3-rank of the class group (exact if
+//      the samples generate the 3-Sylow subgroup).  The prime ideals of
+//      norm p for the first primes p (not dividing Delta) are used as
+//      samples.  Each sample that enlarges H contributes a generator and
+//      a relation; the rank is the number of generators minus the rank of
+//      the relations over F_3.  Real orders use the generic method.
+//
+
+template <class T> long ClassGroupRank<T>::three_rank ()
+{
+  ZZ M, hmax, pe, t;
+  long nD, hbits, B, K, i, j, l, np, cnt, r, used, ngen;
+
+  if (!QO->IsImaginary())
+    return p_rank(3);
+
+  // h < sqrt(|Delta|) (log|Delta| + 2) / pi < 2^hbits
+  nD = NumBits(Delta);
+  hbits = (nD + 1)/2 + NumBits(nD);
+  power2(hmax, hbits);
+
+  B = smooth;
+  if (B <= 0)
+    B = (hbits >= 12) ? (1L << 12) : (1L << hbits);
+
+  // M = prod p^e, p <= B, p != 3, p^e < hmax
+  set(M);
+  const std::vector<long> & P = PrimeTable::primes(B);
+  np = PrimeTable::count(B);
+  for (i = 0; i < np; ++i) {
+    if (P[i] == 3)
+      continue;
+    conv(pe, P[i]);
+    while (pe * P[i] < hmax)
+      pe *= P[i];
+    M *= pe;
+  }
+
+  // 3^K > hmax
+  set(t);
+  for (K = 0; t <= hmax; ++K)
+    t *= 3;
+
+  QuadraticIdealBase<T> A(*QO), G(*QO), X(*QO), C(*QO);
+  std::vector< std::vector<long> > rel;
+  std::vector<long> e;
+  T q;
+
+  H.clear();
+  coords.clear();
+  table.clear();
+  discarded = 0;
+  ngen = 0;
+
+  A.assign_one();
+  insert(A, e);
+
+  set(q);
+  for (used = 0; used < samples && (long) H.size() < max_size; ) {
+    q = NextPrime(q + 1);
+    if (divide(Delta, q) || !A.assign_prime(q))
+      continue;
+    A.reduce();
+    ++used;
+
+    // G = A^M is in the 3-Sylow subgroup if h/3^v is B-smooth
+    power(G, A, M);
+    if (G.IsOne())
+      continue;
+
+    // smallest 3^j with G^(3^j) in H
+    X.assign(G);
+    for (j = 0; j <= K; ++j) {
+      if ((l = lookup(X)) >= 0)
+        break;
+      cube(X, X);
+    }
+
+    if (j > K) {
+      ++discarded;
+      continue;
+    }
+
+    if (j == 0)
+      continue;
+
+    // H = H <G>, |H| is multiplied by 3^j
+    for (cnt = 1, i = 0; i < j; ++i)
+      cnt *= 3;
+    if ((long) H.size() * cnt > max_size)
+      break;
+
+    // relation G^(3^j) = prod g_i^(e_i), i.e., (-e, 3^j) = (-e, 0) mod 3
+    rel.push_back(coords[l]);
+    for (i = 0; i < (long) rel.back().size(); ++i)
+      rel.back()[i] = -rel.back()[i];
+
+    long hsize = H.size();
+    X.assign(G);
+    for (i = 1; i < cnt; ++i) {
+      for (r = 0; r < hsize; ++r) {
+        mul_nucomp.multiply(C, H[r], X);
+        C.reduce();
+        e = coords[r];
+        e.resize(ngen + 1, 0);
+        e[ngen] = i;
+        insert(C, e);
+      }
+      mul_nucomp.multiply(X, X, G);
+      X.reduce();
+    }
+    ++ngen;
+  }
+
+  // H/H^3 = F_3^ngen / (relations mod 3)
+  return ngen - rank_mod3(rel, ngen);
+}
+
+
+
+//
+// ClassGroupRank<T>::p_rank()
+//
+// Task:
+//      returns the p-rank of the class group.  For p = 2 and p = 3, genus
+//      theory and three_rank() are used; otherwise the invariants of the
+//      class group of the order are counted.
+//
+
+template <class T> long ClassGroupRank<T>::p_rank (long p)
+{
+  if (p == 2)
+    return two_rank();
+
+  if (p == 3 && QO->IsImaginary())
+    return three_rank();
+
+  std::vector<ZZ> CL = QO->class_group();
+  long r = 0;
+
+  for (long i = 0; i < (long) CL.size(); ++i)
+    if (divide(CL[i], p))
+      ++r;
+
+  return r;
+}
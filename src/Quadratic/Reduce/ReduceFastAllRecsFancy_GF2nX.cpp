@@ -0,0 +1,10 @@
+/**
+ * @file ReduceFastAllRecsFancy_GF2nX.cpp
+ * @remark Specialization of the ReduceFastAllRecsFancy class for GF2nX.
+ */
+
+#include <ANTL/Quadratic/Reduce/ReduceFastAllRecsFancy.hpp>
+
+template <> void ReduceFastAllRecsFancy<GF2nX>::reduce(QuadraticIdealBase<GF2nX> & A) {
+  reduce_char2(A);
+}
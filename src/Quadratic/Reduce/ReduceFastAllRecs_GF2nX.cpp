@@ -0,0 +1,10 @@
+/**
+ * @file ReduceFastAllRecs_GF2nX.cpp
+ * @remark Specialization of the ReduceFastAllRecs class for GF2nX.
+ */
+
+#include <ANTL/Quadratic/Reduce/ReduceFastAllRecs.hpp>
+
+template <> void ReduceFastAllRecs<GF2nX>::reduce(QuadraticIdealBase<GF2nX> & A) {
+  reduce_char2(A);
+}
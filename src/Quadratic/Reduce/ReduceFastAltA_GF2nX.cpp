@@ -0,0 +1,10 @@
+/**
+ * @file ReduceFastAltA_GF2nX.cpp
+ * @remark Specialization of the ReduceFastAltA class for GF2nX.
+ */
+
+#include <ANTL/Quadratic/Reduce/ReduceFastAltA.hpp>
+
+template <> void ReduceFastAltA<GF2nX>::reduce(QuadraticIdealBase<GF2nX> & A) {
+  reduce_char2(A);
+}
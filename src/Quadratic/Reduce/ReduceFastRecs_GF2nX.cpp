@@ -0,0 +1,10 @@
+/**
+ * @file ReduceFastRecs_GF2nX.cpp
+ * @remark Specialization of the ReduceFastRecs class for GF2nX.
+ */
+
+#include <ANTL/Quadratic/Reduce/ReduceFastRecs.hpp>
+
+template <> void ReduceFastRecs<GF2nX>::reduce(QuadraticIdealBase<GF2nX> & A) {
+  reduce_char2(A);
+}
@@ -0,0 +1,10 @@
+/**
+ * @file ReduceFast_GF2nX.cpp
+ * @remark Specialization of the ReduceFast class for GF2nX.
+ */
+
+#include <ANTL/Quadratic/Reduce/ReduceFast.hpp>
+
+template <> void ReduceFast<GF2nX>::reduce(QuadraticIdealBase<GF2nX> & A) {
+  reduce_char2(A);
+}
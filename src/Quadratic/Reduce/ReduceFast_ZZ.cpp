@@ -15,7 +15,7 @@ template <> void ReduceFast<ZZ>::init(const ZZ & delta_in, const ZZ & h_in, long
 
 
 template <> void ReduceFast<ZZ>::reduce(QuadraticIdealBase<ZZ> & A) {
-  static ZZ a, b, c, na, nb, q, r, a2, temp;
+  static thread_local ZZ a, b, c, na, nb, q, r, a2, temp;
 
   a = A.get_a();
   b = A.get_b();
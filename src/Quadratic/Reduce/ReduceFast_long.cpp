@@ -15,7 +15,7 @@ template <> void ReduceFast<long>::init(const long & delta_in, const long & h_in
 
 
 template <> void ReduceFast<long>::reduce(QuadraticIdealBase<long> & A) {
-  static long a, b, c, na, nb, q, r, a2, temp;
+  static thread_local long a, b, c, na, nb, q, r, a2, temp;
 
   a = A.get_a();
   b = A.get_b();
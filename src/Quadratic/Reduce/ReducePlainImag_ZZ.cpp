@@ -11,7 +11,7 @@
 // Task: reduces the ideal
 
 template <> void ReducePlainImag<ZZ>::reduce(QuadraticIdealBase<ZZ> & A) {
-  static ZZ a, b, c, na, nb, q, r, a2, temp;
+  static thread_local ZZ a, b, c, na, nb, q, r, a2, temp;
 
   a = A.get_a();
   b = A.get_b();
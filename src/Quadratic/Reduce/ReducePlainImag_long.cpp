@@ -11,7 +11,7 @@
 // Task: reduces the ideal
 
 template <> void ReducePlainImag<long>::reduce(QuadraticIdealBase<long> & A) {
-  static long a, b, c, na, nb, q, r, a2, temp;
+  static thread_local long a, b, c, na, nb, q, r, a2, temp;
 
   a = A.get_a();
   b = A.get_b();
@@ -30,7 +30,7 @@ template <> void ReducePlainImag<long>::reduce(QuadraticIdealBase<long> & A) {
     }
 
     // c -= q (b + r) / 2
-    c -= q*(b+2) >> 1;
+    c -= q*(b+r) >> 1;
 
     // b = r
     b = r;
@@ -52,7 +52,7 @@ template <> void ReducePlainImag<long>::reduce(QuadraticIdealBase<long> & A) {
       }
 
     // c = a - q * (nb - b)/2
-    c = a - q*(nb - b) >> 1;
+    c = a - (q*(nb - b) >> 1);
 
     b = nb;
     a = na;
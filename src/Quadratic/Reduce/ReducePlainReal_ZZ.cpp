@@ -10,7 +10,7 @@
 //
 // Task: reduces the ideal
 template <> void ReducePlainReal<ZZ>::reduce(QuadraticIdealBase<ZZ> & A) {
-  static ZZ a, b, c;
+  static thread_local ZZ a, b, c;
 
   // normalize ideal
   if (!A.is_normal()) {
@@ -10,7 +10,7 @@
 //
 // Task: reduces the ideal
 template <> void ReducePlainReal<long>::reduce(QuadraticIdealBase<long> & A) {
-  static long a, b, c;
+  static thread_local long a, b, c;
 
   // normalize ideal
   if (!A.is_normal()) {
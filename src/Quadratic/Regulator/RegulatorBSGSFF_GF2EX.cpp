@@ -0,0 +1,46 @@
+/**
+ * @file RegulatorBSGSFF_GF2EX.cpp
+ * @remark Specialization of the RegulatorBSGSFF class for GF2EX.
+ */
+
+#include <ANTL/Quadratic/Regulator/RegulatorBSGSFF.hpp>
+
+//
+// RegulatorBSGSFF<GF2EX>::root()
+//
+// Task:
+//      computes the polynomial part d of the root y of y^2 + h y = f, i.e.,
+//      the polynomial of degree <= g+1 with deg(d^2 + h d + f) <= g, and
+//      t = h + d.  d_{g+1} is a root of z^2 + lc(h) z + f_{2g+2} (0 if
+//      deg f < 2g+2), and d_j = [x^(g+1+j)](d^2 + h d + f) / lc(h).
+//
+
+template <> void RegulatorBSGSFF<GF2EX>::root ()
+{
+  GF2EX P, temp, hd;
+  GF2E z, ilc;
+  long j;
+
+  clear(z);
+  if (deg(f) == 2*g + 2) {
+    SetCoeff(P, 2);
+    SetCoeff(P, 1, LeadCoeff(h));
+    SetCoeff(P, 0, LeadCoeff(f));
+    FindRoot(z, P);
+  }
+
+  inv(ilc, LeadCoeff(h));
+
+  clear(d);
+  SetCoeff(d, g + 1, z);
+  for (j = g; j >= 0; --j) {
+    sqr(temp, d);
+    mul(hd, h, d);
+    add(temp, temp, hd);
+    add(temp, temp, f);
+    mul(z, coeff(temp, g + 1 + j), ilc);
+    SetCoeff(d, j, z);
+  }
+
+  add(t, h, d);
+}
@@ -0,0 +1,525 @@
+/**
+ * @file RegulatorBSGSFF_impl.hpp
+ * @remarks baby-step giant-step regulator computation for real hyperelliptic
+ *          function fields.
+ */
+
+//
+// constructor and destructor
+//
+
+template <class T> RegulatorBSGSFF<T>::RegulatorBSGSFF (QuadraticOrder<T> & inQO)
+  : QO(&inQO),
+    Lpoly(inQO),
+    num_baby(0),
+    computed(false),
+    full_cycle(false),
+    R(0),
+    giant_steps(0)
+{
+  f = QO->getDiscriminant();
+  h = QO->getH();
+  g = QO->getGenus();
+
+  if (QO->IsReal())
+    root();
+}
+
+template <class T> RegulatorBSGSFF<T>::~RegulatorBSGSFF () {}
+
+
+
+//
+// RegulatorBSGSFF<T>::set_baby_steps()
+//
+// Task:
+//      sets the minimal number of baby steps (0 = about sqrt(L(1)/2))
+//
+
+template <class T> void RegulatorBSGSFF<T>::set_baby_steps (long m)
+{
+  num_baby = m;
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::root()
+//
+// Task:
+//      computes the polynomial part d of y = sqrt(f), i.e., the polynomial
+//      of degree g+1 with deg(f - d^2) <= g, and t = h + d.  The coefficients
+//      are determined from the top:  d_{g+1} = sqrt(lc(f)), and
+//      d_j = [x^(g+1+j)](f - d^2) / (2 d_{g+1}).
+//
+
+template <class T> void RegulatorBSGSFF<T>::root ()
+{
+  T temp;
+  ZZ c;
+  long j;
+
+  auto lc = LeadCoeff(f);
+  conv(c, rep(lc));
+  SqrRootMod(c, c, CARDINALITY<T>());
+  conv(lc, c);
+
+  auto inv2c = lc + lc;
+  inv(inv2c, inv2c);
+
+  clear(d);
+  SetCoeff(d, g + 1, lc);
+  for (j = g; j >= 0; --j) {
+    sqr(temp, d);
+    sub(temp, f, temp);
+    mul(lc, coeff(temp, g + 1 + j), inv2c);
+    SetCoeff(d, j, lc);
+  }
+
+  add(t, h, d);
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::normalize()
+//
+// Task:
+//      reduces b modulo a such that deg(b - t) < deg a
+//
+
+template <class T> void RegulatorBSGSFF<T>::normalize (T & b, const T & a) const
+{
+  T r;
+
+  sub(r, t, b);
+  rem(r, r, a);
+  sub(b, t, r);
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::degree_y()
+//
+// Task:
+//      returns deg(b + y), where a c = b^2 - b h - f.  If b + d = 0, then
+//      deg(b + y) < 0, and deg(b + y) = deg a + deg c - deg(b - h - y),
+//      with deg(b - h - y) = deg(b - t).
+//
+
+template <class T> long RegulatorBSGSFF<T>::degree_y (const T & a, const T & b, const T & c) const
+{
+  T u;
+
+  add(u, b, d);
+  if (!IsZero(u))
+    return deg(u);
+
+  sub(u, b, t);
+  return deg(a) + deg(c) - deg(u);
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::rho()
+//
+// Task:
+//      baby step:  [a, b + y] -> [c, h - b + y] with c = (b^2 - b h - f)/a
+//      made monic.  The distance increases by deg((b + y)/a).
+//
+
+template <class T> void RegulatorBSGSFF<T>::rho (Element & A) const
+{
+  T c, temp;
+
+  normalize(A.b, A.a);
+
+  // c = (b^2 - b h - f)/a
+  sqr(c, A.b);
+  mul(temp, A.b, h);
+  sub(c, c, temp);
+  sub(c, c, f);
+  div(c, c, A.a);
+
+  A.d += degree_y(A.a, A.b, c) - deg(A.a);
+
+  MakeMonic(c);
+  A.a = c;
+  sub(A.b, h, A.b);
+  normalize(A.b, A.a);
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::reduce()
+//
+// Task:
+//      reduces A (deg a <= g) with baby steps
+//
+
+template <class T> void RegulatorBSGSFF<T>::reduce (Element & A) const
+{
+  normalize(A.b, A.a);
+  while (deg(A.a) > g)
+    rho(A);
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::compose()
+//
+// Task:
+//      C = reduced A B.  With S = gcd(a1, a2, b1 + b2 - h) = u1 a1 + u2 a2
+//      + u3 (b1 + b2 - h), the product is S [a3, b3 + y], where
+//         a3 = a1 a2 / S^2,
+//         b3 = (u1 a1 b2 + u2 a2 b1 + u3 (b1 b2 + f)) / S  (mod a3),
+//      at distance d1 + d2 - deg S.
+//
+
+template <class T> void RegulatorBSGSFF<T>::compose (Element & C, const Element & A, const Element & B) const
+{
+  T S, S1, u1, u2, u3, v1, w, a3, b3, temp;
+  long d3;
+
+  XGCD(S1, u1, u2, A.a, B.a);
+  add(w, A.b, B.b);
+  sub(w, w, h);
+  XGCD(S, v1, u3, S1, w);
+  mul(u1, u1, v1);
+  mul(u2, u2, v1);
+
+  // a3 = a1 a2 / S^2
+  mul(a3, A.a, B.a);
+
+  // b3 = (u1 a1 b2 + u2 a2 b1 + u3 (b1 b2 + f)) / S
+  mul(b3, A.b, B.b);
+  add(b3, b3, f);
+  mul(b3, b3, u3);
+  mul(temp, u1, A.a);
+  mul(temp, temp, B.b);
+  add(b3, b3, temp);
+  mul(temp, u2, B.a);
+  mul(temp, temp, A.b);
+  add(b3, b3, temp);
+
+  if (!IsOne(S)) {
+    sqr(temp, S);
+    div(a3, a3, temp);
+    div(b3, b3, S);
+  }
+  rem(b3, b3, a3);
+
+  d3 = A.d + B.d - deg(S);
+
+  C.a = a3;
+  C.b = b3;
+  C.d = d3;
+  reduce(C);
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::insert()
+//
+// Task:
+//      appends A to the baby steps and the hash table
+//
+
+template <class T> void RegulatorBSGSFF<T>::insert (const Element & A)
+{
+  table.insert(std::make_pair(A.a, (long) baby.size()));
+  baby.push_back(A);
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::baby_steps()
+//
+// Task:
+//      computes the baby steps (at least num_baby, covering a distance of
+//      more than 2g) and sets the giant step to the last one.  If the
+//      principal cycle is exhausted, R is obtained directly.
+//
+
+template <class T> void RegulatorBSGSFF<T>::baby_steps ()
+{
+  ZZ lower, upper;
+  Element A;
+  long m, i;
+
+  m = num_baby;
+  if (m <= 0) {
+    Lpoly.bounds(lower, upper);
+    SqrRoot(upper, upper >> 1);
+    m = (NumBits(upper) >= 22) ? (1L << 22) : max(16L, to_long(upper) + 1);
+  }
+
+  baby.clear();
+  table.clear();
+  baby.reserve(min(m, 1L << 22) + 2*g + 2);
+  table.reserve(min(m, 1L << 22) + 2*g + 2);
+
+  set(A.a);
+  clear(A.b);
+  A.d = 0;
+  normalize(A.b, A.a);
+  insert(A);
+
+  for (i = 1; ; ++i) {
+    rho(A);
+    if (IsOne(A.a)) {
+      R = A.d;
+      computed = true;
+      full_cycle = true;
+      return;
+    }
+
+    insert(A);
+
+    if (i >= m && A.d > 2*g)
+      break;
+  }
+
+  giant = A;
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::compute()
+//
+// Task:
+//      computes the regulator.  Since R <= L(1), a hit occurs before the
+//      distance of the giant steps exceeds the upper bound on L(1) plus the
+//      distance of G; otherwise an error is raised.
+//
+
+template <class T> void RegulatorBSGSFF<T>::compute ()
+{
+  ZZ lower, upper;
+  T b;
+  long delta;
+
+  if (computed)
+    return;
+
+  if (!QO->IsReal())
+    LogicError("RegulatorBSGSFF: the order is not real");
+
+  giant_steps = 0;
+
+  baby_steps();
+  if (computed)
+    return;
+
+  Lpoly.bounds(lower, upper);
+  upper += giant.d;
+
+  Element C = giant;
+
+  while (true) {
+    if (upper < C.d)
+      LogicError("RegulatorBSGSFF::compute: regulator bound exceeded");
+
+    // direct hit (beyond the baby-step window):  R = d(C) - d(b_i)
+    if (C.d > baby.back().d && find(C.a, C.b, delta)) {
+      R = C.d - delta;
+      break;
+    }
+
+    // conjugate hit:  R = d(C) + d(b_i) - deg a
+    sub(b, h, C.b);
+    normalize(b, C.a);
+    if (find(C.a, b, delta)) {
+      R = C.d + delta - deg(C.a);
+      break;
+    }
+
+    compose(C, C, giant);
+    ++giant_steps;
+  }
+
+  computed = true;
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::regulator()
+//
+// Task:
+//      returns the regulator, computing it first if necessary
+//
+
+template <class T> long RegulatorBSGSFF<T>::regulator ()
+{
+  compute();
+  return R;
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::class_number()
+//
+// Task:
+//      computes the ideal class number hx = L(1)/R.  If the bounds on L(1)
+//      contain exactly one multiple of R, true is returned.  Otherwise, hx is
+//      set to the nearest integer to E/R for the approximation E of L(1), and
+//      false is returned.
+//
+
+template <class T> bool RegulatorBSGSFF<T>::class_number (ZZ & hx)
+{
+  ZZ lower, upper, hlow, hup;
+  RR E;
+
+  compute();
+
+  Lpoly.bounds(lower, upper);
+
+  // multiples of R in [lower, upper]
+  add(hlow, lower, R - 1);
+  hlow /= R;
+  div(hup, upper, R);
+
+  if (hlow == hup) {
+    hx = hlow;
+    return true;
+  }
+
+  Lpoly.estimate(E);
+  RoundToZZ(hx, E / to_RR(R));
+  return false;
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::verify()
+//
+// Task:
+//      checks the regulator (and the class number, if determined) against
+//      the Jacobian order L(1) obtained by counting points over F_q^i,
+//      i <= g, with the given number of threads.  Returns true if R divides
+//      L(1) and h R = L(1).
+//
+
+template <class T> bool RegulatorBSGSFF<T>::verify (long threads)
+{
+  QuadraticLpolynomial<T> L(*QO);
+  ZZ N, hx;
+
+  compute();
+
+  L.set_point_counting(true);
+  L.set_degree_bound(g);
+  L.set_threads(threads);
+  L.jacobian_order(N);
+
+  if (!IsZero(N % R))
+    return false;
+
+  if (class_number(hx))
+    return hx * R == N;
+
+  return true;
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::principal_ideal_test()
+//
+// Task:
+//      tests whether [a, b + y] is principal.  It is reduced to B = [ra,
+//      rb + y], and C runs through B G^j (j = 0, 1, ...) until its distance
+//      from B exceeds R + d(G).  If C (or its conjugate) is a baby step b_i,
+//      the ideal is principal and
+//          delta(B) = d(b_i) - d(C),  resp.  delta(B) = deg a - d(b_i) - d(C)
+//      (mod R), 0 <= delta < R.  The regulator is computed first if
+//      necessary; the baby-step table is shared by all queries.
+//
+
+template <class T> bool RegulatorBSGSFF<T>::principal_ideal_test (T & ra, T & rb, long & delta, const T & a, const T & b)
+{
+  T cb;
+  Element B;
+  long dd;
+  bool found = false;
+
+  compute();
+
+  B.a = a;
+  MakeMonic(B.a);
+  B.b = b;
+  B.d = 0;
+  reduce(B);
+
+  ra = B.a;
+  rb = B.b;
+
+  Element C = B;
+
+  while (true) {
+    if (find(C.a, C.b, dd)) {
+      delta = dd - C.d;
+      found = true;
+      break;
+    }
+
+    sub(cb, h, C.b);
+    normalize(cb, C.a);
+    if (find(C.a, cb, dd)) {
+      delta = deg(C.a) - dd - C.d;
+      found = true;
+      break;
+    }
+
+    // the whole principal cycle is in the table
+    if (full_cycle || C.d > R + giant.d)
+      break;
+
+    compose(C, C, giant);
+  }
+
+  if (!found)
+    return false;
+
+  delta %= R;
+  if (delta < 0)
+    delta += R;
+
+  return true;
+}
+
+
+
+//
+// RegulatorBSGSFF<T>::find()
+//
+// Task:
+//      looks up the reduced ideal [a, b + y] (b normalized) in the baby-step
+//      table.  If found, its distance is returned.
+//
+
+template <class T> bool RegulatorBSGSFF<T>::find (const T & a, const T & b, long & delta) const
+{
+  auto range = table.equal_range(a);
+
+  for (auto it = range.first; it != range.second; ++it) {
+    const Element & entry = baby[it->second];
+    if (entry.b == b) {
+      delta = entry.d;
+      return true;
+    }
+  }
+
+  return false;
+}
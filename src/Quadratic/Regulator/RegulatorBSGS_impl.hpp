@@ -0,0 +1,349 @@
+/**
+ * @file RegulatorBSGS_impl.hpp
+ * @remarks baby-step giant-step regulator computation for real quadratic orders.
+ */
+
+//
+// constructor and destructor
+//
+
+template <class T> RegulatorBSGS<T>::RegulatorBSGS (QuadraticOrder<T> & inQO, long inbits)
+  : QO(&inQO),
+    bits(inbits),
+    p(inbits + NumBits(inQO.getDiscriminant())/2 + 16),
+    num_baby(0),
+    computed(false),
+    last(inQO, inbits + NumBits(inQO.getDiscriminant())/2 + 16),
+    giant(inQO, inbits + NumBits(inQO.getDiscriminant())/2 + 16),
+    eps(inQO, inbits + NumBits(inQO.getDiscriminant())/2 + 16),
+    giant_steps(0)
+{
+}
+
+template <class T> RegulatorBSGS<T>::~RegulatorBSGS () {}
+
+
+
+//
+// RegulatorBSGS<T>::set_precision()
+//
+// Task:
+//      sets the number of bits of R after the binary point to be computed.
+//      The (f,p) precision allows for O(Delta^(1/2)) operations.  Any
+//      previous result (and the baby-step table) is discarded.
+//
+
+template <class T> void RegulatorBSGS<T>::set_precision (long inbits)
+{
+  bits = inbits;
+  assign_order(*QO);
+}
+
+
+
+//
+// RegulatorBSGS<T>::assign_order()
+//
+// Task:
+//      switches to another order, keeping the precision in bits.  The (f,p)
+//      representations are reinitialized in place, and the baby-step vector
+//      and hash table are cleared, keeping their allocations, so that
+//      computations over many orders do not reallocate them.
+//
+
+template <class T> void RegulatorBSGS<T>::assign_order (QuadraticOrder<T> & inQO)
+{
+  QO = &inQO;
+  p = bits + NumBits(QO->getDiscriminant())/2 + 16;
+
+  last.assign_order(*QO, p);
+  giant.assign_order(*QO, p);
+  eps.assign_order(*QO, p);
+
+  baby.clear();
+  table.clear();
+  computed = false;
+}
+
+
+
+//
+// RegulatorBSGS<T>::set_baby_steps()
+//
+// Task:
+//      sets the minimal number of baby steps (0 = about Delta^(1/4))
+//
+
+template <class T> void RegulatorBSGS<T>::set_baby_steps (long m)
+{
+  num_baby = m;
+}
+
+
+
+//
+// RegulatorBSGS<T>::insert()
+//
+// Task:
+//      appends A to the baby steps and the hash table
+//
+
+template <class T> void RegulatorBSGS<T>::insert (const FPRepresentation<T> &A)
+{
+  BabyStep entry;
+  entry.a = A.get_a();
+  entry.b = A.get_b();
+  entry.d = A.get_d();
+  entry.k = A.get_k();
+
+  table.insert(std::make_pair(A.get_a(), (long) baby.size()));
+  baby.push_back(entry);
+}
+
+
+
+//
+// RegulatorBSGS<T>::baby_steps()
+//
+// Task:
+//      computes the baby steps and selects the giant step.  At least
+//      num_baby steps are taken, and the baby steps cover a distance of at
+//      least 2 log(Delta).  If the principal cycle is exhausted, R is
+//      obtained directly.
+//
+
+template <class T> void RegulatorBSGS<T>::baby_steps ()
+{
+  long nD, m, i, j;
+
+  nD = NumBits(QO->getDiscriminant());
+  m = num_baby;
+  if (m <= 0)
+    m = ((nD >> 2) >= 22) ? (1L << 22) : max(16L, 1L << (nD >> 2));
+
+  baby.clear();
+  table.clear();
+  baby.reserve(m + 2*nD);
+  table.reserve(m + 2*nD);
+
+  last.assign_one();
+  insert(last);
+
+  for (i = 1; ; ++i) {
+    last.rho();
+    if (last.IsOne()) {
+      eps.assign(last);
+      computed = true;
+      return;
+    }
+
+    insert(last);
+
+    if (i >= m && last.get_k() >= 2*nD)
+      break;
+  }
+
+  // giant step:  last baby step with d(G) <= d(last) - log(Delta)
+  for (j = baby.size() - 1; j > 0 && baby[j].k > last.get_k() - nD - 1; --j);
+
+  giant.assign(baby[j].a, baby[j].b);
+  giant.set_distance(baby[j].d, baby[j].k);
+}
+
+
+
+//
+// RegulatorBSGS<T>::compute()
+//
+// Task:
+//      computes the regulator.  eps is set to the order itself with
+//      theta ~ fundamental unit, i.e., distance R.  Since
+//      R <= h R < sqrt(Delta) (log(Delta) + 2)/2, the giant steps stop with
+//      an error once theta exceeds 2^kmax, kmax = sqrt(Delta) (nD + 3)/2
+//      (nD = NumBits(Delta)), which can only happen if the (f,p) precision
+//      was not sufficient.
+//
+
+template <class T> void RegulatorBSGS<T>::compute ()
+{
+  ZZ d, kmax;
+  long k, nD;
+
+  if (computed)
+    return;
+
+  giant_steps = 0;
+
+  baby_steps();
+  if (computed)
+    return;
+
+  nD = NumBits(QO->getDiscriminant());
+  conv(kmax, nD + 3);
+  kmax <<= (nD + 1)/2 - 1;
+
+  FPRepresentation<T> C(giant), Cbar(giant);
+
+  while (true) {
+    if (C.get_k() > kmax)
+      LogicError("RegulatorBSGS::compute: regulator bound exceeded");
+
+    // direct hit (beyond the baby-step window):  R = d(C) - d(b_i)
+    if (C.compare_distance(last) > 0 && find(C.get_a(), C.get_b(), d, k)) {
+      eps.assign(C);
+      eps.sub_distance(d, k);
+      break;
+    }
+
+    // conjugate hit:  R = d(C) + d(b_i) + log(a)
+    Cbar.assign(C.get_a(), -C.get_b());
+    if (find(Cbar.get_a(), Cbar.get_b(), d, k)) {
+      eps.assign(C);
+      eps.add_distance(d, k);
+      eps.add_log(C.get_a());
+      break;
+    }
+
+    mul(C, C, giant);
+    ++giant_steps;
+  }
+
+  d = eps.get_d();
+  k = eps.get_k();
+  eps.assign_one();
+  eps.set_distance(d, k);
+  computed = true;
+}
+
+
+
+//
+// RegulatorBSGS<T>::regulator(), fundamental_unit()
+//
+// Task:
+//      returns the regulator (resp. the (f,p) approximation or a compact
+//      representation of the fundamental unit), computing it first if
+//      necessary
+//
+
+template <class T> void RegulatorBSGS<T>::regulator (RR & R)
+{
+  compute();
+  R = eps.distance();
+}
+
+template <class T> const FPRepresentation<T> & RegulatorBSGS<T>::fundamental_unit ()
+{
+  compute();
+  return eps;
+}
+
+template <class T> void RegulatorBSGS<T>::fundamental_unit (CompactRepresentation<T> & E)
+{
+  compute();
+  compact_representation(E, eps);
+}
+
+
+
+//
+// RegulatorBSGS<T>::principal_ideal_test()
+//
+// Task:
+//      tests whether A is principal.  A is reduced to B, and C runs through
+//      B G^j (j = 0, 1, ...) until its distance from B exceeds R.  If C (or
+//      its conjugate) is a baby step b_i, A is principal and
+//          delta(B) = d(b_i) - d(C),  resp.  delta(B) = -d(b_i) - log(a) - d(C)
+//      (mod R).  On success, G is set to B with theta ~ exp(delta(B)),
+//      0 <= delta(B) < R.  The regulator is computed first if necessary;
+//      the baby-step table is shared by all queries.  A giant step that
+//      does not increase the distance of C (insufficient precision) raises
+//      an error, so the search always ends at distance R.
+//
+
+template <class T> bool RegulatorBSGS<T>::principal_ideal_test (FPRepresentation<T> & G, const QuadraticIdealBase<T> & A)
+{
+  ZZ d, one;
+  long k;
+  bool found = false;
+
+  compute();
+
+  FPRepresentation<T> B(*QO, p);
+  B.assign(A);
+  B.clear_distance();
+
+  FPRepresentation<T> C(B), Cbar(B);
+
+  while (true) {
+    if (find(C.get_a(), C.get_b(), d, k)) {
+      G.assign(C);
+      G.set_distance(d, k);
+      G.sub_distance(C.get_d(), C.get_k());
+      found = true;
+      break;
+    }
+
+    Cbar.assign(C.get_a(), -C.get_b());
+    if (find(Cbar.get_a(), Cbar.get_b(), d, k)) {
+      Cbar.set_distance(d, k);
+      Cbar.add_log(C.get_a());
+      Cbar.add_distance(C.get_d(), C.get_k());
+
+      G.assign(eps);
+      G.sub_distance(Cbar.get_d(), Cbar.get_k());
+      found = true;
+      break;
+    }
+
+    // the whole principal cycle is in the table
+    if (last.IsOne() || C.compare_distance(eps) > 0)
+      break;
+
+    d = C.get_d();
+    k = C.get_k();
+    mul(C, C, giant);
+    if (C.compare_distance(d, k) <= 0)
+      LogicError("RegulatorBSGS::principal_ideal_test: giant step does not increase the distance");
+  }
+
+  if (!found)
+    return false;
+
+  // reduce delta(B) modulo R
+  set(one);
+  one <<= p;
+  while (G.compare_distance(one, 0) < 0)
+    G.add_distance(eps.get_d(), eps.get_k());
+  while (G.compare_distance(eps) >= 0)
+    G.sub_distance(eps.get_d(), eps.get_k());
+
+  G.assign(B.get_a(), B.get_b());
+  return true;
+}
+
+
+
+//
+// RegulatorBSGS<T>::find()
+//
+// Task:
+//      looks up the reduced ideal [a, (b + sqrt(Delta))/2] (b normalized) in
+//      the baby-step table.  If found, its distance d 2^(k-p) is returned.
+//
+
+template <class T> bool RegulatorBSGS<T>::find (const ZZ & a, const ZZ & b, ZZ & d, long & k) const
+{
+  auto range = table.equal_range(a);
+
+  for (auto it = range.first; it != range.second; ++it) {
+    const BabyStep & entry = baby[it->second];
+    if (entry.b == b) {
+      d = entry.d;
+      k = entry.k;
+      return true;
+    }
+  }
+
+  return false;
+}
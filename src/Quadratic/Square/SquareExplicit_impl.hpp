@@ -0,0 +1,10 @@
+/**
+ * @file SquareExplicit_impl.hpp
+ * @remarks Generic implementation of the SquareExplicit class:  no explicit
+ * formulas are available, so NUDUPL is used.
+ */
+
+template < class T > void SquareExplicit<T>::square(QuadraticIdealBase<T> & C, const QuadraticIdealBase<T> & A) {
+  ++fallbacks;
+  nudupl.square(C,A);
+}
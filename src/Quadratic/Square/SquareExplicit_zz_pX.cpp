@@ -0,0 +1,24 @@
+/**
+ * @file SquareExplicit_zz_pX.cpp
+ * @remark Specialization of the SquareExplicit class for zz_pX.
+ */
+
+#include <ANTL/Quadratic/Square/SquareExplicit.hpp>
+
+template <> void SquareExplicit<zz_pX>::square(QuadraticIdealBase<zz_pX> & C, const QuadraticIdealBase<zz_pX> & A) {
+  static thread_local zz_pX a, b, Ca, Cb, Cc;
+  bool done = false;
+
+  if (is_init && IsZero(hx) && (genus == 2 || genus == 3) && zz_p::modulus() != 2) {
+    a = A.get_a();
+    b = A.get_b();
+    done = explicit_dbl(Ca, Cb, Cc, a, b, Delta, genus);
+  }
+
+  if (done)
+    C.assign(Ca, Cb, Cc);
+  else {
+    ++fallbacks;
+    nudupl.square(C, A);
+  }
+}
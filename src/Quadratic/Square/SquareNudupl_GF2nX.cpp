@@ -0,0 +1,10 @@
+/**
+ * @file SquareNudupl_GF2nX.cpp
+ * @remark Specialization of the SquareNudupl class for GF2nX.
+ */
+
+#include <ANTL/Quadratic/Square/SquareNudupl.hpp>
+
+template <> void SquareNudupl<GF2nX>::square(QuadraticIdealBase<GF2nX> & C, const QuadraticIdealBase<GF2nX> & A) {
+  square_char2(C,A);
+}
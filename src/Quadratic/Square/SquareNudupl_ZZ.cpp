@@ -14,14 +14,20 @@ template <> void SquareNudupl<ZZ>::init(const ZZ & delta_in, const ZZ & h_in, lo
 }
 
 
-template <> void SquareNudupl<ZZ>::square(QuadraticIdealBase<ZZ> & C, const QuadraticIdealBase<ZZ> & A) {
-  static ZZ a1, b1, c1, Ca, Cb, Cc;
-  static ZZ S, v1, K, T, temp;
-  static ZZ R1, R2, C1, C2, M2;
+// nudupl
+//
+// Task: replaces (a, b, c) by the result of one NUDUPL step.  The result is
+//       not normalized; if the input is (almost) reduced, it is almost
+//       reduced.
+
+template <> void SquareNudupl<ZZ>::nudupl(ZZ & a, ZZ & b, ZZ & c) {
+  static thread_local ZZ a1, b1, c1, Ca, Cb, Cc;
+  static thread_local ZZ S, v1, K, T, temp;
+  static thread_local ZZ R1, R2, C1, C2, M2;
 
-  a1 = A.get_a();
-  b1 = A.get_b();
-  c1 = A.get_c();
+  a1 = a;
+  b1 = b;
+  c1 = c;
 
   // solve S = v1 b1 + u1 a1 (only need v1)
   XGCD_LEFT (S, v1, b1, a1);
@@ -105,7 +111,58 @@ template <> void SquareNudupl<ZZ>::square(QuadraticIdealBase<ZZ> & C, const Quad
     }
   }
 
-  // normalize and reduce
-  C.assign(Ca,Cb,Cc);
-  //C.reduce();
+  a = Ca;
+  b = Cb;
+  c = Cc;
+}
+
+
+// square
+//
+// Task: computes an ideal equivalent to the square of A with NUDUPL (not
+//       reduced)
+
+template <> void SquareNudupl<ZZ>::square(QuadraticIdealBase<ZZ> & C, const QuadraticIdealBase<ZZ> & A) {
+  static thread_local ZZ a, b, c;
+
+  a = A.get_a();
+  b = A.get_b();
+  c = A.get_c();
+  nudupl(a,b,c);
+
+  C.assign(a,b,c);
+}
+
+
+// sqr_k
+//
+// Task: computes the reduced ideal equivalent to A^(2^k).  The NUDUPL steps
+//       are chained on (a, b, c):  the output of NUDUPL is almost reduced,
+//       which is good enough as input for the next step, so intermediate
+//       results are neither normalized nor reduced.  They are only reduced
+//       if a exceeds about 4 sqrt|Delta| (which does not happen for reduced
+//       input).  The result is reduced once at the end.
+
+template <> void SquareNudupl<ZZ>::sqr_k(QuadraticIdealBase<ZZ> & C, const QuadraticIdealBase<ZZ> & A, long k) {
+  static thread_local ZZ a, b, c;
+  long rbits = 2*NumBits(NC_BOUND) + 2;
+
+  a = A.get_a();
+  b = A.get_b();
+  c = A.get_c();
+
+  for (long i = 0; i < k; ++i) {
+    nudupl(a,b,c);
+
+    if (NumBits(a) > rbits) {
+      C.assign(a,b,c);
+      C.reduce();
+      a = C.get_a();
+      b = C.get_b();
+      c = C.get_c();
+    }
+  }
+
+  C.assign(a,b,c);
+  C.reduce();
 }
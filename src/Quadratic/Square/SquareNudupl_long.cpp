@@ -14,14 +14,20 @@ template <> void SquareNudupl<long>::init(const long & delta_in, const long & h_
 }
 
 
-template <> void SquareNudupl<long>::square(QuadraticIdealBase<long> & C, const QuadraticIdealBase<long> & A) {
-  static long a1, b1, c1, Ca, Cb, Cc;
-  static long S, v1, K, T, temp;
-  static long R1, R2, C1, C2, M2;
+// nudupl
+//
+// Task: replaces (a, b, c) by the result of one NUDUPL step.  The result is
+//       not normalized; if the input is (almost) reduced, it is almost
+//       reduced.
+
+template <> void SquareNudupl<long>::nudupl(long & a, long & b, long & c) {
+  static thread_local long a1, b1, c1, Ca, Cb, Cc;
+  static thread_local long S, v1, K, T, temp;
+  static thread_local long R1, R2, C1, C2, M2;
 
-  a1 = A.get_a();
-  b1 = A.get_b();
-  c1 = A.get_c();
+  a1 = a;
+  b1 = b;
+  c1 = c;
 
   // solve S = v1 b1 + u1 a1 (only need v1)
   XGCD_LEFT (S, v1, b1, a1);
@@ -32,9 +38,13 @@ template <> void SquareNudupl<long>::square(QuadraticIdealBase<long> & C, const
   if (S != 1)
     {
       a1 /= S;
-      c1 /= S;
+      c1 *= S;
     }
 
+  // 0 <= K < L, as for ZZ (the partial reduction needs a nonnegative K)
+  K %= a1;
+  if (K < 0) K += a1;
+
   // N = L = a1;
 
   // check if NUCOMP steps are required
@@ -51,7 +61,7 @@ template <> void SquareNudupl<long>::square(QuadraticIdealBase<long> & C, const
   Cb = (T << 1) + b1;
 
   // C.c = (S c1 + K (b1 + T)) / L;
-  Cc = ((b1+T)*K + S*c1) / a1;
+  Cc = ((b1+T)*K + c1) / a1;
   }
   else {
     // use NUCOMP formulas
@@ -83,6 +93,58 @@ template <> void SquareNudupl<long>::square(QuadraticIdealBase<long> & C, const
     }
   }
 
-  // normalize and reduce
-  C.assign(Ca,Cb,Cc);
+  a = Ca;
+  b = Cb;
+  c = Cc;
+}
+
+
+// square
+//
+// Task: computes an ideal equivalent to the square of A with NUDUPL (not
+//       reduced)
+
+template <> void SquareNudupl<long>::square(QuadraticIdealBase<long> & C, const QuadraticIdealBase<long> & A) {
+  static thread_local long a, b, c;
+
+  a = A.get_a();
+  b = A.get_b();
+  c = A.get_c();
+  nudupl(a,b,c);
+
+  C.assign(a,b,c);
+}
+
+
+// sqr_k
+//
+// Task: computes the reduced ideal equivalent to A^(2^k).  The NUDUPL steps
+//       are chained on (a, b, c):  the output of NUDUPL is almost reduced,
+//       which is good enough as input for the next step, so intermediate
+//       results are neither normalized nor reduced.  They are only reduced
+//       if a exceeds about 4 sqrt|Delta| (which does not happen for reduced
+//       input).  The result is reduced once at the end.
+
+template <> void SquareNudupl<long>::sqr_k(QuadraticIdealBase<long> & C, const QuadraticIdealBase<long> & A, long k) {
+  static thread_local long a, b, c;
+  long rbits = 2*NumBits(NC_BOUND) + 2;
+
+  a = A.get_a();
+  b = A.get_b();
+  c = A.get_c();
+
+  for (long i = 0; i < k; ++i) {
+    nudupl(a,b,c);
+
+    if (NumBits(a) > rbits) {
+      C.assign(a,b,c);
+      C.reduce();
+      a = C.get_a();
+      b = C.get_b();
+      c = C.get_c();
+    }
+  }
+
+  C.assign(a,b,c);
+  C.reduce();
 }
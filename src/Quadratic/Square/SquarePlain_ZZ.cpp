@@ -7,8 +7,8 @@
 #include <ANTL/Quadratic/Square/SquarePlain.hpp>
 
 template <> void SquarePlain<ZZ>::square (QuadraticIdealBase<ZZ> & C, const QuadraticIdealBase<ZZ> & A) {
-  static ZZ a1, b1, c1, Ca, Cb, Cc;
-  static ZZ S, v1, K, T;
+  static thread_local ZZ a1, b1, c1, Ca, Cb, Cc;
+  static thread_local ZZ S, v1, K, T;
 
   a1 = A.get_a();
   b1 = A.get_b();
@@ -7,8 +7,8 @@
 #include <ANTL/Quadratic/Square/SquarePlain.hpp>
 
 template <> void SquarePlain<long>::square (QuadraticIdealBase<long> & C, const QuadraticIdealBase<long> & A) {
-  static long a1, b1, c1, Ca, Cb, Cc;
-  static long S, v1, K, T;
+  static thread_local long a1, b1, c1, Ca, Cb, Cc;
+  static thread_local long S, v1, K, T;
 
   a1 = A.get_a();
   b1 = A.get_b();
@@ -0,0 +1,509 @@
+/**
+ * @file ClassNumberTabulation.cpp
+ * @brief implementation of the class number tabulation driver
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <unistd.h>
+
+#include <ANTL/Quadratic/Tabulation/ClassNumberTabulation.hpp>
+
+namespace ANTL
+{
+  //
+  // constructor and destructor
+  //
+
+  ClassNumberTabulation::ClassNumberTabulation (long inDmin, long inDmax)
+    : Dmin(max(inDmin, 2L)),
+      Dmax(inDmax),
+      block(1L << 16),
+      shard(0),
+      num_shards(1),
+      Q(0),
+      err(0.1),
+      A(8.795),
+      B(13.2),
+      bits(32),
+      records(0),
+      Qrun(0),
+      np(0)
+  {
+  }
+
+  ClassNumberTabulation::~ClassNumberTabulation () {}
+
+
+
+  //
+  // ClassNumberTabulation::set_...()
+  //
+  // Task:
+  //      sets the parameters:  shard i of n, discriminants per block, Q for
+  //      the Euler product (0 = smallest Q with error bound <= err for all
+  //      Delta < Dmax), error constants, bits of R, and the checkpoint file
+  //      (empty = no checkpointing)
+  //
+
+  void ClassNumberTabulation::set_shard (long i, long n)
+  {
+    num_shards = max(n, 1L);
+    shard = min(max(i, 0L), num_shards - 1);
+  }
+
+  void ClassNumberTabulation::set_block_size (long inblock)
+  {
+    block = max(inblock, 1L);
+  }
+
+  void ClassNumberTabulation::set_Q (long inQ)
+  {
+    Q = inQ;
+  }
+
+  void ClassNumberTabulation::set_error (double inerr)
+  {
+    err = inerr;
+  }
+
+  void ClassNumberTabulation::set_error_constants (double inA, double inB)
+  {
+    A = inA;
+    B = inB;
+  }
+
+  void ClassNumberTabulation::set_precision (long inbits)
+  {
+    bits = inbits;
+  }
+
+  void ClassNumberTabulation::set_checkpoint (const std::string & file)
+  {
+    checkpoint = file;
+  }
+
+
+
+  //
+  // ClassNumberTabulation::shard_range()
+  //
+  // Task:
+  //      returns the range [lo, hi) of this shard (a contiguous range of
+  //      blocks)
+  //
+
+  void ClassNumberTabulation::shard_range (long & lo, long & hi) const
+  {
+    long nb = (Dmax > Dmin) ? (Dmax - Dmin + block - 1) / block : 0;
+
+    lo = min(Dmax, Dmin + (shard * nb / num_shards) * block);
+    hi = min(Dmax, Dmin + ((shard + 1) * nb / num_shards) * block);
+    if (hi < lo)
+      hi = lo;
+  }
+
+
+
+  //
+  // ClassNumberTabulation::init_lfunction()
+  //
+  // Task:
+  //      chooses Q and computes, for each prime p < 2Q, the contributions
+  //          sum_{p^k < 2Q} W(p^k) (+-1)^k / (k p^k)
+  //      to log L(1,chi) if chi(p) = 1 resp. -1, where W(n) is the tail
+  //      weight of Bach's approximation (see QuadraticLfunction)
+  //
+
+  void ClassNumberTabulation::init_lfunction ()
+  {
+    long i, n, k, p, N;
+    double S, W, term, sgn;
+
+    Qrun = (Q > 0) ? Q : QuadraticLfunction<long>::choose_Q(to_ZZ(Dmax), err, A, B);
+
+    std::vector<double> tail(Qrun + 1);
+    tail[Qrun] = 0;
+    S = 0;
+    for (i = Qrun - 1; i >= 0; --i) {
+      S += double(Qrun + i) * std::log(double(Qrun + i));
+      tail[i] = S;
+    }
+    for (i = 0; i < Qrun; ++i)
+      tail[i] /= S;
+
+    N = 2*Qrun - 1;
+    const std::vector<long> & P = PrimeTable::primes(N);
+    np = PrimeTable::count(N - 1);
+
+    s_plus.assign(np, 0.0);
+    s_minus.assign(np, 0.0);
+
+    for (i = 0; i < np; ++i) {
+      p = P[i];
+      term = 1.0 / double(p);
+      sgn = -1.0;
+      for (n = p, k = 1; n < N; ++k) {
+        W = (n < Qrun) ? 1.0 : tail[n - Qrun + 1];
+        s_plus[i] += W * term / double(k);
+        s_minus[i] += sgn * W * term / double(k);
+
+        if (n > (N - 1) / p)
+          break;
+        n *= p;
+        term /= double(p);
+        sgn = -sgn;
+      }
+    }
+  }
+
+
+
+  //
+  // ClassNumberTabulation::sieve_fundamental()
+  //
+  // Task:
+  //      marks the fundamental discriminants in [D0, D0 + len) and collects
+  //      their offsets in idx
+  //
+
+  void ClassNumberTabulation::sieve_fundamental (long D0, long len)
+  {
+    long j, r, p, q, D, end;
+
+    end = D0 + len;
+    fundamental.assign(len, 0);
+
+    for (j = 0; j < len; ++j) {
+      D = D0 + j;
+      r = D & 15;
+      if (D > 1 && ((r & 3) == 1 || r == 8 || r == 12))
+        fundamental[j] = 1;
+    }
+
+    // remove multiples of odd squares
+    const std::vector<long> & P = PrimeTable::primes(SqrRoot(end) + 1);
+    for (j = 1; j < (long) P.size() && P[j] <= (end - 1) / P[j]; ++j) {
+      p = P[j];
+      q = p*p;
+      for (D = ((D0 + q - 1) / q) * q; D < end; D += q)
+        fundamental[D - D0] = 0;
+    }
+
+    idx.clear();
+    for (j = 0; j < len; ++j)
+      if (fundamental[j])
+        idx.push_back(j);
+  }
+
+
+
+  //
+  // ClassNumberTabulation::sieve_lfunction()
+  //
+  // Task:
+  //      computes the approximation of log L(1,chi_Delta) for all
+  //      fundamental discriminants of the block, prime by prime.  For
+  //      p <= len, chi_Delta(p) is read from a table of Legendre symbols
+  //      mod p; otherwise it is computed for the whole block with the block
+  //      version of Jacobi_base().
+  //
+
+  void ClassNumberTabulation::sieve_lfunction (long D0, long len)
+  {
+    long i, t, p, r0, x, c, m;
+
+    const std::vector<long> & P = PrimeTable::primes(2*Qrun - 1);
+    m = idx.size();
+
+    logL.assign(m, 0.0);
+    res.resize(m);
+    mod.resize(m);
+    chi.resize(m);
+
+    // p = 2
+    for (t = 0; t < m; ++t) {
+      r0 = (D0 + idx[t]) & 7;
+      if (r0 == 1)
+        logL[t] += s_plus[0];
+      else if (r0 == 5)
+        logL[t] += s_minus[0];
+    }
+
+    for (i = 1; i < np; ++i) {
+      p = P[i];
+
+      if (p <= len) {
+        legendre.assign(p, -1);
+        legendre[0] = 0;
+        for (x = 1; x <= (p >> 1); ++x)
+          legendre[(x*x) % p] = 1;
+
+        r0 = D0 % p;
+        for (t = 0; t < m; ++t) {
+          c = legendre[(r0 + idx[t]) % p];
+          if (c == 1)
+            logL[t] += s_plus[i];
+          else if (c == -1)
+            logL[t] += s_minus[i];
+        }
+      }
+      else {
+        for (t = 0; t < m; ++t) {
+          res[t] = (D0 + idx[t]) % p;
+          mod[t] = p;
+        }
+        Jacobi_base(chi.data(), res.data(), mod.data(), m);
+
+        for (t = 0; t < m; ++t) {
+          if (chi[t] == 1)
+            logL[t] += s_plus[i];
+          else if (chi[t] == -1)
+            logL[t] += s_minus[i];
+        }
+      }
+    }
+  }
+
+
+
+  //
+  // ClassNumberTabulation::read_checkpoint(), write_checkpoint()
+  //
+  // Task:
+  //      reads/writes the checkpoint:  the parameters of the tabulation
+  //      (Dmin, Dmax, block size, shard, number of shards, Q), the next
+  //      block, the size of the output, the number of records, and the last
+  //      discriminant written.  read_checkpoint() returns 1 if the
+  //      checkpoint was read, 0 if there is none, and -1 if it is malformed
+  //      or belongs to another tabulation.  The checkpoint is written to a
+  //      temporary file first and then renamed, so it is always complete.
+  //
+
+  long ClassNumberTabulation::read_checkpoint (long & D0, long & offset, long & count, long & prevD) const
+  {
+    std::ifstream in(checkpoint.c_str());
+    long cDmin, cDmax, cblock, cshard, cnum_shards, cQ, lo, hi;
+
+    if (!in)
+      return 0;
+
+    in >> cDmin >> cDmax >> cblock >> cshard >> cnum_shards >> cQ;
+    in >> D0 >> offset >> count >> prevD;
+    if (in.fail())
+      return -1;
+
+    if (cDmin != Dmin || cDmax != Dmax || cblock != block || cshard != shard ||
+        cnum_shards != num_shards || cQ != Qrun)
+      return -1;
+
+    shard_range(lo, hi);
+    if (D0 < lo || D0 > hi || prevD < lo || prevD >= max(D0, lo + 1) || offset < 0 || count < 0)
+      return -1;
+
+    return 1;
+  }
+
+  bool ClassNumberTabulation::write_checkpoint (long D0, long offset, long count, long prevD) const
+  {
+    std::string tmp = checkpoint + ".tmp";
+    std::ofstream out(tmp.c_str(), std::ios::trunc);
+
+    out << Dmin << " " << Dmax << " " << block << " " << shard << " "
+        << num_shards << " " << Qrun << std::endl;
+    out << D0 << " " << offset << " " << count << " " << prevD << std::endl;
+    out.close();
+    if (out.fail())
+      return false;
+
+    return (std::rename(tmp.c_str(), checkpoint.c_str()) == 0);
+  }
+
+
+
+  //
+  // ClassNumberTabulation::put_varint(), get_varint()
+  //
+  // Task:
+  //      writes/reads an unsigned LEB128 integer
+  //
+
+  void ClassNumberTabulation::put_varint (std::ostream & out, unsigned long x)
+  {
+    while (x >= 0x80) {
+      out.put((char) ((x & 0x7f) | 0x80));
+      x >>= 7;
+    }
+    out.put((char) x);
+  }
+
+  bool ClassNumberTabulation::get_varint (std::istream & in, unsigned long & x)
+  {
+    int c;
+    long shift = 0;
+
+    x = 0;
+    while ((c = in.get()) != EOF) {
+      x |= ((unsigned long) (c & 0x7f)) << shift;
+      if (!(c & 0x80))
+        return true;
+      shift += 7;
+    }
+
+    return false;
+  }
+
+
+
+  //
+  // ClassNumberTabulation::run()
+  //
+  // Task:
+  //      tabulates h and R for the fundamental discriminants of this shard,
+  //      writing the records to file.  If a checkpoint exists, the
+  //      computation resumes after the last completed block.  Returns false
+  //      on I/O errors and if the checkpoint does not match the parameters.
+  //
+
+  bool ClassNumberTabulation::run (const std::string & file)
+  {
+    long lo, hi, D0, D, len, t, offset, prevD, hlo, hhi, i, status;
+    double r, hstar, e;
+    unsigned long long u;
+    unsigned char buf[8];
+    std::ofstream out;
+    RR R;
+
+    shard_range(lo, hi);
+    init_lfunction();
+    PrimeTable::extend(max(2*Qrun, SqrRoot(max(hi, 1L)) + 1));
+
+    D0 = lo;
+    prevD = lo;
+    offset = 0;
+    records = 0;
+
+    status = checkpoint.empty() ? 0 : read_checkpoint(D0, offset, records, prevD);
+    if (status < 0)
+      return false;
+
+    if (status > 0) {
+      if (truncate(file.c_str(), offset) != 0)
+        return false;
+      out.open(file.c_str(), std::ios::binary | std::ios::app);
+    }
+    else {
+      out.open(file.c_str(), std::ios::binary | std::ios::trunc);
+      out.write("ANTLCNT1", 8);
+      put_varint(out, lo);
+    }
+
+    if (!out)
+      return false;
+
+    // the order outlives every use by bsgs
+    std::unique_ptr< QuadraticOrder<long> > QO(new QuadraticOrder<long>(5));
+    RegulatorBSGS<long> bsgs(*QO, bits);
+
+    for (; D0 < hi; D0 += len) {
+      len = min(block, hi - D0);
+
+      sieve_fundamental(D0, len);
+      sieve_lfunction(D0, len);
+
+      for (t = 0; t < (long) idx.size(); ++t) {
+        D = D0 + idx[t];
+
+        QO.reset(new QuadraticOrder<long>(D));
+        bsgs.assign_order(*QO);
+        bsgs.regulator(R);
+        conv(r, R);
+
+        // h R = sqrt(Delta) L(1,chi) / 2
+        e = QuadraticLfunction<long>::error_bound(to_ZZ(D), Qrun, A, B);
+        hstar = std::sqrt(double(D)) * std::exp(logL[t]) / (2.0 * r);
+        hlo = (long) std::ceil(hstar * std::exp(-e));
+        hhi = (long) std::floor(hstar * std::exp(e));
+        if (hlo < 1)
+          hlo = 1;
+        if (hhi < hlo)
+          hhi = hlo;
+
+        put_varint(out, D - prevD);
+        put_varint(out, hlo);
+        put_varint(out, hhi - hlo);
+
+        std::memcpy(&u, &r, 8);
+        for (i = 0; i < 8; ++i)
+          buf[i] = (unsigned char) (u >> (8*i));
+        out.write((const char *) buf, 8);
+
+        prevD = D;
+        ++records;
+      }
+
+      out.flush();
+      if (!out)
+        return false;
+
+      offset = out.tellp();
+      if (!checkpoint.empty() && !write_checkpoint(D0 + len, offset, records, prevD))
+        return false;
+    }
+
+    return true;
+  }
+
+
+
+  //
+  // ClassNumberTabulation::read_header(), read_record()
+  //
+  // Task:
+  //      reads the header (D is set to the start of the shard), resp. the
+  //      next record (D is the previous discriminant on input).  Return
+  //      false at the end of the stream or on malformed input.
+  //
+
+  bool ClassNumberTabulation::read_header (std::istream & in, long & D)
+  {
+    char magic[8];
+    unsigned long x;
+
+    in.read(magic, 8);
+    if (!in || std::memcmp(magic, "ANTLCNT1", 8) != 0)
+      return false;
+
+    if (!get_varint(in, x))
+      return false;
+    D = x;
+    return true;
+  }
+
+  bool ClassNumberTabulation::read_record (std::istream & in, long & D, long & hlo, long & hhi, double & R)
+  {
+    unsigned long dD, x, y;
+    unsigned long long u = 0;
+    unsigned char buf[8];
+    long i;
+
+    if (!get_varint(in, dD) || !get_varint(in, x) || !get_varint(in, y))
+      return false;
+
+    in.read((char *) buf, 8);
+    if (!in)
+      return false;
+    for (i = 0; i < 8; ++i)
+      u |= ((unsigned long long) buf[i]) << (8*i);
+    std::memcpy(&R, &u, 8);
+
+    D += dD;
+    hlo = x;
+    hhi = x + y;
+    return true;
+  }
+
+} // ANTL
@@ -0,0 +1,516 @@
+/**
+ * @file ClassGroupVDF_impl.hpp
+ * @remarks verifiable delay functions in class groups of imaginary quadratic orders.
+ */
+
+//
+// constructor and destructor
+//
+
+template <class T> ClassGroupVDF<T>::ClassGroupVDF (QuadraticOrder<T> & inQO, long ininterval)
+  : QO(&inQO),
+    interval((ininterval > 0) ? ininterval : 1),
+    threads(1),
+    iterations(0),
+    current(inQO)
+{
+  sqr_nudupl.init(QO->getDiscriminant(), QO->getH());
+  mul_nucomp.init(QO->getDiscriminant(), QO->getH());
+  sqr = &sqr_nudupl;
+
+  current.assign_one();
+}
+
+template <class T> ClassGroupVDF<T>::~ClassGroupVDF () {}
+
+
+
+//
+// ClassGroupVDF<T>::set_checkpoint_interval()
+//
+// Task:
+//      sets the checkpoint interval s.  If the chain has been started, it is
+//      restarted from g.
+//
+
+template <class T> void ClassGroupVDF<T>::set_checkpoint_interval (long s)
+{
+  QuadraticIdealBase<T> g(*QO);
+  bool started;
+
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    interval = (s > 0) ? s : 1;
+    started = !checkpoints.empty();
+    if (started)
+      g.assign(checkpoints.front());
+  }
+
+  if (started)
+    start(g);
+}
+
+
+
+//
+// ClassGroupVDF<T>::get_iterations()
+//
+// Task:
+//      returns the number of squarings done so far
+//
+
+template <class T> long ClassGroupVDF<T>::get_iterations () const
+{
+  std::lock_guard<std::mutex> guard(lock);
+  return iterations;
+}
+
+
+
+//
+// ClassGroupVDF<T>::multiply(), power(), multi_power()
+//
+// Task:
+//      C = A B (NUCOMP), C = A^n (left-to-right binary), resp.
+//      C = prod_j A_j^e_j, where the products are split over the worker
+//      threads.  All results are reduced.
+//
+
+template <class T> void ClassGroupVDF<T>::multiply (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A, const QuadraticIdealBase<T> &B) const
+{
+  mul_nucomp.multiply(C, A, B);
+  C.reduce();
+}
+
+template <class T> void ClassGroupVDF<T>::power (QuadraticIdealBase<T> &C, const QuadraticIdealBase<T> &A, const ZZ & n) const
+{
+  QuadraticIdealBase<T> B(*QO);
+  B.assign(A);
+
+  C.assign_one();
+  for (long i = NumBits(n) - 1; i >= 0; --i) {
+    sqr->square(C, C);
+    C.reduce();
+
+    if (bit(n, i))
+      multiply(C, C, B);
+  }
+}
+
+template <class T> void ClassGroupVDF<T>::multi_power (QuadraticIdealBase<T> &C, const std::vector< QuadraticIdealBase<T> > &A, const std::vector<ZZ> &e) const
+{
+  long n = A.size();
+  long nt = (threads < n) ? threads : n;
+
+  if (nt <= 1) {
+    QuadraticIdealBase<T> P(*QO);
+    C.assign_one();
+    for (long j = 0; j < n; ++j) {
+      power(P, A[j], e[j]);
+      multiply(C, C, P);
+    }
+    return;
+  }
+
+  std::vector< QuadraticIdealBase<T> > partial(nt, QuadraticIdealBase<T>(*QO));
+  std::vector<std::thread> workers;
+
+  for (long w = 0; w < nt; ++w)
+    workers.push_back(std::thread([&, w] () {
+      QuadraticIdealBase<T> P(*QO);
+      partial[w].assign_one();
+      for (long j = (n * w) / nt; j < (n * (w + 1)) / nt; ++j) {
+        power(P, A[j], e[j]);
+        multiply(partial[w], partial[w], P);
+      }
+    }));
+
+  for (long w = 0; w < nt; ++w)
+    workers[w].join();
+
+  C.assign(partial[0]);
+  for (long w = 1; w < nt; ++w)
+    multiply(C, C, partial[w]);
+}
+
+
+
+//
+// ClassGroupVDF<T>::is_element(), is_equal()
+//
+// Task:
+//      tests whether A is a reduced ideal of the order (used on untrusted
+//      input), resp. whether the reduced ideals A and B are equal
+//
+
+template <class T> bool ClassGroupVDF<T>::is_element (const QuadraticIdealBase<T> &A) const
+{
+  ZZ a, b, c, d;
+
+  conv(a, A.get_a());
+  conv(b, A.get_b());
+  conv(c, A.get_c());
+
+  if (NTL::sign(a) <= 0 || b > a || b <= -a || a > c || (a == c && NTL::sign(b) < 0))
+    return false;
+
+  NTL::sqr(d, b);
+  d -= 4*a*c;
+  return d == QO->getDiscriminant();
+}
+
+template <class T> bool ClassGroupVDF<T>::is_equal (const QuadraticIdealBase<T> &A, const QuadraticIdealBase<T> &B) const
+{
+  return A.get_a() == B.get_a() && A.get_b() == B.get_b();
+}
+
+
+
+//
+// ClassGroupVDF<T>::start(), advance(), evaluate()
+//
+// Task:
+//      starts a new chain with base g (reduced), resp. continues the chain
+//      by steps squarings, storing a checkpoint every s squarings.  Only
+//      one thread may advance the chain; others may request outputs and
+//      proofs at the same time.  evaluate() computes y = g^(2^t).
+//
+
+template <class T> void ClassGroupVDF<T>::start (const QuadraticIdealBase<T> &g)
+{
+  std::lock_guard<std::mutex> guard(lock);
+
+  checkpoints.clear();
+  checkpoints.push_back(g);
+  current.assign(g);
+  iterations = 0;
+}
+
+template <class T> void ClassGroupVDF<T>::advance (long steps)
+{
+  QuadraticIdealBase<T> C(*QO);
+  long t, len;
+
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    C.assign(current);
+    t = iterations;
+  }
+
+  while (steps > 0) {
+    len = interval - t % interval;
+    if (len > steps)
+      len = steps;
+
+    sqr->sqr_k(C, C, len);
+    t += len;
+    steps -= len;
+
+    std::lock_guard<std::mutex> guard(lock);
+    current.assign(C);
+    iterations = t;
+    if (t % interval == 0)
+      checkpoints.push_back(C);
+  }
+}
+
+template <class T> void ClassGroupVDF<T>::evaluate (QuadraticIdealBase<T> &y, const QuadraticIdealBase<T> &g, long t)
+{
+  start(g);
+  advance(t);
+  output(y, t);
+}
+
+
+
+//
+// ClassGroupVDF<T>::get_checkpoints(), output()
+//
+// Task:
+//      copies the checkpoints G(j s), j <= t/s, resp. computes
+//      y = G(t) = g^(2^t).  If t exceeds the number of squarings done, the
+//      missing values are computed (without extending the chain).
+//
+
+template <class T> void ClassGroupVDF<T>::get_checkpoints (std::vector< QuadraticIdealBase<T> > &G, long t) const
+{
+  QuadraticIdealBase<T> C(*QO);
+  long n = t / interval + 1;
+
+  G.clear();
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    for (long j = 0; j < n && j < (long) checkpoints.size(); ++j)
+      G.push_back(checkpoints[j]);
+    if (G.empty())
+      G.push_back(current);
+  }
+
+  C.assign(G.back());
+  while ((long) G.size() < n) {
+    sqr->sqr_k(C, C, interval);
+    G.push_back(C);
+  }
+}
+
+template <class T> void ClassGroupVDF<T>::output (QuadraticIdealBase<T> &y, long t) const
+{
+  std::vector< QuadraticIdealBase<T> > G;
+
+  get_checkpoints(G, t);
+  sqr->sqr_k(y, G.back(), t - (G.size() - 1) * interval);
+}
+
+
+
+//
+// ClassGroupVDF<T>::append(), hash()
+//
+// Task:
+//      serializes integers and ideals (a, b) for the challenges, resp.
+//      derives a 128-bit integer (top bit set) from the serialized data
+//
+
+template <class T> void ClassGroupVDF<T>::append (std::vector<unsigned char> &buf, const ZZ & x)
+{
+  long n = NumBytes(x);
+  std::vector<unsigned char> bytes(n);
+
+  for (long i = 0; i < 4; ++i)
+    buf.push_back((unsigned char) ((n >> (8*i)) & 0xff));
+  buf.push_back((NTL::sign(x) < 0) ? 1 : 0);
+
+  BytesFromZZ(bytes.data(), x, n);
+  buf.insert(buf.end(), bytes.begin(), bytes.end());
+}
+
+template <class T> void ClassGroupVDF<T>::append (std::vector<unsigned char> &buf, const QuadraticIdealBase<T> &A)
+{
+  ZZ x;
+
+  conv(x, A.get_a());
+  append(buf, x);
+  conv(x, A.get_b());
+  append(buf, x);
+}
+
+template <class T> void ClassGroupVDF<T>::hash (ZZ & h, const std::vector<unsigned char> &buf)
+{
+  unsigned char key[16];
+
+  DeriveKey(key, 16, buf.data(), buf.size());
+  ZZFromBytes(h, key, 16);
+  SetBit(h, 127);
+}
+
+
+
+//
+// ClassGroupVDF<T>::challenge_prime(), challenge()
+//
+// Task:
+//      Fiat-Shamir challenges:  the 128-bit prime l = H(g, y, t) of the
+//      Wesolowski proof, resp. the 128-bit integer r = H(x, y, mu, t) of a
+//      Pietrzak round.  The discriminant is included in both.
+//
+
+template <class T> void ClassGroupVDF<T>::challenge_prime (ZZ & l, const QuadraticIdealBase<T> &g, const QuadraticIdealBase<T> &y, long t) const
+{
+  const char *tag = "ANTL-VDF-W";
+  std::vector<unsigned char> buf(tag, tag + 10);
+  ZZ x;
+
+  conv(x, QO->getDiscriminant());
+  append(buf, x);
+  append(buf, g);
+  append(buf, y);
+  append(buf, ZZ(t));
+
+  hash(x, buf);
+  NextPrime(l, x);
+}
+
+template <class T> void ClassGroupVDF<T>::challenge (ZZ & r, const QuadraticIdealBase<T> &x, const QuadraticIdealBase<T> &y, const QuadraticIdealBase<T> &mu, long t) const
+{
+  const char *tag = "ANTL-VDF-P";
+  std::vector<unsigned char> buf(tag, tag + 10);
+  ZZ D;
+
+  conv(D, QO->getDiscriminant());
+  append(buf, D);
+  append(buf, x);
+  append(buf, y);
+  append(buf, mu);
+  append(buf, ZZ(t));
+
+  hash(r, buf);
+}
+
+
+
+//
+// ClassGroupVDF<T>::prove_wesolowski()
+//
+// Task:
+//      computes the Wesolowski proof pi = g^floor(2^t/l) of y = g^(2^t)
+//      from the checkpoints:  with floor(2^t/l) = sum_j q_j 2^(j s),
+//      pi = prod_j G(j s)^q_j.
+//
+
+template <class T> void ClassGroupVDF<T>::prove_wesolowski (QuadraticIdealBase<T> &pi, long t) const
+{
+  std::vector< QuadraticIdealBase<T> > G;
+  QuadraticIdealBase<T> y(*QO);
+  ZZ l, q, e;
+  long n, j;
+
+  get_checkpoints(G, t);
+  sqr->sqr_k(y, G.back(), t - (G.size() - 1) * interval);
+  challenge_prime(l, G[0], y, t);
+
+  // q = floor(2^t / l)
+  power2(q, t);
+  div(q, q, l);
+
+  // q_j = bits j s, ..., (j + 1) s - 1 of q
+  n = (NumBits(q) + interval - 1) / interval;
+  std::vector<ZZ> qj(n);
+  std::vector< QuadraticIdealBase<T> > A(G.begin(), G.begin() + n);
+  for (j = 0; j < n; ++j) {
+    RightShift(e, q, j * interval);
+    trunc(qj[j], e, interval);
+  }
+
+  multi_power(pi, A, qj);
+}
+
+
+
+//
+// ClassGroupVDF<T>::verify_wesolowski()
+//
+// Task:
+//      verifies the Wesolowski proof pi of y = g^(2^t):
+//          pi^l g^(2^t mod l) = y
+//
+
+template <class T> bool ClassGroupVDF<T>::verify_wesolowski (const QuadraticIdealBase<T> &g, const QuadraticIdealBase<T> &y,
+                                                          const QuadraticIdealBase<T> &pi, long t) const
+{
+  QuadraticIdealBase<T> A(*QO), B(*QO);
+  ZZ l, r;
+
+  if (!is_element(g) || !is_element(y) || !is_element(pi) || t < 0)
+    return false;
+
+  challenge_prime(l, g, y, t);
+  PowerMod(r, ZZ(2), t, l);
+
+  power(A, pi, l);
+  power(B, g, r);
+  multiply(A, A, B);
+
+  return is_equal(A, y);
+}
+
+
+
+//
+// ClassGroupVDF<T>::prove_pietrzak()
+//
+// Task:
+//      computes the Pietrzak proof (mu_1, ..., mu_n) of y = g^(2^t).  While
+//      x_i = prod_m G(2 m h)^a_m (h = t_i/2) with h a multiple of s,
+//          mu_i = prod_m G((2 m + 1) h)^a_m
+//      is a product of checkpoints; the new exponents are
+//      (r a_0, a_0, r a_1, a_1, ...).  Otherwise, mu_i is computed from x_i
+//      by h squarings.
+//
+
+template <class T> void ClassGroupVDF<T>::prove_pietrzak (std::vector< QuadraticIdealBase<T> > &proof, long t) const
+{
+  std::vector< QuadraticIdealBase<T> > G, A;
+  std::vector<ZZ> a(1, ZZ(1)), na;
+  QuadraticIdealBase<T> x(*QO), y(*QO), mu(*QO), P(*QO);
+  ZZ r;
+  long ti, h, m;
+  bool from_checkpoints = true;
+
+  get_checkpoints(G, t);
+  x.assign(G[0]);
+  sqr->sqr_k(y, G.back(), t - (G.size() - 1) * interval);
+
+  proof.clear();
+  for (ti = t; ti >= 2 && !(ti & 1); ti = h) {
+    h = ti >> 1;
+
+    from_checkpoints = from_checkpoints && (h % interval == 0);
+    if (from_checkpoints) {
+      A.clear();
+      for (m = 0; m < (long) a.size(); ++m)
+        A.push_back(G[((2*m + 1) * h) / interval]);
+      multi_power(mu, A, a);
+    }
+    else
+      sqr->sqr_k(mu, x, h);
+
+    proof.push_back(mu);
+    challenge(r, x, y, mu, ti);
+
+    // x = x^r mu, y = mu^r y
+    power(P, x, r);
+    multiply(x, P, mu);
+    power(P, mu, r);
+    multiply(y, P, y);
+
+    if (from_checkpoints) {
+      na.resize(2 * a.size());
+      for (m = 0; m < (long) a.size(); ++m) {
+        mul(na[2*m], r, a[m]);
+        na[2*m + 1] = a[m];
+      }
+      a.swap(na);
+    }
+  }
+}
+
+
+
+//
+// ClassGroupVDF<T>::verify_pietrzak()
+//
+// Task:
+//      verifies the Pietrzak proof of y = g^(2^t):  after the rounds,
+//      x^(2^t_n) = y is checked with t_n squarings.
+//
+
+template <class T> bool ClassGroupVDF<T>::verify_pietrzak (const QuadraticIdealBase<T> &g, const QuadraticIdealBase<T> &y,
+                                                        const std::vector< QuadraticIdealBase<T> > &proof, long t) const
+{
+  QuadraticIdealBase<T> x(*QO), z(*QO), P(*QO);
+  ZZ r;
+  long ti = t;
+
+  if (!is_element(g) || !is_element(y) || t < 0)
+    return false;
+
+  x.assign(g);
+  z.assign(y);
+
+  for (long i = 0; i < (long) proof.size(); ++i) {
+    if (ti < 2 || (ti & 1) || !is_element(proof[i]))
+      return false;
+
+    challenge(r, x, z, proof[i], ti);
+
+    power(P, x, r);
+    multiply(x, P, proof[i]);
+    power(P, proof[i], r);
+    multiply(z, P, z);
+
+    ti >>= 1;
+  }
+
+  sqr->sqr_k(P, x, ti);
+  return is_equal(P, z);
+}
@@ -49,9 +49,9 @@ void XGCD_LEFT(long & G, long & X, const long & A, const long & B)
 */
 
 void XGCD_PARTIAL(ZZ & R2, ZZ & R1, ZZ & C2, ZZ & C1, const ZZ & bound) {
-  static ZZ q, r, t1, t2;
-  static long A2, A1, TA, B2, B1, TB, rr2, rr1, Tr, qq, bb, T, T1;
-  static int i;
+  static thread_local ZZ q, r, t1, t2;
+  static thread_local long A2, A1, TA, B2, B1, TB, rr2, rr1, Tr, qq, bb, T, T1;
+  static thread_local int i;
 
   clear(C2);
   C1 = to_ZZ(-1);
@@ -139,9 +139,9 @@ void XGCD_PARTIAL(ZZ & R2, ZZ & R1, ZZ & C2, ZZ & C1, const ZZ & bound) {
 }
 
 void XGCD_PARTIAL(long & R2, long & R1, long & C2, long & C1, const ZZ & bound) {
-  static long q, r, t1, t2;
-  static long A2, A1, TA, B2, B1, TB, rr2, rr1, Tr, qq, bb, T, T1;
-  static int i;
+  static thread_local long q, r, t1, t2;
+  static thread_local long A2, A1, TA, B2, B1, TB, rr2, rr1, Tr, qq, bb, T, T1;
+  static thread_local int i;
 
   clear(C2);
   C1 = -1;
@@ -309,3 +309,32 @@ void XGCD_PARTIAL_REDUCE(GF2EX & R2, GF2EX & R1, GF2EX & B2, GF2EX & B1, long bo
   else
     HXGCD_PARTIAL_REDUCE(R2,R1,B2,B1,bound,even);
 }
+
+
+
+//
+// GF2nX versions
+//
+// The polynomials are of small degree (genus 4 at most), so the plain
+// Euclidean algorithm is always used.
+//
+
+void XGCD(GF2nX & G, GF2nX & X, GF2nX & Y, const GF2nX & A, const GF2nX & B)
+{
+  XGCD_PLAIN(G,X,Y,A,B);
+}
+
+void XGCD_LEFT(GF2nX & G, GF2nX & X, const GF2nX & A, const GF2nX & B)
+{
+  XGCD_LEFT_PLAIN(G,X,A,B);
+}
+
+void XGCD_PARTIAL(GF2nX & R2, GF2nX & R1, GF2nX & C2, GF2nX & C1, long bound)
+{
+  XGCD_PARTIAL_PLAIN(R2,R1,C2,C1,bound);
+}
+
+void XGCD_PARTIAL_REDUCE(GF2nX & R2, GF2nX & R1, GF2nX & B2, GF2nX & B1, long bound, bool even)
+{
+  XGCD_PARTIAL_REDUCE_PLAIN(R2,R1,B2,B1,bound,even);
+}
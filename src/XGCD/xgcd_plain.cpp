@@ -41,6 +41,12 @@ void XGCD_PLAIN(ZZ_pEX & G, ZZ_pEX & X, ZZ_pEX & Y, const ZZ_pEX & A, const ZZ_p
   XGCD_PLAIN_work<ZZ_pE,ZZ_pEX>(G,X,Y,A,B);
 }
 
+template <>
+void XGCD_PLAIN(GF2nX & G, GF2nX & X, GF2nX & Y, const GF2nX & A, const GF2nX & B)
+{
+  XGCD_PLAIN_work<GF2n,GF2nX>(G,X,Y,A,B);
+}
+
 
 
 //
@@ -77,6 +83,12 @@ void XGCD_LEFT_PLAIN(ZZ_pEX & G, ZZ_pEX & X, const ZZ_pEX & A, const ZZ_pEX & B)
   XGCD_LEFT_PLAIN_work<ZZ_pE,ZZ_pEX>(G,X,A,B);
 }
 
+template <>
+void XGCD_LEFT_PLAIN(GF2nX & G, GF2nX & X, const GF2nX & A, const GF2nX & B)
+{
+  XGCD_LEFT_PLAIN_work<GF2n,GF2nX>(G,X,A,B);
+}
+
 
 
 //
@@ -138,3 +150,57 @@ XGCD_PARTIAL_REDUCE_PLAIN(GF2EX & R2, GF2EX & R1, GF2EX & B2, GF2EX & B1, long b
       B1 = r;
     }
 }
+
+
+
+// GF2nX versions (same as GF2EX)
+
+void
+XGCD_PARTIAL_PLAIN(GF2nX & R2, GF2nX & R1, GF2nX & C2, GF2nX & C1, long bound)
+{
+#ifdef TRACE_XGCD
+  cout << "--> IN XGCD_PARTIAL_PLAIN" << endl;
+#endif
+  GF2nX q, r;
+
+  clear(C2);
+  set(C1);
+
+  while (deg (R1) > bound)
+    {
+      DivRem (q, R2, R2, R1);
+      swap(R2,R1);
+
+      // r = C2 + q C1
+      mul(r,q,C1);
+      add(r,C2,r);
+      C2 = C1;
+      C1 = r;
+    }
+}
+
+
+
+void
+XGCD_PARTIAL_REDUCE_PLAIN(GF2nX & R2, GF2nX & R1, GF2nX & B2, GF2nX & B1, long bound, bool even)
+{
+#ifdef TRACE_XGCD
+  cout << "--> IN XGCD_PARTIAL_REDUCE_PLAIN" << endl;
+#endif
+  GF2nX q, r;
+
+  set(B2);
+  clear(B1);
+
+  while (deg (R1) > bound || (deg(R1) == bound && !even))
+    {
+      DivRem (q, R2, R2, R1);
+      swap(R2,R1);
+
+      // r = B2 + q B1
+      mul(r,q,B1);
+      add(r,B2,r);
+      B2 = B1;
+      B1 = r;
+    }
+}
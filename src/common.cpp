@@ -4,6 +4,8 @@
  * @brief implementation of non-templated functions defined in common.hpp
  */
 
+#include <vector>
+
 #include <ANTL/common.hpp>
 
 namespace ANTL {
@@ -143,6 +145,135 @@ namespace ANTL {
   }
 
 
+  /*
+   * Function: Jacobi_base (block version)
+   * Purpose: computes J[i] = (a[i]/n[i]) for 0 <= i < len, where each a[i]
+   *          is reduced mod the odd n[i] (e.g., one residue of the same
+   *          number per prime).  The lanes are advanced in lockstep, so the
+   *          independent reduction chains overlap instead of running one
+   *          after another.
+   */
+  void Jacobi_base (long *J, const long *a, const long *n, long len) {
+    std::vector<long> A(a, a + len), N(n, n + len);
+    long i, k, d, aa, nn, active;
+
+    for (i = 0; i < len; ++i)
+      J[i] = 1;
+
+    do {
+      active = 0;
+      for (i = 0; i < len; ++i) {
+        aa = A[i];
+        if (aa == 0)
+          continue;
+        nn = N[i];
+
+        k = 0;
+        while (!(aa & 1)) {
+          aa >>= 1;
+          ++k;
+        }
+
+        d = (nn & 7);
+        if ((k & 1) && (d == 3 || d == 5)) J[i] = -J[i];
+        if ((aa & 3) == 3 && (d & 3) == 3) J[i] = -J[i];
+
+        A[i] = nn % aa;
+        N[i] = aa;
+        active |= A[i];
+      }
+    } while (active);
+
+    for (i = 0; i < len; ++i)
+      if (N[i] != 1)
+        J[i] = 0;
+  }
+
+
+  /*
+   * Function: rem_block
+   * Purpose: computes r[i] = a mod n[i] for 0 <= i < len.  Each remainder
+   *          is a single pass over the words of a, which is faster than a
+   *          remainder tree over word-size moduli unless a has several
+   *          thousand bits.
+   */
+  void rem_block (long *r, const ZZ & a, const long *n, long len) {
+    for (long i = 0; i < len; ++i)
+      r[i] = rem(a, n[i]);
+  }
+
+  void rem_block (long *r, const long & a, const long *n, long len) {
+    for (long i = 0; i < len; ++i) {
+      r[i] = a % n[i];
+      if (r[i] < 0)
+        r[i] += n[i];
+    }
+  }
+
+
+  /*
+   * Function: ressol_long
+   * Purpose: computes a square root x of a modulo the prime p with the
+   *          Tonelli-Shanks algorithm (one exponentiation if p = 3 mod 4).
+   */
+  long ressol_long (long & x, long a, long p) {
+    long q, s, z, c, t, b, m, i, j;
+
+    a %= p;
+    if (a < 0)
+      a += p;
+
+    if (a == 0) {
+      x = 0;
+      return 0;
+    }
+
+    if (p == 2) {
+      x = a;
+      return 1;
+    }
+
+    if (PowerMod(a, (p - 1) >> 1, p) != 1)
+      return -1;
+
+    if ((p & 3) == 3) {
+      x = PowerMod(a, (p + 1) >> 2, p);
+      return 1;
+    }
+
+    // p - 1 = q 2^s, q odd
+    q = p - 1;
+    for (s = 0; !(q & 1); ++s)
+      q >>= 1;
+
+    // non-residue z
+    for (z = 2; Jacobi_base(z, p) != -1; ++z);
+
+    c = PowerMod(z, q, p);
+    x = PowerMod(a, (q + 1) >> 1, p);
+    t = PowerMod(a, q, p);
+    m = s;
+
+    while (t != 1) {
+      // least i with t^(2^i) = 1
+      b = t;
+      for (i = 0; b != 1; ++i)
+        b = MulMod(b, b, p);
+
+      b = c;
+      for (j = 0; j < m - i - 1; ++j)
+        b = MulMod(b, b, p);
+
+      x = MulMod(x, b, p);
+      c = MulMod(b, b, p);
+      t = MulMod(t, c, p);
+      m = i;
+    }
+
+    return 1;
+  }
+
+
   long Jacobi(const long & a, const long & n) {
     long temp = a % n;
     if (temp < 0)  temp += n;
@@ -388,4 +519,20 @@ namespace ANTL {
 //   }
 
 
+  bool test_Dcoeff(const ZZ_pX & D) {
+    return (Jacobi_base(rep(LeadCoeff(D)), ZZ_p::modulus()) == 1);
+  }
+
+  bool test_Dcoeff(const zz_pX & D) {
+    return (Jacobi_base(rep(LeadCoeff(D)), zz_p::modulus()) == 1);
+  }
+
+  bool test_Dcoeff(const GF2EX & f, const GF2EX & h) {
+    GF2E c;
+    sqr(c, LeadCoeff(h));
+    div(c, LeadCoeff(f), c);
+    return IsZero(trace(c));
+  }
+
+
 } // ANTL
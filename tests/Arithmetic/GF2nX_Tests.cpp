@@ -0,0 +1,132 @@
+#ifndef GF2NX_TEST
+#define GF2NX_TEST
+
+#include "../catch.hpp"
+#include <NTL/GF2X.h>
+#include <ANTL/Arithmetic/GF2nX.hpp>
+#include <ANTL/XGCD/xgcd.hpp>
+
+using namespace NTL;
+
+// a b mod P, bit by bit
+static unsigned long gf2n_naive_mul (unsigned long a, unsigned long b)
+{
+  GF2X A, B, P;
+  GF2n x, y;
+
+  x.rep = a;
+  y.rep = b;
+  conv(A, x);
+  conv(B, y);
+  conv(P, GF2n(GF2n::low));
+  SetCoeff(P, GF2n::degree());
+  MulMod(A, A, B, P);
+  conv(x, A);
+  return x.rep;
+}
+
+TEST_CASE("GF2n: field arithmetic", "[GF2nX]") {
+    SetSeed(ZZ(1));
+
+    long ns[] = { 7, 31, 61, 64 };
+    for (long k = 0; k < 4; ++k) {
+        GF2n::init(ns[k]);
+        long solvable = 0;
+
+        for (long i = 0; i < 500; ++i) {
+            GF2n a, b, c, d, z;
+            random(a);
+            random(b);
+
+            mul(c, a, b);
+            REQUIRE(c.rep == gf2n_naive_mul(a.rep, b.rep));
+            REQUIRE(c.rep <= GF2n::mask);
+
+            if (!IsZero(a)) {
+                inv(d, a);
+                REQUIRE(IsOne(d * a));
+                REQUIRE(c / a == b);
+            }
+
+            sqr(c, a);
+            SqrRoot(d, c);
+            REQUIRE(d == a);
+
+            // z^2 + z = a^2 + a always has a solution
+            add(c, c, a);
+            REQUIRE(SolveArtinSchreier(z, c));
+            REQUIRE(z*z + z == c);
+
+            // ... and z^2 + z = b for about half of the b
+            if (SolveArtinSchreier(z, b)) {
+                REQUIRE(z*z + z == b);
+                ++solvable;
+            }
+
+            // GF2E agrees
+            GF2E ea, eb;
+            conv(ea, a);
+            conv(eb, b);
+            conv(d, ea*eb);
+            REQUIRE(d == a*b);
+        }
+        REQUIRE(solvable > 150);
+        REQUIRE(solvable < 350);
+    }
+}
+
+TEST_CASE("GF2nX: polynomial arithmetic", "[GF2nX]") {
+    SetSeed(ZZ(2));
+    GF2n::init(61);
+
+    for (long i = 0; i < 300; ++i) {
+        GF2nX a, b, c, q, r, g, s, t;
+        GF2EX A, B, C;
+
+        random(a, 1 + i % 13);
+        random(b, 1 + i % 7);
+        if (IsZero(b))
+            continue;
+
+        // products agree with GF2EX
+        conv(A, a);
+        conv(B, b);
+        mul(c, a, b);
+        conv(C, c);
+        REQUIRE(C == A*B);
+        sqr(c, a);
+        REQUIRE(c == a*a);
+
+        // aliasing
+        c = a;
+        mul(c, c, c);
+        REQUIRE(c == a*a);
+
+        DivRem(q, r, a, b);
+        REQUIRE(q*b + r == a);
+        REQUIRE(deg(r) < deg(b));
+        REQUIRE(q == a / b);
+        REQUIRE(r == a % b);
+
+        XGCD(g, s, t, a, b);
+        REQUIRE(s*a + t*b == g);
+        GCD(c, a, b);
+        REQUIRE(c == g);
+
+        XGCD_LEFT(g, s, a, b);
+        REQUIRE((s*a) % b == g % b);
+
+        // evaluation is a ring homomorphism
+        GF2n x, y, z;
+        random(x);
+        eval(y, a, x);
+        eval(z, b, x);
+        eval(x, a*b, x);
+        REQUIRE(x == y*z);
+    }
+
+    GF2nX a;
+    random(a, GF2NX_MAX_LEN);
+    REQUIRE_THROWS(a*a);
+}
+#endif
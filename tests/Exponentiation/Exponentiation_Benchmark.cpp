@@ -0,0 +1,452 @@
+/**
+ * @file Exponentiation_Benchmark.cpp
+ * @brief Benchmark of all single, double and multi-exponentiation methods
+ *        over several base types and group sizes, with the number of group
+ *        operations next to the time.
+ *
+ * usage:  expo_bench [count] [bits ...]     (default 100 128 256 512)
+ *
+ * The base types are zz_p (word-size prime), ZZ_p (256 and 1024-bit primes),
+ * and reduced ideals of imaginary quadratic orders (QuadraticIdealBase<long>
+ * with 32 and 40-bit discriminants, QuadraticIdealBase<ZZ> with 256 and
+ * 1024-bit discriminants; NUCOMP, NUDUPL and NUCUBE, then reduction).  Every
+ * element is wrapped in Element<T>, whose arithmetic counts the operations,
+ * so the exponentiation classes run unchanged on every base type.
+ *
+ * The output is CSV, one line per method and exponent size, with the average
+ * time (microseconds) and operation counts of one exponentiation (one row for
+ * multi-exponentiation), and ok = 1 if all results match the binary method:
+ *
+ *   type,size,family,method,bits,count,us,mul,sqr,cub,inv,ok
+ *
+ * The bases differ for every exponentiation, so per-base precomputations are
+ * included in the times of the variable-base methods; the tables of
+ * ExponentiationFixedBase and the calibration of ExponentiationAuto are not.
+ * ExponentiationYao keeps the squarings of the first base it is given, so it
+ * is run as a fixed-base method.
+ */
+
+#include <iostream>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+
+#include <NTL/ZZ.h>
+#include <NTL/ZZ_p.h>
+#include <NTL/lzz_p.h>
+
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/Reduce/ReducePlainImag.hpp>
+#include <ANTL/Quadratic/Multiply/MultiplyNucomp.hpp>
+#include <ANTL/Quadratic/Square/SquareNudupl.hpp>
+#include <ANTL/Quadratic/Cube/CubeNucube.hpp>
+#include <ANTL/Exponentiation/InversionFree.hpp>
+
+NTL_CLIENT
+using namespace ANTL;
+
+
+//
+// arithmetic of the base types
+//
+
+template < class T > struct Group;
+
+template <> struct Group<zz_p>
+{
+  static void mul (zz_p &C, const zz_p &A, const zz_p &B) { NTL::mul(C, A, B); }
+  static void sqr (zz_p &C, const zz_p &A) { NTL::sqr(C, A); }
+  static void cub (zz_p &C, const zz_p &A) { zz_p t; NTL::sqr(t, A); NTL::mul(C, t, A); }
+  static void inv (zz_p &C, const zz_p &A) { NTL::inv(C, A); }
+  static void one (zz_p &C) { set(C); }
+  static bool equal (const zz_p &A, const zz_p &B) { return A == B; }
+};
+
+template <> struct Group<ZZ_p>
+{
+  static void mul (ZZ_p &C, const ZZ_p &A, const ZZ_p &B) { NTL::mul(C, A, B); }
+  static void sqr (ZZ_p &C, const ZZ_p &A) { NTL::sqr(C, A); }
+  static void cub (ZZ_p &C, const ZZ_p &A) { ZZ_p t; NTL::sqr(t, A); NTL::mul(C, t, A); }
+  static void inv (ZZ_p &C, const ZZ_p &A) { NTL::inv(C, A); }
+  static void one (ZZ_p &C) { set(C); }
+  static bool equal (const ZZ_p &A, const ZZ_p &B) { return A == B; }
+};
+
+// reduced ideals:  every result is reduced, the inverse is the conjugate
+template < class R > struct Group< QuadraticIdealBase<R> >
+{
+  typedef QuadraticIdealBase<R> I;
+
+  static void mul (I &C, const I &A, const I &B) { A.get_QO()->get_mul_best()->multiply(C, A, B); C.reduce(); }
+  static void sqr (I &C, const I &A) { A.get_QO()->get_sqr_best()->square(C, A); C.reduce(); }
+  static void cub (I &C, const I &A) { A.get_QO()->get_cube_best()->cube(C, A); C.reduce(); }
+  static void inv (I &C, const I &A) { R b = -A.get_b(); C = A; C.set_b(b); C.reduce(); }
+  static void one (I &C) { C.assign_one(); }
+  static bool equal (const I &A, const I &B) { return A.IsEqual(B); }
+};
+
+
+//
+// elements with counted operations
+//
+
+struct OpCount {
+  long mul, sqr, cub, inv;
+};
+
+static OpCount ops = { 0, 0, 0, 0 };
+
+// T need not be default constructible (ideals need their order), so new
+// elements are copies of *proto.  ExponentiationYao marks the unused entries
+// of its table with conv<T>(NULL) (zero for fields), which sets unset.
+template < class T > struct Element
+{
+  T x;
+  bool unset;
+  static const T *proto;
+
+  Element () : x(*proto), unset(false) {}
+  explicit Element (const T &A) : x(A), unset(false) {}
+};
+
+template < class T > const T * Element<T>::proto = NULL;
+
+template < class T > inline void assign (Element<T> &C, const Element<T> &A) { C.x = A.x; C.unset = false; }
+template < class T > inline void mul (Element<T> &C, const Element<T> &A, const Element<T> &B) { ++ops.mul; Group<T>::mul(C.x, A.x, B.x); C.unset = false; }
+template < class T > inline void sqr (Element<T> &C, const Element<T> &A) { ++ops.sqr; Group<T>::sqr(C.x, A.x); C.unset = false; }
+template < class T > inline void cub (Element<T> &C, const Element<T> &A) { ++ops.cub; Group<T>::cub(C.x, A.x); C.unset = false; }
+template < class T > inline void inv (Element<T> &C, const Element<T> &A) { ++ops.inv; Group<T>::inv(C.x, A.x); C.unset = false; }
+template < class T > inline void id (Element<T> &C) { Group<T>::one(C.x); C.unset = false; }
+template < class T > inline bool equals (const Element<T> &A, const Element<T> &B) { return Group<T>::equal(A.x, B.x); }
+template < class T > inline bool operator== (const Element<T> &A, const Element<T> &B) { return Group<T>::equal(A.x, B.x); }
+template < class T > inline bool operator!= (const Element<T> &A, const Element<T> &B) { return !Group<T>::equal(A.x, B.x); }
+template < class T > inline void conv (Element<T> &C, long) { C.unset = true; }
+template < class T > inline bool operator== (const Element<T> &A, long) { return A.unset; }
+template < class T > inline bool operator!= (const Element<T> &A, long) { return !A.unset; }
+
+namespace ANTL {
+  template < class T > struct is_inversion_free< Element<T> >
+  {
+    static const bool value = is_inversion_free<T>::value;
+  };
+}
+
+#include <ANTL/Exponentiation/ExponentiationBinary.hpp>
+#include <ANTL/Exponentiation/ExponentiationNAF.hpp>
+#include <ANTL/Exponentiation/ExponentiationL2R.hpp>
+#include <ANTL/Exponentiation/ExponentiationWNAF.hpp>
+#include <ANTL/Exponentiation/ExponentiationSB3.hpp>
+#include <ANTL/Exponentiation/ExponentiationYao.hpp>
+#include <ANTL/Exponentiation/ExponentiationDoubleBaseStrictChain.hpp>
+#include <ANTL/Exponentiation/ExponentiationDoubleBaseUnsignedGreedy.hpp>
+#include <ANTL/Exponentiation/ExponentiationDoubleBaseSignedGreedy.hpp>
+#include <ANTL/Exponentiation/ExponentiationExtendedDoubleBase.hpp>
+#include <ANTL/Exponentiation/ExponentiationFixedBase.hpp>
+#include <ANTL/Exponentiation/ExponentiationAuto.hpp>
+#include <ANTL/Exponentiation/ExponentiationBatch.hpp>
+#include <ANTL/Exponentiation/DoubleExponentiation/DoubleExponentiationIL.hpp>
+#include <ANTL/Exponentiation/DoubleExponentiation/DoubleExponentiationJSF.hpp>
+#include <ANTL/Exponentiation/DoubleExponentiation/DoubleExponentiationHBTJSF.hpp>
+#include <ANTL/Exponentiation/MultiExponentiation/MultiExponentiationInterleaved.hpp>
+#include <ANTL/Exponentiation/MultiExponentiation/MultiExponentiationPippenger.hpp>
+
+
+//
+// one benchmark:  calls f(r) for 0 <= r < calls, and prints the time and
+// operations divided by count, and whether C matches ref
+//
+struct Setting {
+  const char *type;
+  long size;
+  long bits;
+  long count;
+};
+
+template < class E, class F >
+static void run (const Setting &s, const char *family, const char *method,
+                 vector<E> &C, const vector<E> &ref, long calls, F f)
+{
+  for (size_t r = 0; r < C.size(); ++r)
+    id(C[r]);
+
+  OpCount start = ops;
+  double t = GetTime();
+  for (long r = 0; r < calls; ++r)
+    f(r);
+  t = GetTime() - t;
+
+  bool ok = (C.size() == ref.size());
+  for (size_t r = 0; ok && r < ref.size(); ++r)
+    ok = equals(C[r], ref[r]);
+
+  double n = (double) s.count;
+  printf("%s,%ld,%s,%s,%ld,%ld,%.3f,%.1f,%.1f,%.1f,%.1f,%d\n",
+         s.type, s.size, family, method, s.bits, s.count, 1e6*t/n,
+         (ops.mul - start.mul)/n, (ops.sqr - start.sqr)/n,
+         (ops.cub - start.cub)/n, (ops.inv - start.inv)/n, ok ? 1 : 0);
+  fflush(stdout);
+}
+
+
+//
+// single, double and multi-exponentiation with all methods:  A and B hold
+// count random bases each, M the bases of the multi-exponentiations
+//
+template < class T >
+static void bench (const char *type, long size, const vector< Element<T> > &A,
+                   const vector< Element<T> > &B, const vector< Element<T> > &M,
+                   const vector<long> &bits)
+{
+  typedef Element<T> E;
+  long count = A.size(), k = M.size(), r, i;
+
+  for (size_t b = 0; b < bits.size(); ++b) {
+    Setting s = { type, size, bits[b], count };
+    vector<ZZ> m(count), n(count);
+    vector< vector<ZZ> > nm(count, vector<ZZ>(k));
+    vector<E> C(count), ref(count), tmp(count);
+    E D;
+
+    for (r = 0; r < count; ++r) {
+      RandomLen(m[r], bits[b]);
+      RandomLen(n[r], bits[b]);
+      for (i = 0; i < k; ++i)
+        RandomLen(nm[r][i], bits[b]);
+    }
+
+    // single exponentiation, C[r] = A[r]^n[r]
+    ExponentiationBinary<E> ebin;
+    ExponentiationNAF<E> enaf;
+    ExponentiationL2R<E> el2r;
+    ExponentiationWNAF<E> ewnaf;
+    ExponentiationSB3<E> esb3;
+    ExponentiationYao<E> eyao;
+    ExponentiationDoubleBaseStrictChain<E> edbsc;
+    ExponentiationDoubleBaseUnsignedGreedy<E> edbug;
+    ExponentiationDoubleBaseSignedGreedy<E> edbsg;
+    ExponentiationExtendedDoubleBase<E> eexdb;
+    ExponentiationFixedBase<E> efb;
+    ExponentiationAuto<E> eauto;
+    ExponentiationBatch<E> ebatch;
+
+    // bounds on the exponents of 2 and 3 for the greedy double base methods
+    long twos = bits[b] + 1, threes = (2*bits[b])/3 + 1;
+    edbug.initialize(twos, threes);
+    edbsg.setBounds(twos, threes);
+    eexdb.setBounds(twos, threes);
+    eauto.calibrate(A[0]);
+    efb.initialize(A[0], bits[b]);
+
+    for (r = 0; r < count; ++r)
+      ebin.power(ref[r], A[r], n[r]);
+
+    run(s, "single", "Binary", C, ref, count, [&] (long r) { ebin.power(C[r], A[r], n[r]); });
+    run(s, "single", "NAF", C, ref, count, [&] (long r) { enaf.initialize(A[r], n[r]); enaf.power(C[r], A[r], n[r]); });
+    run(s, "single", "L2R", C, ref, count, [&] (long r) { el2r.initialize(A[r]); el2r.power(C[r], A[r], n[r]); });
+    run(s, "single", "WNAF4", C, ref, count, [&] (long r) { ewnaf.initialize(A[r], n[r], 4); ewnaf.power(C[r], A[r], n[r]); });
+    run(s, "single", "WNAF5", C, ref, count, [&] (long r) { ewnaf.initialize(A[r], n[r], 5); ewnaf.power(C[r], A[r], n[r]); });
+    run(s, "single", "SB3", C, ref, count, [&] (long r) { esb3.initialize(A[r], n[r]); esb3.power(C[r], A[r], n[r]); });
+    run(s, "single", "DBStrictChain", C, ref, count, [&] (long r) { edbsc.initialize(A[r]); edbsc.power(C[r], A[r], n[r]); });
+    run(s, "single", "DBUnsignedGreedy", C, ref, count, [&] (long r) { edbug.power(C[r], A[r], n[r]); });
+    run(s, "single", "DBSignedGreedy", C, ref, count, [&] (long r) { edbsg.power(C[r], A[r], n[r]); });
+    run(s, "single", "ExtendedDB", C, ref, count, [&] (long r) { eexdb.power(C[r], A[r], n[r]); });
+    run(s, "single", "Auto", C, ref, count, [&] (long r) { eauto.power(C[r], A[r], n[r]); });
+
+    // fixed base, C[r] = A[0]^n[r] (Yao keeps the powers A^(2^i) of the
+    // first base it is given)
+    for (r = 0; r < count; ++r)
+      ebin.power(tmp[r], A[0], n[r]);
+    run(s, "fixed", "FixedBase", C, tmp, count, [&] (long r) { efb.power(C[r], n[r]); });
+    run(s, "fixed", "Yao", C, tmp, count, [&] (long r) { eyao.power(C[r], A[0], n[r]); });
+
+    // batch, C[r] = A[r]^n[0] with one recoding
+    for (r = 0; r < count; ++r)
+      ebin.power(tmp[r], A[r], n[0]);
+    run(s, "batch", "Binary", C, tmp, count, [&] (long r) { ebin.power(C[r], A[r], n[0]); });
+    run(s, "batch", "BatchWNAF5", C, tmp, 1, [&] (long) { ebatch.setRecoding(ExponentRecoding::WNAF, 5); ebatch.power(C, A, n[0]); });
+    run(s, "batch", "BatchSB3", C, tmp, 1, [&] (long) { ebatch.setRecoding(ExponentRecoding::SB3); ebatch.power(C, A, n[0]); });
+
+    // double exponentiation, C[r] = A[r]^m[r] B[r]^n[r]
+    DoubleExponentiationIL<E> deil;
+    DoubleExponentiationJSF<E> djsf;
+    DoubleExponentiationHBTJSF<E> dhbt;
+
+    for (r = 0; r < count; ++r) {
+      ebin.power(ref[r], A[r], m[r]);
+      ebin.power(D, B[r], n[r]);
+      mul(ref[r], ref[r], D);
+    }
+
+    run(s, "double", "Binary", C, ref, count, [&] (long r) {
+        ebin.power(C[r], A[r], m[r]);
+        ebin.power(D, B[r], n[r]);
+        mul(C[r], C[r], D);
+      });
+    run(s, "double", "IL", C, ref, count, [&] (long r) { deil.initialize(A[r], B[r], m[r], n[r], 5, 5); deil.power(C[r], A[r], B[r], m[r], n[r]); });
+    run(s, "double", "JSF", C, ref, count, [&] (long r) { djsf.initialize(A[r], B[r], m[r], n[r]); djsf.power(C[r], A[r], B[r], m[r], n[r]); });
+    run(s, "double", "HBTJSF", C, ref, count, [&] (long r) { dhbt.power(C[r], A[r], B[r], m[r], n[r]); });
+
+    // multi-exponentiation, C[r] = prod M[i]^nm[r][i]
+    MultiExponentiationInterleaved<E> minter;
+    MultiExponentiationPippenger<E> mpipp;
+
+    for (r = 0; r < count; ++r) {
+      ebin.power(ref[r], M[0], nm[r][0]);
+      for (i = 1; i < k; ++i) {
+        ebin.power(D, M[i], nm[r][i]);
+        mul(ref[r], ref[r], D);
+      }
+    }
+
+    run(s, "multi", "Binary", C, ref, count, [&] (long r) {
+        ebin.power(C[r], M[0], nm[r][0]);
+        for (long j = 1; j < k; ++j) {
+          ebin.power(D, M[j], nm[r][j]);
+          mul(C[r], C[r], D);
+        }
+      });
+    run(s, "multi", "Interleaved", C, ref, 1, [&] (long) { minter.power(C, M, nm); });
+    run(s, "multi", "Pippenger", C, ref, 1, [&] (long) { mpipp.power(C, M, nm); });
+  }
+}
+
+
+//
+// random nonzero elements of a field
+//
+template < class T >
+static void random_units (vector< Element<T> > &A, long count)
+{
+  A.resize(count);
+  for (long r = 0; r < count; ++r)
+    do {
+      random(A[r].x);
+    } while (IsZero(A[r].x) || IsOne(A[r].x));
+}
+
+
+//
+// ideal classes of Delta = -p, p = 3 mod 4 a prime of the given size:
+// products of four random prime ideals and their inverses
+//
+template < class R >
+static void bench_ideals (const char *type, long size, const R &D, long count, long k,
+                          const vector<long> &bits)
+{
+  typedef Element< QuadraticIdealBase<R> > E;
+
+  QuadraticOrder<R> QO(D);
+  ReducePlainImag<R> red;
+  MultiplyNucomp<R> nucomp;
+  SquareNudupl<R> nudupl;
+  CubeNucube<R> nucube;
+
+  red.init(D, QO.getH());
+  nucomp.init(D, QO.getH());
+  nudupl.init(D, QO.getH());
+  nucube.init(D, QO.getH());
+  QO.set_red_best(red);
+  QO.set_mul_best(nucomp);
+  QO.set_sqr_best(nudupl);
+  QO.set_cube_best(nucube);
+
+  QuadraticIdealBase<R> P(QO);
+  P.assign_one();
+  E::proto = &P;
+
+  vector<E> primes, A, B, M;
+  R p;
+  for (p = 3; primes.size() < 16; p = NextPrime(p + 1))
+    if (P.assign_prime(p)) {
+      P.reduce();
+      primes.push_back(E(P));
+    }
+  P.assign_one();
+
+  vector<E> *sets[3] = { &A, &B, &M };
+  long sizes[3] = { count, count, k };
+  for (long j = 0; j < 3; ++j) {
+    sets[j]->resize(sizes[j]);
+    for (long r = 0; r < sizes[j]; ++r) {
+      E &X = (*sets[j])[r];
+      E Q;
+      assign(X, primes[RandomBnd(primes.size())]);
+      for (long i = 1; i < 4; ++i) {
+        assign(Q, primes[RandomBnd(primes.size())]);
+        if (RandomBnd(2))
+          inv(Q, Q);
+        mul(X, X, Q);
+      }
+    }
+  }
+
+  bench(type, size, A, B, M, bits);
+}
+
+
+int main (int argc, char **argv)
+{
+  long count = 100, k = 8;
+  vector<long> bits;
+
+  if (argc > 1)
+    count = atol(argv[1]);
+  for (long i = 2; i < argc; ++i)
+    bits.push_back(atol(argv[i]));
+  if (bits.empty()) {
+    bits.push_back(128);
+    bits.push_back(256);
+    bits.push_back(512);
+  }
+
+  SetSeed(ZZ(1));
+  printf("type,size,family,method,bits,count,us,mul,sqr,cub,inv,ok\n");
+
+  // zz_p, word-size prime
+  {
+    zz_p::init(GenPrime_long(NTL_SP_NBITS));
+    zz_p zero;
+    Element<zz_p>::proto = &zero;
+
+    vector< Element<zz_p> > A, B, M;
+    random_units(A, count);
+    random_units(B, count);
+    random_units(M, k);
+    bench("zz_p", NTL_SP_NBITS, A, B, M, bits);
+  }
+
+  // ZZ_p, multiprecision primes
+  for (long size = 256; size <= 1024; size *= 4) {
+    ZZ_p::init(GenPrime_ZZ(size));
+    ZZ_p zero;
+    Element<ZZ_p>::proto = &zero;
+
+    vector< Element<ZZ_p> > A, B, M;
+    random_units(A, count);
+    random_units(B, count);
+    random_units(M, k);
+    bench("ZZ_p", size, A, B, M, bits);
+  }
+
+  // reduced ideals, word-size discriminants (NUCUBE for long overflows
+  // above about 42 bits)
+  for (long size = 32; size <= 40; size += 8) {
+    long p;
+    do {
+      p = GenPrime_long(size);
+    } while (p % 4 != 3);
+    bench_ideals("QuadraticIdealBase<long>", size, -p, count, k, bits);
+  }
+
+  // reduced ideals, multiprecision discriminants
+  for (long size = 256; size <= 1024; size *= 4) {
+    ZZ p;
+    do {
+      RandomPrime(p, size);
+    } while (rem(p, 4) != 3);
+    bench_ideals("QuadraticIdealBase<ZZ>", size, -p, count, k, bits);
+  }
+
+  return 0;
+}
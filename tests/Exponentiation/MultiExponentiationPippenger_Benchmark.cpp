@@ -0,0 +1,116 @@
+/**
+ * @file MultiExponentiationPippenger_Benchmark.cpp
+ * @brief Benchmark of Pippenger's multi-exponentiation with many exponent
+ *        vectors (M = 10^3, 10^4, 10^5) and a fixed set of bases, against
+ *        interleaved wNAF multi-exponentiation of each vector.
+ *
+ * usage:  pippenger_bench [bases] [bits] [threads]     (default 8 64 1)
+ *
+ * The group is the multiplicative group modulo a word-size prime.  zz_p
+ * cannot be used with more than one thread (its modulus is thread local), so
+ * the elements are wrapped in Fp, whose modulus is shared by all threads.
+ */
+
+#include <iostream>
+#include <cstdlib>
+
+#include <NTL/ZZ.h>
+
+NTL_CLIENT
+
+// elements of (Z/pZ)^*, p < 2^(NTL_SP_NBITS)
+struct Fp {
+  long v;
+
+  static long p;
+  static mulmod_t pinv;
+
+  bool operator== (const Fp &B) const { return v == B.v; }
+};
+
+long Fp::p;
+mulmod_t Fp::pinv;
+
+inline void assign(Fp &C, const Fp &A) { C.v = A.v; }
+inline void mul(Fp &C, const Fp &A, const Fp &B) { C.v = MulMod(A.v, B.v, Fp::p, Fp::pinv); }
+inline void sqr(Fp &C, const Fp &A) { C.v = MulMod(A.v, A.v, Fp::p, Fp::pinv); }
+inline void inv(Fp &C, const Fp &A) { C.v = InvMod(A.v, Fp::p); }
+inline void id(Fp &C) { C.v = 1; }
+
+#include <ANTL/Exponentiation/MultiExponentiation/MultiExponentiationPippenger.hpp>
+#include <ANTL/Exponentiation/MultiExponentiation/MultiExponentiationInterleaved.hpp>
+
+using namespace ANTL;
+
+
+// C = prod A[i]^n[i], one modular exponentiation per base
+static long check_row (const vector<Fp> &A, const vector<ZZ> &n)
+{
+  ZZ p = ZZ(Fp::p), C = ZZ(1);
+
+  for (size_t i = 0; i < A.size(); ++i)
+    MulMod(C, C, PowerMod(ZZ(A[i].v), n[i], p), p);
+  return to_long(C);
+}
+
+
+int main (int argc, char **argv)
+{
+  long N = 8, bits = 64, threads = 1;
+  double t, t_pipp, t_inter;
+
+  if (argc > 1)
+    N = atol(argv[1]);
+  if (argc > 2)
+    bits = atol(argv[2]);
+  if (argc > 3)
+    threads = atol(argv[3]);
+
+  Fp::p = GenPrime_long(NTL_SP_NBITS);
+  Fp::pinv = PrepMulMod(Fp::p);
+  SetSeed(ZZ(1));
+
+  vector<Fp> A(N), C, D;
+  for (long i = 0; i < N; ++i)
+    A[i].v = 2 + RandomBnd(Fp::p - 2);
+
+  MultiExponentiationPippenger<Fp> pipp;
+  MultiExponentiationInterleaved<Fp> inter;
+  pipp.set_threads(threads);
+
+  cout << "p = " << Fp::p << ", " << N << " bases, " << bits << "-bit exponents, "
+       << threads << " thread(s)" << endl;
+  cout << "        M      pippenger    interleaved   ratio" << endl;
+
+  for (long M = 1000; M <= 100000; M *= 10) {
+    vector<vector<ZZ> > n(M, vector<ZZ>(N));
+    for (long j = 0; j < M; ++j)
+      for (long i = 0; i < N; ++i)
+        RandomBits(n[j][i], bits);
+
+    t = GetTime();
+    pipp.power(C, A, n);
+    t_pipp = GetTime() - t;
+
+    t = GetTime();
+    inter.power(D, A, n);
+    t_inter = GetTime() - t;
+
+    // spot check the first and last rows
+    for (long j = 0; j < M; j += M - 1)
+      if (C[j].v != check_row(A, n[j]) || !(C[j] == D[j])) {
+        cout << "ERROR:  RESULTS DO NOT MATCH (M = " << M << ", row " << j << ")" << endl;
+        return 1;
+      }
+
+    cout.width(9);
+    cout << M << "   ";
+    cout.width(10);
+    cout << t_pipp << " s   ";
+    cout.width(10);
+    cout << t_inter << " s   ";
+    cout << t_inter/t_pipp << endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file zz_p_DoubleBaseChainTest.cpp
+ * @brief Test program for optimized double base chains using zz_p as base
+ * type.  Build with -D_GLIBCXX_ASSERTIONS (make chain_test) so that any
+ * out-of-range access of the dynamic programming tables aborts.
+ */
+
+#include <NTL/lzz_p.h>
+
+inline void cub(NTL::zz_p& x, NTL::zz_p a)
+{
+     sqr(x,a);
+     mul(x,x,a);
+}
+
+#include <ANTL/Exponentiation/ExponentiationBinary.hpp>
+#include <ANTL/Exponentiation/ExponentRecoding.hpp>
+#include <ANTL/Exponentiation/DoubleBaseChainOptimizer.hpp>
+
+NTL_CLIENT
+using namespace ANTL;
+
+int main (int argc, char **argv)
+{
+  zz_p a, b_bin, b_opt;
+  ZZ n;
+  ExponentiationBinary<zz_p> ebin;
+  DoubleBaseChainOptimizer optimizer;
+  ExponentRecoding chain;
+  bool chains_match = true;
+
+  // costs (M, S, C):  equal, cheap squarings, cheap cubings, cheap multiplications
+  double costs[4][3] = { {1.0, 1.0, 1.0}, {1.0, 0.8, 1.5}, {1.0, 1.0, 0.9}, {0.5, 1.0, 2.0} };
+
+  zz_p::init(1073741827);
+  do {
+    random(a);
+  } while (IsZero(a) || IsOne(a));
+
+  // every small exponent, including those whose top bits end the chain
+  // with m = 2 (e.g. 2, 4, 6, 8, 12, 16, ...), and their negatives
+  for (long k = 0; k < 4; ++k) {
+    optimizer.setCosts(costs[k][0], costs[k][1], costs[k][2]);
+    for (long i = -64; i <= 64; ++i) {
+      if (i == 0)
+        continue;
+
+      n = i;
+      optimizer.optimize(chain,n);
+      chain.power(b_opt,a);
+
+      ebin.power(b_bin,a,abs(n));
+      if (i < 0)
+        inv(b_bin,b_bin);
+      if (b_opt != b_bin) {
+        cout << "n = " << n << ":  " << b_opt << " != " << b_bin << endl;
+        chains_match = false;
+      }
+    }
+  }
+
+  // random exponents of increasing length
+  for (long l = 2; l <= 512; l *= 2) {
+    RandomLen(n,l);
+    optimizer.optimize(chain,n);
+    chain.power(b_opt,a);
+    ebin.power(b_bin,a,n);
+    if (b_opt != b_bin) {
+      cout << "n = " << n << ":  " << b_opt << " != " << b_bin << endl;
+      chains_match = false;
+    }
+  }
+
+  if (chains_match)
+    cout << "RESULTS MATCH!" << endl;
+  else
+  {
+    cout << "ERROR:  RESULTS DO NOT MATCH!" << endl;
+    exit(1);
+  }
+}
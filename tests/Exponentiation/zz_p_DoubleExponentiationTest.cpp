@@ -19,9 +19,9 @@ inline bool equals(const NTL::zz_p& x,const NTL::zz_p& a)
 }  
 
 #include <ANTL/Exponentiation/ExponentiationBinary.hpp>
-#include <ANTL/DoubleExponentiation/DoubleExponentiationIL.hpp>
-#include <ANTL/DoubleExponentiation/DoubleExponentiationJSF.hpp>
-#include <ANTL/DoubleExponentiation/DoubleExponentiationHBTJSF.hpp>
+#include <ANTL/Exponentiation/DoubleExponentiation/DoubleExponentiationIL.hpp>
+#include <ANTL/Exponentiation/DoubleExponentiation/DoubleExponentiationJSF.hpp>
+#include <ANTL/Exponentiation/DoubleExponentiation/DoubleExponentiationHBTJSF.hpp>
 
 NTL_CLIENT
 using namespace ANTL;
@@ -73,14 +73,50 @@ int main (int argc, char **argv)
 
   dhbt.power(c_hbtjsf,a,b,m,n);
 
+  // the instances can be reused, with new bases and shorter exponents (the
+  // digits of the previous exponents must not be kept)
+  bool reuse_match = true;
+  for (long l = 16; l <= 256; l *= 2) {
+    zz_p ra, rb, rc_bin, rc, t;
+    ZZ rm, rn;
+
+    do {
+      random(ra);
+      random(rb);
+    } while (IsZero(ra) || IsZero(rb));
+    RandomLen(rm, l);
+    RandomLen(rn, l/2);
+
+    ebin.power(rc_bin,ra,rm);
+    ebin.power(t,rb,rn);
+    mul(rc_bin,rc_bin,t);
+
+    deil.initialize(ra,rb,rm,rn,5,5);
+    deil.power(rc,ra,rb,rm,rn);
+    if (rc != rc_bin)
+      reuse_match = false;
+
+    djsf.initialize(ra,rb,rm,rn);
+    djsf.power(rc,ra,rb,rm,rn);
+    if (rc != rc_bin)
+      reuse_match = false;
+
+    dhbt.power(rc,ra,rb,rm,rn);
+    if (rc != rc_bin)
+      reuse_match = false;
+  }
+
   // check and output results
   cout << "a^mb^n (naive) = " << c_bin << endl;
   cout << "a^mb^n (interleaving)    = " << c_il << endl;
   cout << "a^mb^n (joint sparse form) = " << c_jsf << endl;
   cout << "a^mb^n (hybrid binary-ternary joint sparse form) = " << c_hbtjsf << endl;
   
-  if ((c_bin == c_il) and (c_il == c_jsf) and (c_jsf == c_hbtjsf))
+  if ((c_bin == c_il) and (c_il == c_jsf) and (c_jsf == c_hbtjsf) and reuse_match)
     cout << "RESULTS MATCH!" << endl;
   else
+  {
     cout << "ERROR:  RESULTS DO NOT MATCH!" << endl;
+    exit(1);
+  }
 }
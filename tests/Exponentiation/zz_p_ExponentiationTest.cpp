@@ -28,16 +28,41 @@ inline bool equals(const NTL::zz_p& x,const NTL::zz_p& a)
 #include <ANTL/Exponentiation/ExponentiationDoubleBaseUnsignedGreedy.hpp>
 #include <ANTL/Exponentiation/ExponentiationDoubleBaseSignedGreedy.hpp>
 #include <ANTL/Exponentiation/ExponentiationExtendedDoubleBase.hpp>
+#include <ANTL/Exponentiation/ExponentiationFixedBase.hpp>
+#include <ANTL/Exponentiation/ExponentiationAuto.hpp>
+#include <ANTL/Exponentiation/ExponentRecoding.hpp>
+#include <ANTL/Exponentiation/DoubleBaseChainOptimizer.hpp>
+#include <ANTL/Exponentiation/ExponentiationBatch.hpp>
+#include <ANTL/Exponentiation/ElementOrder.hpp>
+#include <sstream>
+
+namespace ANTL {
+  template <> struct element_hash<NTL::zz_p>
+  {
+    std::size_t operator() (const NTL::zz_p &A) const { return rep(A); }
+  };
+}
 
 
 
 NTL_CLIENT
 using namespace ANTL;
 
+// reports a feature whose results do not match
+bool check (const char *feature, bool match)
+{
+  if (!match)
+    cout << "ERROR:  " << feature << " RESULTS DO NOT MATCH!" << endl;
+  return match;
+}
+
 	
 int main (int argc, char **argv)
 {
   zz_p a,b_bin,b_naf, b_l2r, b_wnaf, b_sb3, b_yao, b_dbsc, b_dbug, b_dbsg, b_exdb;
+  zz_p b_fb, b_fbs;
+  zz_p b_auto;
+  zz_p b_rec;
   ZZ n;
 
   // use GF(1073741827) for these tests
@@ -69,6 +94,8 @@ int main (int argc, char **argv)
   ExponentiationDoubleBaseUnsignedGreedy<zz_p> edbug;
   ExponentiationDoubleBaseSignedGreedy<zz_p> edbsg; 
   ExponentiationExtendedDoubleBase<zz_p> eexdb;
+  ExponentiationFixedBase<zz_p> efb, efbs;
+  ExponentiationAuto<zz_p> eauto;
 
   // compute a^n with available methods
   ebin.power(b_bin,a,n);
@@ -99,6 +126,154 @@ int main (int argc, char **argv)
   eexdb.setBounds(500,300);
   eexdb.power(b_exdb,a,n);
 
+  // the greedy double base methods walk their terms from the largest power
+  // of 2 down to the smallest:  every small exponent (few terms, often all of
+  // them used before the last squaring)
+  ExponentiationDoubleBaseSignedGreedy<zz_p> edbsg_small(500,300);
+  ExponentiationExtendedDoubleBase<zz_p> eexdb_small(4,500,300);
+  bool greedy_match = true;
+  zz_p b_greedy;
+  for (long i = 1; i <= 200; ++i) {
+    ZZ e = to_ZZ(i);
+    ebin.power(b_rec,a,e);
+    edbug.power(b_greedy,a,e);
+    if (b_greedy != b_rec)
+      greedy_match = false;
+    edbsg_small.power(b_greedy,a,e);
+    if (b_greedy != b_rec)
+      greedy_match = false;
+    eexdb_small.power(b_greedy,a,e);
+    if (b_greedy != b_rec)
+      greedy_match = false;
+  }
+
+  // instances reused with new bounds (setBounds), and with the bounds
+  // chosen from each exponent
+  ExponentiationExtendedDoubleBase<zz_p> eexdb_auto;
+  for (long l = 8; l <= 1024; l *= 2) {
+    ZZ e;
+    RandomLen(e,l);
+    ebin.power(b_rec,a,e);
+    edbsg.setBounds(l,l/2);
+    edbsg.power(b_greedy,a,e);
+    if (b_greedy != b_rec)
+      greedy_match = false;
+    eexdb.setBounds(l,l/2);
+    eexdb.power(b_greedy,a,e);
+    if (b_greedy != b_rec)
+      greedy_match = false;
+    eexdb_auto.power(b_greedy,a,e);
+    if (b_greedy != b_rec)
+      greedy_match = false;
+  }
+
+  efb.initialize(a,512,128);
+  efb.power(b_fb,n);
+
+  // fixed-base tables read back from a stream
+  stringstream tables;
+  efb.write(tables);
+  efbs.read(tables);
+  efbs.power(b_fbs,n);
+
+  // non-positive exponents are rejected, leaving the result and tables alone
+  bool fb_match = (b_fb == b_bin) && (b_fbs == b_bin);
+  ZZ bad[2] = { ZZ(0), -n };
+  for (long i = 0; i < 2; ++i) {
+    zz_p c = b_fb;
+    ExponentiationFixedBase<zz_p> efbe;
+    try { efb.power(c,bad[i]); fb_match = false; } catch (LogicErrorObject &) {}
+    try { efbe.power(c,a,bad[i]); fb_match = false; } catch (LogicErrorObject &) {}
+    if (c != b_fb || efbe.getMaxBits() != 0)
+      fb_match = false;
+  }
+
+  eauto.calibrate(a);
+  eauto.power(b_auto,a,n);
+
+  // cached recodings, replayed against the base (the second use is a hit)
+  ExponentRecodingCache recodings;
+  bool recodings_match = true;
+  for (int t = ExponentRecoding::NAF; t <= ExponentRecoding::STRICT_CHAIN; ++t) {
+    for (int k = 0; k < 2; ++k) {
+      recodings.power(b_rec,a,n,ExponentRecoding::Type(t));
+      if (b_rec != b_bin)
+        recodings_match = false;
+    }
+  }
+  if (recodings.getHits() != recodings.getMisses())
+    recodings_match = false;
+
+  // optimized double base chain, no more expensive than the greedy chain
+  DoubleBaseChainOptimizer optimizer;
+  ExponentRecoding optimal;
+  bool chain_match = true;
+  optimizer.optimize(optimal,n);
+  edbsc.setChain(optimal);
+  edbsc.power(b_rec,a,n);
+  if (b_rec != b_bin)
+    chain_match = false;
+  if (optimizer.cost(optimal) > optimizer.cost(recodings.get(n,ExponentRecoding::STRICT_CHAIN)))
+    chain_match = false;
+
+  // the signed-digit instances can be reused (their digits are cleared)
+  bool reuse_match = true;
+  enaf.power(b_rec,a,n);
+  if (b_rec != b_bin)
+    reuse_match = false;
+  esb3.power(b_rec,a,n);
+  if (b_rec != b_bin)
+    reuse_match = false;
+
+  // many bases, one recoding of n, split over 3 threads (each restores the
+  // modulus)
+  ExponentiationBatch<zz_p> ebatch;
+  vector<zz_p> bases(100), powers, inverses;
+  bool batch_match = true;
+  for (long i = 0; i < 100; ++i) {
+    do {
+      random(bases[i]);
+    } while (IsZero(bases[i]));
+  }
+  ebatch.set_threads(3);
+  ebatch.power(powers,bases,n);
+  ebatch.setRecoding(ExponentRecoding::SB3);
+  ebatch.power(inverses,bases,-n);
+  for (long i = 0; i < 100; ++i) {
+    ebin.power(b_rec,bases[i],n);
+    if ((powers[i] != b_rec) || (b_rec*inverses[i] != 1))
+      batch_match = false;
+  }
+
+  // order of a from the multiple p-1 (product tree), checked against the
+  // definition, and of an element of prime order with baby-step giant-step
+  ElementOrder<zz_p> eorder;
+  ZZ ord, ord_bsgs, pm1, e;
+  vector<ZZ> primes;
+  zz_p small;
+  bool order_match = true;
+  pm1 = zz_p::modulus() - 1;
+  eorder.order(ord,a,pm1);
+  ebin.power(b_rec,a,ord);
+  if (!IsOne(b_rec))
+    order_match = false;
+  ElementOrder<zz_p>::factor(primes,ord);
+  for (size_t i = 0; i < primes.size(); ++i) {
+    ebin.power(b_rec,a,ord/primes[i]);
+    if (IsOne(b_rec))
+      order_match = false;
+  }
+  ebin.power(small,a,pm1/primes.back());
+  eorder.order(ord,small,pm1);
+  if (!eorder.orderBSGS(ord_bsgs,small,ord) || ord_bsgs != ord)
+    order_match = false;
+  eorder.exponent(e,bases,pm1);
+  for (long i = 0; i < 100; ++i) {
+    ebin.power(b_rec,bases[i],e);
+    if (!IsOne(b_rec))
+      order_match = false;
+  }
+
   // check and output results
   cout << "a^n (binary) = " << b_bin << endl;
   cout << "a^n (naf)    = " << b_naf << endl;
@@ -110,8 +285,22 @@ int main (int argc, char **argv)
   cout << "a^n (dbug)   = " << b_dbug << endl;
   cout << "a^n (dbsg)   = " << b_dbsg << endl;
   cout << "a^n (exdb)   = " << b_exdb << endl;
+  cout << "a^n (fb)     = " << b_fb << endl;
+  cout << "a^n (auto)   = " << b_auto << " ("
+       << ExponentiationAuto<zz_p>::methodName(eauto.getTrace().back().method) << ")" << endl;
  
-  if ((b_bin == b_naf) && (b_naf == b_l2r) && (b_wnaf == b_bin) && (b_bin == b_sb3) && (b_bin == b_yao) && (b_dbsc == b_bin) && (b_dbug == b_bin) && (b_bin == b_dbsg) && (b_bin == b_exdb))
+  // each feature is checked separately, so that a failure can be traced to it
+  bool match = check("EXPONENTIATION", (b_bin == b_naf) && (b_naf == b_l2r) && (b_wnaf == b_bin) && (b_bin == b_sb3) && (b_bin == b_yao) && (b_dbsc == b_bin) && (b_dbug == b_bin) && (b_bin == b_dbsg) && (b_bin == b_exdb));
+  match = check("GREEDY DOUBLE BASE", greedy_match) && match;
+  match = check("FIXED-BASE", fb_match) && match;
+  match = check("AUTO", b_auto == b_bin) && match;
+  match = check("RECODING", recodings_match) && match;
+  match = check("OPTIMIZED CHAIN", chain_match) && match;
+  match = check("REUSED INSTANCE", reuse_match) && match;
+  match = check("BATCH", batch_match) && match;
+  match = check("ELEMENT ORDER", order_match) && match;
+
+  if (match)
     cout << "RESULTS MATCH!" << endl;
   else
   {
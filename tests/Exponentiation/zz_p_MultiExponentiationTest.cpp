@@ -11,7 +11,8 @@ inline void id(NTL::zz_p& A){
 }
 
 #include <ANTL/Exponentiation/ExponentiationBinary.hpp>
-#include <ANTL/MultiExponentiation/MultiExponentiationPippenger.hpp>
+#include <ANTL/Exponentiation/MultiExponentiation/MultiExponentiationPippenger.hpp>
+#include <ANTL/Exponentiation/MultiExponentiation/MultiExponentiationInterleaved.hpp>
 
 NTL_CLIENT
 using namespace ANTL;
@@ -20,8 +21,11 @@ int main (int argc, char **argv)
 {
   zz_p a,b,c,ca1_bin,cb1_bin,cc1_bin,ca2_bin,cb2_bin,cc2_bin,ca3_bin,cb3_bin,cc3_bin,c1_bin,c2_bin,c3_bin;
   ZZ m1,n1,r1,m2,n2,r2,m3,n3,r3;
-  vector<zz_p> A,C;
-  vector<vector<ZZ> > n;
+  vector<zz_p> A,C,D;
+  zz_p d1;
+  vector<vector<ZZ> > n, n8;
+  vector<zz_p> C8,D8,T8;
+  bool match8 = true;
 
   // use GF(1073741827) for these tests
   zz_p::init(1073741827);
@@ -68,6 +72,7 @@ int main (int argc, char **argv)
   // initialize exponentiation classes
   ExponentiationBinary<zz_p> ebin;
   MultiExponentiationPippenger<zz_p> pipp;
+  MultiExponentiationInterleaved<zz_p> inter;
 
   // compute a^{mi}b^{ni}c^{ri} with available methods
   ebin.power(ca1_bin,a,m1);
@@ -105,6 +110,28 @@ int main (int argc, char **argv)
   n[2].push_back(r3); 
 
   pipp.power(C,A,n);
+  inter.power(D,A,n);
+  inter.power(d1,A,n[0]);
+
+  // more exponent vectors than bases (several rows per output in pippenger)
+  n8.resize(8);
+  for (long j = 0; j < 8; ++j) {
+    n8[j].resize(3);
+    for (long i = 0; i < 3; ++i)
+      RandomBits(n8[j][i], 8 + 63*j);
+  }
+  pipp.power(C8,A,n8);
+  inter.power(D8,A,n8);
+  for (long j = 0; j < 8; ++j)
+    if (C8[j] != D8[j])
+      match8 = false;
+
+  // the same with 3 threads (each worker restores the modulus)
+  pipp.set_threads(3);
+  pipp.power(T8,A,n8);
+  for (long j = 0; j < 8; ++j)
+    if (T8[j] != D8[j])
+      match8 = false;
 
   // check and output results
   cout << endl;
@@ -116,7 +143,12 @@ int main (int argc, char **argv)
   cout << "a^{m2}b^{n2}c^{r2} (pippenger) = " << C[1] << endl;
   cout << "a^{m3}b^{n3}c^{r3} (pippenger) = " << C[2] << endl << endl;
 
-  if ((c1_bin == C[0]) and (c2_bin == C[1]) and (c3_bin == C[2]))
+  cout << "a^{m1}b^{n1}c^{r1} (interleaved) = " << D[0] << endl;
+  cout << "a^{m2}b^{n2}c^{r2} (interleaved) = " << D[1] << endl;
+  cout << "a^{m3}b^{n3}c^{r3} (interleaved) = " << D[2] << endl << endl;
+
+  if ((c1_bin == C[0]) and (c2_bin == C[1]) and (c3_bin == C[2]) and
+      (c1_bin == D[0]) and (c2_bin == D[1]) and (c3_bin == D[2]) and (c1_bin == d1) and match8)
     cout << "RESULTS MATCH!" << endl;
   else
     cout << "ERROR:  RESULTS DO NOT MATCH!" << endl;
@@ -0,0 +1,96 @@
+#ifndef COMPACTREPRESENTATION_ZZ_TEST
+#define COMPACTREPRESENTATION_ZZ_TEST
+
+#include "../catch.hpp"
+#include <ANTL/Quadratic/CompactRepresentation.hpp>
+#include <ANTL/Quadratic/Regulator/RegulatorBSGS.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+TEST_CASE("CompactRepresentation<ZZ>: small fundamental units", "[CompactRepresentation]") {
+
+    ZZ p = ZZ(1000003);
+    ZZ u, v;
+
+    SECTION("Delta = 13:  epsilon = (3 + sqrt(13))/2") {
+        QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(13));
+        RegulatorBSGS<ZZ> bsgs = RegulatorBSGS<ZZ>(quad_order1, 40);
+        CompactRepresentation<ZZ> E = CompactRepresentation<ZZ>(quad_order1);
+        bsgs.fundamental_unit(E);
+
+        REQUIRE(E.eval_mod(u, v, p));
+        REQUIRE(MulMod(u, 2, p) == 3);
+        REQUIRE(MulMod(v, 2, p) == 1);
+        REQUIRE(E.norm() == -1);
+        REQUIRE(E.sign() == 1);
+    }
+
+    SECTION("Delta = 12:  epsilon = 2 + sqrt(3)") {
+        QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(12));
+        RegulatorBSGS<ZZ> bsgs = RegulatorBSGS<ZZ>(quad_order1, 40);
+        CompactRepresentation<ZZ> E = CompactRepresentation<ZZ>(quad_order1);
+        bsgs.fundamental_unit(E);
+
+        // 2 + sqrt(3) = 2 + sqrt(12)/2
+        REQUIRE(E.eval_mod(u, v, p));
+        REQUIRE(u == 2);
+        REQUIRE(MulMod(v, 2, p) == 1);
+        REQUIRE(E.norm() == 1);
+    }
+}
+
+TEST_CASE("CompactRepresentation<ZZ>: large fundamental unit", "[CompactRepresentation]") {
+
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(1000000036));
+    RegulatorBSGS<ZZ> bsgs = RegulatorBSGS<ZZ>(quad_order1, 40);
+    CompactRepresentation<ZZ> E = CompactRepresentation<ZZ>(quad_order1);
+    bsgs.fundamental_unit(E);
+
+    // epsilon has about 7000 digits, the compact representation a few hundred
+    REQUIRE(E.length() < 20);
+    REQUIRE(E.size_in_bits() < 2000);
+
+    RR l;
+    E.log(l);
+    REQUIRE(abs(l - to_RR(16529.39221135576)) < to_RR(1e-6));
+
+    // N(epsilon) = u^2 - v^2 Delta mod p
+    ZZ p = ZZ(1000003), u, v, n;
+    REQUIRE(E.eval_mod(u, v, p));
+    n = (u*u - v*v*ZZ(1000000036)) % p;
+    REQUIRE(n == (E.norm() + p) % p);
+
+    // epsilon / epsilon = 1
+    CompactRepresentation<ZZ> Einv = CompactRepresentation<ZZ>(quad_order1);
+    inv(Einv, E);
+    mul(Einv, Einv, E);
+    REQUIRE(Einv.length() == 2*E.length());
+    REQUIRE(Einv.eval_mod(u, v, p));
+    REQUIRE(u == 1);
+    REQUIRE(IsZero(v));
+}
+
+TEST_CASE("CompactRepresentation<ZZ>: distance that is not a unit", "[CompactRepresentation]") {
+
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(1000000036));
+    RegulatorBSGS<ZZ> bsgs = RegulatorBSGS<ZZ>(quad_order1, 40);
+    CompactRepresentation<ZZ> E = CompactRepresentation<ZZ>(quad_order1);
+
+    // the order with theta ~ epsilon^(3/4):  no reduced ideal near this
+    // distance is the order itself
+    FPRepresentation<ZZ> eps = bsgs.fundamental_unit();
+    long p = eps.get_precision();
+    ZZ d = 3*eps.get_d();
+    long k = eps.get_k() - 1;
+    d >>= 1;
+    if (NumBits(d) > p + 1) {
+        d >>= 1;
+        ++k;
+    }
+    eps.set_distance(d, k);
+
+    REQUIRE_THROWS(compact_representation(E, eps));
+}
+
+#endif
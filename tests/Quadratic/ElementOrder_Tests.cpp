@@ -0,0 +1,88 @@
+#ifndef ELEMENTORDER_TEST
+#define ELEMENTORDER_TEST
+
+#include "../catch.hpp"
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/Reduce/ReducePlainImag.hpp>
+#include <ANTL/Exponentiation/ElementOrder.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+// Cl(-3299) = C3 x C9:  the classes of the prime ideals over 3, 5 and 13
+// have order 9, those over 11 and 23 have order 3
+template <class T> static void check_orders (const ZZ & N)
+{
+    T D = to<T>(-3299);
+    QuadraticOrder<T> QO(D);
+
+    ReducePlainImag<T> red;
+    red.init(D, to<T>(0));
+    QO.set_red_best(red);
+    MultiplyNucomp<T> mul_nucomp;
+    mul_nucomp.init(D, to<T>(0));
+    QO.set_mul_best(mul_nucomp);
+    SquareNudupl<T> sqr_nudupl;
+    sqr_nudupl.init(D, to<T>(0));
+    QO.set_sqr_best(sqr_nudupl);
+
+    long p[5] = {3, 5, 11, 13, 23};
+    long ord_p[5] = {9, 9, 3, 9, 3};
+    ElementOrder< QuadraticIdealBase<T> > eorder;
+    QuadraticIdealBase<T> G(QO), C(QO), one(QO);
+    std::vector< QuadraticIdealBase<T> > gens;
+    ZZ ord, e;
+
+    element_group< QuadraticIdealBase<T> >::identity(one, G);
+    REQUIRE(one.IsOne());
+
+    for (long i = 0; i < 5; ++i) {
+        REQUIRE(G.assign_prime(to<T>(p[i])));
+        G.reduce();
+
+        eorder.order(ord, G, N);
+        REQUIRE(ord == ord_p[i]);
+
+        // G^ord is the reduced unit ideal, G^(ord/3) is not
+        C = G;
+        for (long k = 1; k < ord_p[i]; ++k)
+            element_group< QuadraticIdealBase<T> >::multiply(C, C, G);
+        REQUIRE(element_group< QuadraticIdealBase<T> >::equal(C, one));
+        C = G;
+        for (long k = 1; k < ord_p[i] / 3; ++k)
+            element_group< QuadraticIdealBase<T> >::multiply(C, C, G);
+        REQUIRE(!element_group< QuadraticIdealBase<T> >::equal(C, one));
+
+        gens.push_back(G);
+    }
+
+    // the classes over 11 and 23 generate a subgroup of exponent 3, all of
+    // them the whole group, of exponent 9
+    std::vector< QuadraticIdealBase<T> > small(gens.begin() + 2, gens.begin() + 3);
+    small.push_back(gens[4]);
+    eorder.exponent(e, small, N);
+    REQUIRE(e == 3);
+    eorder.exponent(e, gens, N);
+    REQUIRE(e == 9);
+}
+
+TEST_CASE("ElementOrder: ideal classes of Cl(-3299)", "[ElementOrder]") {
+
+    SECTION("QuadraticIdealBase<long>, multiple of the class number") {
+        check_orders<long>(ZZ(27));
+    }
+
+    SECTION("QuadraticIdealBase<long>, baby-step giant-step") {
+        check_orders<long>(ZZ(0));
+    }
+
+    SECTION("QuadraticIdealBase<ZZ>, multiple of the class number") {
+        check_orders<ZZ>(ZZ(27));
+    }
+
+    SECTION("QuadraticIdealBase<ZZ>, baby-step giant-step") {
+        check_orders<ZZ>(ZZ(0));
+    }
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef QUADRATICLFUNCTION_ZZ_TEST
+#define QUADRATICLFUNCTION_ZZ_TEST
+
+#include "../../catch.hpp"
+#include <ANTL/Quadratic/Lfunction/QuadraticLfunction.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+TEST_CASE("QuadraticLfunction<ZZ>: agrees with the class number formula", "[QuadraticLfunction]") {
+
+    RR l, lower, upper;
+
+    SECTION("Delta = -23:  L = 3 pi / sqrt(23)") {
+        QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(-23));
+        QuadraticLfunction<ZZ> L1 = QuadraticLfunction<ZZ>(quad_order1);
+        L1.bounds(lower, upper);
+
+        REQUIRE(lower < to_RR(1.9652020541078592));
+        REQUIRE(upper > to_RR(1.9652020541078592));
+
+        L1.set_Q(100000);
+        L1.L(l);
+        REQUIRE(abs(l - to_RR(1.9652020541078592)) < to_RR(1e-3));
+    }
+
+    SECTION("Delta = 13:  L = 2 R / sqrt(13)") {
+        QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(13));
+        QuadraticLfunction<ZZ> L1 = QuadraticLfunction<ZZ>(quad_order1);
+        L1.set_error(0.01);
+
+        REQUIRE(L1.error_bound() <= 0.01);
+        L1.log_L(l);
+        REQUIRE(abs(l - log(to_RR(0.6627353910718455))) < L1.error_bound());
+    }
+}
+
+TEST_CASE("QuadraticLfunction<ZZ>: block Kronecker symbols", "[QuadraticLfunction]") {
+
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(to_ZZ("-1000000000000000000000000000004"));
+    QuadraticLfunction<ZZ> L1 = QuadraticLfunction<ZZ>(quad_order1);
+
+    const std::vector<long> & P = PrimeTable::primes(10000);
+    long n = PrimeTable::count(10000);
+    std::vector<long> chi(n);
+
+    REQUIRE(n == 1229);
+    L1.kronecker(chi.data(), P.data(), n);
+    for (long i = 0; i < n; ++i)
+        REQUIRE(chi[i] == Kronecker(quad_order1.getDiscriminant(), P[i]));
+}
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef QUADRATICLPOLYNOMIAL_ZZ_PX_TEST
+#define QUADRATICLPOLYNOMIAL_ZZ_PX_TEST
+
+#include "../../catch.hpp"
+#include <NTL/lzz_pX.h>
+#include <ANTL/Quadratic/Lfunction/QuadraticLpolynomial.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+// random squarefree f of degree n with leading coefficient c
+static void random_curve (zz_pX & f, long n, const zz_p & c)
+{
+  do {
+    random(f, n + 1);
+    SetCoeff(f, n, c);
+  } while (!IsOne(GCD(f, diff(f))));
+}
+
+// points of y^2 = f over F_p, by brute force
+static long naive_points (const zz_pX & f, long p)
+{
+  long N = 0;
+
+  for (long x = 0; x < p; ++x) {
+    zz_p fx = eval(f, zz_p(x));
+    for (long y = 0; y < p; ++y)
+      if (sqr(zz_p(y)) == fx)
+        ++N;
+  }
+
+  // points at infinity
+  if (deg(f) & 1)
+    return N + 1;
+  return N + 1 + Jacobi(rep(LeadCoeff(f)), p);
+}
+
+TEST_CASE("QuadraticLpolynomial<zz_pX>: point counting agrees with the Euler product", "[QuadraticLpolynomial]") {
+    zz_p::init(31);
+    SetSeed(ZZ(5));
+
+    // imaginary, real, unusual (3 is not a square mod 31)
+    long degrees[] = { 5, 6, 6, 7, 8 };
+    long leading[] = { 1, 1, 3, 1, 3 };
+
+    for (long k = 0; k < 5; ++k) {
+        zz_pX f;
+        random_curve(f, degrees[k], zz_p(leading[k]));
+
+        QuadraticOrder<zz_pX> QO(f);
+        QuadraticLpolynomial<zz_pX> euler(QO), points(QO);
+        points.set_point_counting(true);
+        points.set_threads(4);
+        REQUIRE(euler.is_exact());
+        REQUIRE(points.is_exact());
+
+        std::vector<ZZ> L1, L2;
+        REQUIRE(euler.polynomial(L1));
+        REQUIRE(points.polynomial(L2));
+        REQUIRE(L1 == L2);
+
+        ZZ N1, N2;
+        REQUIRE(euler.jacobian_order(N1));
+        REQUIRE(points.jacobian_order(N2));
+        REQUIRE(N1 == N2);
+        REQUIRE(N1 > 0);
+
+        // N_1 = q + 1 - a_1
+        ZZ N, a1;
+        points.count_points(N, 1);
+        points.coefficient(a1, 1);
+        REQUIRE(N == naive_points(f, 31));
+        REQUIRE(N == 32 + a1);
+    }
+}
+
+TEST_CASE("QuadraticLpolynomial<zz_pX>: threads do not change the character sums", "[QuadraticLpolynomial]") {
+    zz_p::init(101);
+    SetSeed(ZZ(6));
+
+    zz_pX f;
+    random_curve(f, 6, zz_p(1));
+
+    QuadraticOrder<zz_pX> QO(f);
+    QuadraticLpolynomial<zz_pX> L(QO);
+    ZZ t1, t2;
+
+    for (long nu = 1; nu <= 2; ++nu) {
+        L.set_threads(1);
+        L.character_sum(t1, nu);
+        L.set_threads(3);
+        L.character_sum(t2, nu);
+        REQUIRE(t1 == t2);
+    }
+}
+
+#endif
@@ -0,0 +1,126 @@
+/**
+ * @file MultiplyExplicit_zz_pX_Benchmark.cpp
+ * @brief Benchmark of scalar multiplication (n D) in the divisor class group
+ *        of genus 2 and genus 3 hyperelliptic curves y^2 = f(x) over zz_p:
+ *        explicit formulas (MultiplyExplicit, SquareExplicit) against the
+ *        generic NUCOMP and NUDUPL.
+ *
+ * usage:  explicit_bench [bits] [reps] [p]     (default 256 20 1000003)
+ */
+
+#include <iostream>
+#include <cstdlib>
+
+#include <NTL/ZZ.h>
+#include <NTL/lzz_pX.h>
+
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/Multiply/MultiplyNucomp.hpp>
+#include <ANTL/Quadratic/Multiply/MultiplyExplicit.hpp>
+#include <ANTL/Quadratic/Square/SquareNudupl.hpp>
+#include <ANTL/Quadratic/Square/SquareExplicit.hpp>
+#include <ANTL/Quadratic/Reduce/ReducePlainImag.hpp>
+
+NTL_CLIENT
+using namespace ANTL;
+
+
+// C = A^n (left-to-right binary), reduced
+static void scalar_mul (QuadraticIdealBase<zz_pX> &C, const QuadraticIdealBase<zz_pX> &A, const ZZ & n,
+                        MultiplyStrategy<zz_pX> &mul, SquareStrategy<zz_pX> &sqr)
+{
+  C.assign(A);
+  for (long i = NumBits(n) - 2; i >= 0; --i) {
+    sqr.square(C, C);
+    C.reduce();
+    if (bit(n, i)) {
+      mul.multiply(C, C, A);
+      C.reduce();
+    }
+  }
+}
+
+
+int main (int argc, char **argv)
+{
+  long bits = 256, reps = 20, p = 1000003;
+  double t, t_generic, t_explicit;
+
+  if (argc > 1)
+    bits = atol(argv[1]);
+  if (argc > 2)
+    reps = atol(argv[2]);
+  if (argc > 3)
+    p = atol(argv[3]);
+
+  zz_p::init(p);
+  SetSeed(ZZ(1));
+
+  for (long g = 2; g <= 3; ++g) {
+    zz_pX f, h, q;
+    ZZ n;
+
+    random(f, 2*g + 1);
+    SetCoeff(f, 2*g + 1);
+    clear(h);
+
+    QuadraticOrder<zz_pX> QO(f);
+
+    ReducePlainImag<zz_pX> red;
+    red.init(f, h, g);
+    QO.set_red_best(red);
+
+    MultiplyNucomp<zz_pX> nucomp;
+    nucomp.init(f, h, g);
+    SquareNudupl<zz_pX> nudupl;
+    nudupl.init(f, h, g);
+
+    MultiplyExplicit<zz_pX> mexp;
+    mexp.init(f, h, g);
+    SquareExplicit<zz_pX> sexp;
+    sexp.init(f, h, g);
+
+    // base:  a reduced ideal of degree g
+    QuadraticIdealBase<zz_pX> A(QO), P(QO), B(QO), C(QO);
+    A.assign_one();
+    for (long alpha = 1, cnt = 0; cnt < g; ++alpha) {
+      clear(q);
+      SetCoeff(q, 1);
+      SetCoeff(q, 0, -alpha);
+      if (P.assign_prime(q)) {
+        nucomp.multiply(A, A, P);
+        ++cnt;
+      }
+    }
+
+    t_generic = t_explicit = 0;
+    for (long r = 0; r < reps; ++r) {
+      RandomBits(n, bits);
+      SetBit(n, bits - 1);
+
+      t = GetTime();
+      scalar_mul(B, A, n, nucomp, nudupl);
+      t_generic += GetTime() - t;
+
+      t = GetTime();
+      scalar_mul(C, A, n, mexp, sexp);
+      t_explicit += GetTime() - t;
+
+      if (B != C) {
+        std::cerr << "genus " << g << ":  results differ" << std::endl;
+        return 1;
+      }
+    }
+
+    std::cout << "genus " << g << ", p = " << p << ", " << bits << " bit scalars, "
+              << reps << " reps" << std::endl;
+    std::cout << "  NUCOMP/NUDUPL:  " << t_generic / reps << " s per scalar multiplication" << std::endl;
+    std::cout << "  explicit:       " << t_explicit / reps << " s per scalar multiplication ("
+              << mexp.get_fallbacks() + sexp.get_fallbacks() << " fallbacks)" << std::endl;
+    if (t_explicit > 0)
+      std::cout << "  speedup:        " << t_generic / t_explicit << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,111 @@
+#ifndef MULTIPLY_EXPLICIT_ZZ_PX_TEST
+#define MULTIPLY_EXPLICIT_ZZ_PX_TEST
+
+#include "../../catch.hpp"
+#include <NTL/lzz_pX.h>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/Multiply/MultiplyExplicit.hpp>
+#include <ANTL/Quadratic/Multiply/MultiplyNucomp.hpp>
+#include <ANTL/Quadratic/Reduce/ReducePlainImag.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+// A = reduced product of the prime ideals over X - alpha, alpha = first, ...,
+// for the first g values of alpha for which they exist
+static void explicit_random_ideal (QuadraticIdealBase<zz_pX> &A, MultiplyNucomp<zz_pX> &nucomp,
+                                   long first, long g)
+{
+  QuadraticIdealBase<zz_pX> P(*A.get_QO());
+  zz_pX p;
+
+  A.assign_one();
+  for (long alpha = first, n = 0; n < g; ++alpha) {
+    clear(p);
+    SetCoeff(p, 1);
+    SetCoeff(p, 0, -alpha);
+    if (!P.assign_prime(p))
+      continue;
+    nucomp.multiply(A, A, P);
+    A.reduce();
+    ++n;
+  }
+}
+
+TEST_CASE("MultiplyExplicit<zz_pX>: genus 2 and 3 products agree with NUCOMP", "[MultiplyExplicit]") {
+    zz_p::init(1000003);
+    SetSeed(ZZ(1));
+
+    for (long g = 2; g <= 3; ++g) {
+        zz_pX f, h, d;
+
+        // y^2 = f(x), deg f = 2g + 1
+        random(f, 2*g + 1);
+        SetCoeff(f, 2*g + 1);
+        clear(h);
+
+        QuadraticOrder<zz_pX> QO(f);
+        REQUIRE(QO.getGenus() == g);
+
+        ReducePlainImag<zz_pX> red;
+        red.init(f, h, g);
+        QO.set_red_best(red);
+
+        MultiplyNucomp<zz_pX> nucomp;
+        nucomp.init(f, h, g);
+
+        MultiplyExplicit<zz_pX> mexp;
+        mexp.init(f, h, g);
+
+        QuadraticIdealBase<zz_pX> A(QO), B(QO), C(QO), D(QO);
+
+        explicit_random_ideal(A, nucomp, 1, g);
+        explicit_random_ideal(B, nucomp, 1000, g);
+        REQUIRE(deg(A.get_a()) == g);
+        REQUIRE(deg(B.get_a()) == g);
+
+        // walk A, B, AB, A B^2, ... and squares
+        mexp.reset_fallbacks();
+        for (long i = 0; i < 200; ++i) {
+            mexp.multiply(C, A, B);
+            nucomp.multiply(D, A, B);
+            D.reduce();
+            REQUIRE(C == D);
+
+            // C is reduced and b^2 - a c = f
+            REQUIRE(deg(C.get_a()) <= g);
+            REQUIRE(IsOne(LeadCoeff(C.get_a())));
+            REQUIRE(deg(C.get_b()) < deg(C.get_a()));
+            d = C.get_b()*C.get_b() - C.get_a()*C.get_c();
+            REQUIRE(d == f);
+
+            mexp.multiply(D, C, C);
+            nucomp.multiply(C, C, C);
+            C.reduce();
+            REQUIRE(C == D);
+
+            A.assign(B);
+            B.assign(D);
+        }
+
+        // special cases (equal a, degree < g) are very rare for random ideals
+        REQUIRE(mexp.get_fallbacks() < 10);
+
+        // special cases:  the inverse of A, a prime ideal, the unit ideal
+        conjugate(B, A);
+        mexp.multiply(C, A, B);
+        REQUIRE(C.IsOne());
+
+        explicit_random_ideal(B, nucomp, 1, 1);
+        mexp.multiply(C, A, B);
+        nucomp.multiply(D, A, B);
+        D.reduce();
+        REQUIRE(C == D);
+
+        B.assign_one();
+        mexp.multiply(C, A, B);
+        REQUIRE(C == A);
+    }
+}
+#endif
@@ -0,0 +1,150 @@
+#ifndef MULTIPLY_NUCOMP_GF2NX_TEST
+#define MULTIPLY_NUCOMP_GF2NX_TEST
+
+#include "../../catch.hpp"
+#include <ANTL/Arithmetic/GF2nX.hpp>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/Multiply/MultiplyNucomp.hpp>
+#include <ANTL/Quadratic/Square/SquareNudupl.hpp>
+#include <ANTL/Quadratic/Cube/CubeNucube.hpp>
+#include <ANTL/Quadratic/Reduce/ReduceFast.hpp>
+#include <ANTL/Quadratic/Reduce/ReduceFastRecs.hpp>
+#include <ANTL/Quadratic/Reduce/ReduceFastAllRecs.hpp>
+#include <ANTL/Quadratic/Reduce/ReduceFastAllRecsFancy.hpp>
+#include <ANTL/Quadratic/Reduce/ReduceFastAltA.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+// A = reduced product of g random prime ideals of degree 1
+static void gf2nx_random_ideal (QuadraticIdealBase<GF2nX> &A, MultiplyNucomp<GF2nX> &nucomp, long g)
+{
+  QuadraticIdealBase<GF2nX> P(*A.get_QO());
+  GF2nX p;
+  GF2n alpha;
+
+  A.assign_one();
+  for (long n = 0; n < g; ) {
+    random(alpha);
+    SetX(p);
+    SetCoeff(p, 0, alpha);
+    if (!P.assign_prime(p))
+      continue;
+    nucomp.multiply(A, A, P);
+    ++n;
+  }
+}
+
+// reduced, and b^2 + b h + a c = f
+static bool gf2nx_is_reduced (const QuadraticIdealBase<GF2nX> &A, const GF2nX &f, const GF2nX &h, long g)
+{
+  GF2nX a = A.get_a(), b = A.get_b(), c = A.get_c();
+
+  return deg(a) <= g && IsOne(LeadCoeff(a)) && deg(b) < deg(a) && b*b + b*h + a*c == f;
+}
+
+TEST_CASE("MultiplyNucomp<GF2nX>: characteristic 2 arithmetic over GF(2^61)", "[MultiplyNucomp][GF2nX]") {
+    SetSeed(ZZ(1));
+    GF2n::init(61);
+
+    for (long g = 2; g <= 4; ++g) {
+        GF2nX f, h;
+
+        // y^2 + h y = f, deg f = 2g + 1, deg h <= g
+        random(f, 2*g + 1);
+        SetCoeff(f, 2*g + 1);
+        random(h, g + 1);
+
+        QuadraticOrder<GF2nX> QO(f, h);
+        REQUIRE(QO.IsImaginary());
+        REQUIRE(QO.getGenus() == g);
+
+        ReduceFast<GF2nX> red;
+        red.init(f, h, g);
+        QO.set_red_best(red);
+
+        MultiplyNucomp<GF2nX> nucomp;
+        nucomp.init(f, h, g);
+        SquareNudupl<GF2nX> nudupl;
+        nudupl.init(f, h, g);
+        CubeNucube<GF2nX> nucube;
+        nucube.init(f, h, g);
+
+        ReduceFastRecs<GF2nX> red_recs;
+        red_recs.init(f, h, g);
+        ReduceFastAllRecs<GF2nX> red_allrecs;
+        red_allrecs.init(f, h, g);
+        ReduceFastAllRecsFancy<GF2nX> red_fancy;
+        red_fancy.init(f, h, g);
+        ReduceFastAltA<GF2nX> red_alta;
+        red_alta.init(f, h, g);
+
+        QuadraticIdealBase<GF2nX> A(QO), B(QO), C(QO), D(QO), E(QO), U(QO);
+
+        gf2nx_random_ideal(A, nucomp, g);
+        gf2nx_random_ideal(B, nucomp, g);
+        gf2nx_random_ideal(C, nucomp, g);
+
+        for (long i = 0; i < 50; ++i) {
+            REQUIRE(gf2nx_is_reduced(A, f, h, g));
+
+            // A^2, A^3
+            nucomp.multiply(D, A, A);
+            nudupl.square(E, A);
+            REQUIRE(gf2nx_is_reduced(E, f, h, g));
+            REQUIRE(D == E);
+
+            nucomp.multiply(D, E, A);
+            nucube.cube(E, A);
+            REQUIRE(gf2nx_is_reduced(E, f, h, g));
+            REQUIRE(D == E);
+
+            // commutativity, associativity
+            nucomp.multiply(D, A, B);
+            nucomp.multiply(E, B, A);
+            REQUIRE(D == E);
+            nucomp.multiply(D, D, C);
+            nucomp.multiply(E, B, C);
+            nucomp.multiply(E, A, E);
+            REQUIRE(D == E);
+
+            // A times its conjugate
+            conjugate(D, A);
+            nucomp.multiply(E, A, D);
+            REQUIRE(IsOne(E.get_a()));
+
+            // all fast reductions of the (unreduced) composition of A and B
+            GF2nX G, s, t, a, b, c;
+            XGCD(G, s, t, A.get_a(), B.get_a());
+            if (IsOne(G)) {
+                mul(a, A.get_a(), B.get_a());
+                b = ((B.get_b() - A.get_b())*s) % B.get_a();
+                b = A.get_b() + A.get_a()*b;
+                c = (b*b + b*h + f) / a;
+                REQUIRE(a*c == b*b + b*h + f);
+                nucomp.multiply(D, A, B);
+
+                U.assign(a, b, c);
+                red.reduce(U);
+                REQUIRE(U == D);
+                U.assign(a, b, c);
+                red_recs.reduce(U);
+                REQUIRE(U == D);
+                U.assign(a, b, c);
+                red_allrecs.reduce(U);
+                REQUIRE(U == D);
+                U.assign(a, b, c);
+                red_fancy.reduce(U);
+                REQUIRE(U == D);
+                U.assign(a, b, c);
+                red_alta.reduce(U);
+                REQUIRE(U == D);
+            }
+
+            A.assign(B);
+            nudupl.square(B, D);
+        }
+    }
+}
+#endif
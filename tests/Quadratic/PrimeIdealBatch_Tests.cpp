@@ -0,0 +1,75 @@
+#ifndef PRIMEIDEALBATCH_TEST
+#define PRIMEIDEALBATCH_TEST
+
+#include "../catch.hpp"
+#include <ANTL/Quadratic/PrimeIdealBatch.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+// the batch gives the same ideals as assign_prime, prime by prime
+template <class T> static void check_batch (const T & D, long bound)
+{
+    QuadraticOrder<T> QO(D);
+    PrimeIdealBatch<T> batch(QO, 64);
+    QuadraticIdealBase<T> A(QO), B(QO);
+    const std::vector<long> & P = PrimeTable::primes(bound);
+    long i, j = 0;
+
+    batch.generate(bound);
+
+    for (i = 0; i < (long) P.size() && P[i] <= bound; ++i) {
+        if (!A.assign_prime(to<T>(P[i])))
+            continue;
+
+        REQUIRE(j < batch.size());
+        REQUIRE(batch[j].p == P[i]);
+        batch.assign(B, j);
+        REQUIRE(B.get_a() == A.get_a());
+        REQUIRE(B.get_b() == A.get_b());
+        REQUIRE(B.get_c() == A.get_c());
+        ++j;
+    }
+    REQUIRE(j == batch.size());
+}
+
+TEST_CASE("PrimeIdealBatch<long>: agrees with assign_prime", "[PrimeIdealBatch]") {
+    check_batch<long>(-4*1000003L, 3000);
+    check_batch<long>(-1000003L*1000033L, 3000);
+    check_batch<long>(5*7*7*13*17L, 3000);
+    check_batch<long>(4*(4*17*19 + 3L), 3000);
+}
+
+TEST_CASE("PrimeIdealBatch<ZZ>: agrees with assign_prime", "[PrimeIdealBatch]") {
+    check_batch<ZZ>(-to_ZZ("400000000000000000000000000000000000003"), 3000);
+    check_batch<ZZ>(to_ZZ("100000000000000000000000000000000000000000000000000000001"), 3000);
+    check_batch<ZZ>(to_ZZ("-12") * 9 * 25 * 49, 3000);
+}
+
+TEST_CASE("PrimeIdealBatch<ZZ>: generation by count and by list", "[PrimeIdealBatch]") {
+    QuadraticOrder<ZZ> QO(-to_ZZ("400000000000000000000000000000000000003"));
+    PrimeIdealBatch<ZZ> batch(QO);
+
+    REQUIRE(batch.generate(100000, 1000) == 1000);
+    REQUIRE(batch.size() == 1000);
+
+    std::vector< QuadraticIdealBase<ZZ> > A;
+    batch.assign(A);
+    REQUIRE(A.size() == 1000);
+    for (long i = 0; i < 1000; ++i) {
+        REQUIRE(A[i].get_b()*A[i].get_b() - 4*A[i].get_a()*A[i].get_c() == QO.getDiscriminant());
+        if (i > 0)
+            REQUIRE(batch[i].p > batch[i-1].p);
+    }
+
+    std::vector<long> P = { 1000003, 1000033, 1000037, 1000039 };
+    batch.clear();
+    long n = batch.generate(P);
+    REQUIRE(n == batch.size());
+    for (long i = 0; i < n; ++i) {
+        QuadraticIdealBase<ZZ> B(QO);
+        REQUIRE(B.assign_prime(ZZ(batch[i].p)));
+    }
+}
+
+#endif
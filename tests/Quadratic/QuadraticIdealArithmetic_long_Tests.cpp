@@ -0,0 +1,137 @@
+#ifndef QUADRATIC_IDEAL_ARITHMETIC_LONG_TEST
+#define QUADRATIC_IDEAL_ARITHMETIC_LONG_TEST
+
+#include "../catch.hpp"
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/Reduce/ReducePlainImag.hpp>
+#include <ANTL/Quadratic/Multiply/MultiplyNucomp.hpp>
+#include <ANTL/Quadratic/Square/SquareNudupl.hpp>
+#include <ANTL/Quadratic/Cube/CubeNucube.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+// NUCOMP, NUDUPL and NUCUBE for long and for ZZ in the imaginary quadratic
+// order of discriminant D (the word-size versions are exact for |D| < 2^42)
+struct LongAndZZArithmetic
+{
+    QuadraticOrder<long> QO;
+    QuadraticOrder<ZZ> QZ;
+    ReducePlainImag<long> red;
+    MultiplyNucomp<long> mul_nucomp;
+    SquareNudupl<long> sqr_nudupl;
+    CubeNucube<long> cube_nucube;
+    ReducePlainImag<ZZ> red_ZZ;
+    MultiplyNucomp<ZZ> mul_nucomp_ZZ;
+    SquareNudupl<ZZ> sqr_nudupl_ZZ;
+    CubeNucube<ZZ> cube_nucube_ZZ;
+
+    LongAndZZArithmetic (const long D) : QO(D), QZ(to_ZZ(D))
+    {
+        red.init(D, 0);
+        mul_nucomp.init(D, 0);
+        sqr_nudupl.init(D, 0);
+        cube_nucube.init(D, 0);
+        QO.set_red_best(red);
+
+        red_ZZ.init(to_ZZ(D), ZZ(0));
+        mul_nucomp_ZZ.init(to_ZZ(D), ZZ(0));
+        sqr_nudupl_ZZ.init(to_ZZ(D), ZZ(0));
+        cube_nucube_ZZ.init(to_ZZ(D), ZZ(0));
+        QZ.set_red_best(red_ZZ);
+    }
+
+    // the reduced AP, A^2 and A^3 must be the same for long and ZZ; C = AP
+    void check (QuadraticIdealBase<long> & C, const QuadraticIdealBase<long> & A,
+                const QuadraticIdealBase<long> & P)
+    {
+        QuadraticIdealBase<ZZ> AZ(QZ), PZ(QZ), CZ(QZ);
+        AZ.assign(to_ZZ(A.get_a()), to_ZZ(A.get_b()), to_ZZ(A.get_c()));
+        PZ.assign(to_ZZ(P.get_a()), to_ZZ(P.get_b()), to_ZZ(P.get_c()));
+
+        sqr_nudupl.square(C, A);
+        C.reduce();
+        sqr_nudupl_ZZ.square(CZ, AZ);
+        CZ.reduce();
+        REQUIRE(to_ZZ(C.get_a()) == CZ.get_a());
+        REQUIRE(to_ZZ(C.get_b()) == CZ.get_b());
+
+        cube_nucube.cube(C, A);
+        C.reduce();
+        cube_nucube_ZZ.cube(CZ, AZ);
+        CZ.reduce();
+        REQUIRE(to_ZZ(C.get_a()) == CZ.get_a());
+        REQUIRE(to_ZZ(C.get_b()) == CZ.get_b());
+
+        mul_nucomp.multiply(C, A, P);
+        C.reduce();
+        mul_nucomp_ZZ.multiply(CZ, AZ, PZ);
+        CZ.reduce();
+        REQUIRE(to_ZZ(C.get_a()) == CZ.get_a());
+        REQUIRE(to_ZZ(C.get_b()) == CZ.get_b());
+        REQUIRE(to_ZZ(C.get_c()) == CZ.get_c());
+    }
+
+    // checks the products A of the first steps prime ideals
+    void check_products (const long steps)
+    {
+        QuadraticIdealBase<long> A(QO), P(QO), C(QO);
+        long p = 2;
+
+        A.assign_one();
+        for (long i = 0; i < steps; ++i) {
+            do {
+                p = NextPrime(p + 1);
+            } while (!P.assign_prime(p));
+            P.reduce();
+
+            check(C, A, P);
+            A = C;
+        }
+    }
+};
+
+TEST_CASE("MultiplyNucomp/SquareNudupl/CubeNucube<long>: agree with ZZ", "[MultiplyNucomp][SquareNudupl][CubeNucube]") {
+
+    SECTION("16-bit discriminant") {
+        LongAndZZArithmetic arith(-38839);
+        QuadraticIdealBase<long> A(arith.QO), P(arith.QO), C(arith.QO);
+
+        // gcd(a1, a2) = 5:  K must be reduced modulo a1/5 (NUCOMP)
+        A.assign(95, -61, 112);
+        P.assign(70, 61, 152);
+        arith.check(C, A, P);
+        arith.check(C, P, A);
+
+        arith.check_products(200);
+    }
+
+    SECTION("27-bit discriminant, not prime") {
+        LongAndZZArithmetic arith(-3*5*7*11*13*17*19*23);
+        QuadraticIdealBase<long> A(arith.QO), C(arith.QO);
+
+        // gcd(a, b) = 3 does not divide c:  NUDUPL needs c S, not c/S
+        A.assign(519, -141, 53741);
+        arith.check(C, A, A);
+
+        arith.check_products(200);
+    }
+
+    SECTION("32-bit discriminant") {
+        LongAndZZArithmetic arith(-2699561131);
+        QuadraticIdealBase<long> A(arith.QO), C(arith.QO);
+
+        // v1 (b - a c v1) - 2 < 0:  K must not be negative (NUCUBE)
+        A.assign(24551, 6265, 27889);
+        arith.check(C, A, A);
+
+        arith.check_products(200);
+    }
+
+    SECTION("40-bit discriminant") {
+        LongAndZZArithmetic arith(-1099511627791);
+        arith.check_products(200);
+    }
+}
+
+#endif
@@ -0,0 +1,198 @@
+#ifndef QUADRATICIDEALHYBRID_TEST
+#define QUADRATICIDEALHYBRID_TEST
+
+#include "../catch.hpp"
+#include <ANTL/Quadratic/QuadraticIdealHybrid.hpp>
+#include <ANTL/Quadratic/Reduce/ReducePlainImag.hpp>
+#include <ANTL/Quadratic/Reduce/ReducePlainReal.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+// h = h^2 g, n times, with the hybrid ideals and with ZZ ideals
+static void hybrid_chain (const ZZ & D, long n, long p)
+{
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(D);
+
+    ReducePlainImag<ZZ> red_plain_imag_object = ReducePlainImag<ZZ>();
+    red_plain_imag_object.init(D, ZZ(0));
+    quad_order1.set_red_best(red_plain_imag_object);
+
+    MultiplyNucomp<ZZ> mul_nucomp_object = MultiplyNucomp<ZZ>();
+    mul_nucomp_object.init(D, ZZ(0));
+    SquareNudupl<ZZ> sqr_nudupl_object = SquareNudupl<ZZ>();
+    sqr_nudupl_object.init(D, ZZ(0));
+
+    QuadraticHybridOrder hybrid_order1 = QuadraticHybridOrder(quad_order1);
+
+    QuadraticIdealBase<ZZ> G = QuadraticIdealBase<ZZ>(quad_order1);
+    QuadraticIdealBase<ZZ> H = QuadraticIdealBase<ZZ>(quad_order1);
+    QuadraticIdealHybrid g = QuadraticIdealHybrid(hybrid_order1);
+    QuadraticIdealHybrid h = QuadraticIdealHybrid(hybrid_order1);
+
+    REQUIRE(G.assign_prime(ZZ(p)));
+    G.reduce();
+    H.assign(G);
+
+    REQUIRE(g.assign_prime(ZZ(p)));
+    g.reduce();
+    h.assign(g);
+
+    for (long i = 0; i < n; ++i) {
+        sqr_nudupl_object.square(H, H);
+        H.reduce();
+        mul_nucomp_object.multiply(H, H, G);
+
+        sqr(h, h);
+        mul(h, h, g);
+
+        REQUIRE(h.get_a() == H.get_a());
+        REQUIRE(h.get_b() == H.get_b());
+        REQUIRE(h.get_c() == H.get_c());
+    }
+}
+
+TEST_CASE("QuadraticIdealHybrid: word sized discriminant", "[QuadraticIdealHybrid]") {
+
+    SECTION("no overflow") {
+        ZZ D = ZZ(-4027);
+        QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(D);
+        QuadraticHybridOrder hybrid_order1 = QuadraticHybridOrder(quad_order1);
+
+        REQUIRE(hybrid_order1.is_word());
+
+        hybrid_chain(D, 100, 3);
+    }
+
+    SECTION("counters") {
+        ZZ D = ZZ(-4027);
+        QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(D);
+
+        ReducePlainImag<ZZ> red_plain_imag_object = ReducePlainImag<ZZ>();
+        red_plain_imag_object.init(D, ZZ(0));
+        quad_order1.set_red_best(red_plain_imag_object);
+
+        QuadraticHybridOrder hybrid_order1 = QuadraticHybridOrder(quad_order1);
+        QuadraticIdealHybrid g = QuadraticIdealHybrid(hybrid_order1);
+        QuadraticIdealHybrid h = QuadraticIdealHybrid(hybrid_order1);
+
+        REQUIRE(g.is_word());
+        REQUIRE(g.IsOne());
+
+        g.assign_prime(ZZ(3));
+        g.reduce();
+        h.assign(g);
+        for (long i = 0; i < 10; ++i) {
+            sqr(h, h);
+            mul(h, h, g);
+        }
+
+        HybridCounters N = hybrid_order1.get_counters();
+        REQUIRE(N.sqr_word == 10);
+        REQUIRE(N.mul_word == 10);
+        REQUIRE(N.red_word == 1);
+        REQUIRE(N.promotions() == 0);
+        REQUIRE(N.ZZ_ops() == 0);
+
+        hybrid_order1.reset_counters();
+        REQUIRE(hybrid_order1.get_counters().word_ops() == 0);
+    }
+
+    SECTION("promotion on overflow") {
+        // |Delta| = 2^62 - 57: NUCOMP and NUDUPL overflow now and then
+        ZZ D = to_ZZ("-4611686018427387847");
+        QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(D);
+
+        ReducePlainImag<ZZ> red_plain_imag_object = ReducePlainImag<ZZ>();
+        red_plain_imag_object.init(D, ZZ(0));
+        quad_order1.set_red_best(red_plain_imag_object);
+
+        QuadraticHybridOrder hybrid_order1 = QuadraticHybridOrder(quad_order1);
+        QuadraticIdealHybrid g = QuadraticIdealHybrid(hybrid_order1);
+        QuadraticIdealHybrid h = QuadraticIdealHybrid(hybrid_order1);
+
+        REQUIRE(hybrid_order1.is_word());
+
+        g.assign_prime(ZZ(7));
+        g.reduce();
+        h.assign(g);
+        for (long i = 0; i < 200; ++i) {
+            sqr(h, h);
+            mul(h, h, g);
+        }
+
+        REQUIRE(h.is_word());
+        REQUIRE(h.get_a() == 144897176);
+        REQUIRE(h.get_b() == -134702837);
+
+        HybridCounters N = hybrid_order1.get_counters();
+        REQUIRE(N.promotions() > 0);
+        REQUIRE(N.demotions == N.promotions());
+        REQUIRE(N.ZZ_ops() == 0);
+        REQUIRE(N.word_ops() + N.promotions() == 401);
+
+        hybrid_chain(D, 200, 7);
+    }
+}
+
+TEST_CASE("QuadraticIdealHybrid: large discriminant", "[QuadraticIdealHybrid]") {
+
+    ZZ D = to_ZZ("-1155587265460919309098822660847");
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(D);
+
+    ReducePlainImag<ZZ> red_plain_imag_object = ReducePlainImag<ZZ>();
+    red_plain_imag_object.init(D, ZZ(0));
+    quad_order1.set_red_best(red_plain_imag_object);
+
+    QuadraticHybridOrder hybrid_order1 = QuadraticHybridOrder(quad_order1);
+    QuadraticIdealHybrid g = QuadraticIdealHybrid(hybrid_order1);
+
+    REQUIRE(!hybrid_order1.is_word());
+    REQUIRE(!g.is_word());
+    REQUIRE(g.IsOne());
+
+    g.assign_prime(ZZ(3));
+    for (long i = 0; i < 10; ++i)
+        sqr(g, g);
+
+    REQUIRE(!g.is_word());
+    REQUIRE(hybrid_order1.get_counters().sqr_ZZ == 10);
+    REQUIRE(hybrid_order1.get_counters().word_ops() == 0);
+
+    hybrid_chain(D, 50, 3);
+}
+
+TEST_CASE("QuadraticIdealHybrid: real orders", "[QuadraticIdealHybrid]") {
+
+    ZZ D = to_ZZ("1000000000061");
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(D);
+
+    ReducePlainReal<ZZ> red_plain_real_object = ReducePlainReal<ZZ>();
+    red_plain_real_object.init(D, ZZ(0));
+    quad_order1.set_red_best(red_plain_real_object);
+
+    QuadraticHybridOrder hybrid_order1 = QuadraticHybridOrder(quad_order1);
+    QuadraticIdealHybrid g = QuadraticIdealHybrid(hybrid_order1);
+    QuadraticIdealHybrid h = QuadraticIdealHybrid(hybrid_order1);
+    QuadraticIdealBase<ZZ> H = QuadraticIdealBase<ZZ>(quad_order1);
+
+    ZZ p = ZZ(2);
+    do {
+        p = NextPrime(p + 1);
+    } while (!g.assign_prime(p));
+    g.reduce();
+    h.assign(g);
+
+    for (long i = 0; i < 50; ++i) {
+        sqr(h, h);
+        mul(h, h, g);
+
+        h.get(H);
+        REQUIRE(sqr(H.get_b()) - 4*H.get_a()*H.get_c() == D);
+        REQUIRE(H.is_reduced());
+    }
+
+    REQUIRE(hybrid_order1.get_counters().word_ops() > 0);
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef QUADRATICINFRASTRUCTUREELEMENT_FP_ZZ_TEST
+#define QUADRATICINFRASTRUCTUREELEMENT_FP_ZZ_TEST
+
+#include "../catch.hpp"
+#include <ANTL/Quadratic/QuadraticInfrastructureElement_fp.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+TEST_CASE("FPRepresentation<ZZ>: regulator of small real quadratic orders", "[FPRepresentation]") {
+
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(5));
+    QuadraticOrder<ZZ> quad_order2 = QuadraticOrder<ZZ>(ZZ(8));
+    QuadraticOrder<ZZ> quad_order3 = QuadraticOrder<ZZ>(ZZ(13));
+
+    // log((1+sqrt(5))/2), log(1+sqrt(2)), log((3+sqrt(13))/2)
+    REQUIRE(abs(quad_order1.regulator() - to_RR(0.48121182505960347)) < to_RR(1e-12));
+    REQUIRE(abs(quad_order2.regulator() - to_RR(0.88137358701954302)) < to_RR(1e-12));
+    REQUIRE(abs(quad_order3.regulator() - to_RR(1.19476321728710930)) < to_RR(1e-12));
+}
+
+TEST_CASE("FPRepresentation<ZZ>: rho_inverse undoes rho", "[FPRepresentation]") {
+
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(4000012));
+
+    FPRepresentation<ZZ> A = FPRepresentation<ZZ>(quad_order1, 80);
+    for (long i = 0; i < 7; ++i)
+        A.rho();
+
+    FPRepresentation<ZZ> B = FPRepresentation<ZZ>(A);
+    B.rho();
+    B.rho();
+    B.rho_inverse();
+    B.rho_inverse();
+
+    REQUIRE(B.IsEqual(A));
+    REQUIRE(abs(B.distance() - A.distance()) < to_RR(1e-15));
+}
+
+TEST_CASE("FPRepresentation<ZZ>: products of principal ideals stay on the principal cycle", "[FPRepresentation]") {
+
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(4000012));
+    RR R = quad_order1.regulator();
+
+    FPRepresentation<ZZ> A = FPRepresentation<ZZ>(quad_order1, 80);
+    FPRepresentation<ZZ> B = FPRepresentation<ZZ>(quad_order1, 80);
+    FPRepresentation<ZZ> C = FPRepresentation<ZZ>(quad_order1, 80);
+    for (long i = 0; i < 5; ++i)
+        A.rho();
+    for (long i = 0; i < 9; ++i)
+        B.rho();
+
+    mul(C, A, B);
+
+    // locate C on the principal cycle
+    FPRepresentation<ZZ> D = FPRepresentation<ZZ>(quad_order1, 80);
+    long steps = 0;
+    while (!D.IsEqual(C) && steps < 1000) {
+        D.rho();
+        ++steps;
+    }
+    REQUIRE(D.IsEqual(C));
+
+    RR q = (C.distance() - D.distance()) / R;
+    REQUIRE(abs(q - round(q)) < to_RR(1e-9));
+
+    // squaring agrees with multiplication
+    mul(C, A, A);
+    sqr(D, A);
+    REQUIRE(C == D);
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef CLASSGROUPRANK_ZZ_TEST
+#define CLASSGROUPRANK_ZZ_TEST
+
+#include "../../catch.hpp"
+#include <ANTL/Quadratic/Rank/ClassGroupRank.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+TEST_CASE("ClassGroupRank<ZZ>: 2-rank by genus theory", "[ClassGroupRank]") {
+
+    // imaginary:  Cl(-84) = C2 x C2, Cl(-420) = C2^3, Cl(-3299) = C3 x C9
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(-84));
+    QuadraticOrder<ZZ> quad_order2 = QuadraticOrder<ZZ>(ZZ(-420));
+    QuadraticOrder<ZZ> quad_order3 = QuadraticOrder<ZZ>(ZZ(-3299));
+
+    REQUIRE(ClassGroupRank<ZZ>(quad_order1).two_rank() == 2);
+    REQUIRE(ClassGroupRank<ZZ>(quad_order2).two_rank() == 3);
+    REQUIRE(ClassGroupRank<ZZ>(quad_order3).two_rank() == 0);
+
+    // real:  h(12) = 1 (narrow class number 2), h(40) = h(60) = 2, h(145) = 4
+    QuadraticOrder<ZZ> quad_order4 = QuadraticOrder<ZZ>(ZZ(12));
+    QuadraticOrder<ZZ> quad_order5 = QuadraticOrder<ZZ>(ZZ(40));
+    QuadraticOrder<ZZ> quad_order6 = QuadraticOrder<ZZ>(ZZ(60));
+    QuadraticOrder<ZZ> quad_order7 = QuadraticOrder<ZZ>(ZZ(145));
+
+    ClassGroupRank<ZZ> rank4 = ClassGroupRank<ZZ>(quad_order4);
+    REQUIRE(rank4.two_rank() == 0);
+    REQUIRE(rank4.narrow_two_rank() == 1);
+    REQUIRE(ClassGroupRank<ZZ>(quad_order5).two_rank() == 1);
+    REQUIRE(ClassGroupRank<ZZ>(quad_order6).two_rank() == 1);
+    REQUIRE(ClassGroupRank<ZZ>(quad_order7).two_rank() == 1);
+    REQUIRE(ClassGroupRank<ZZ>(quad_order7).p_rank(2) == 1);
+}
+
+TEST_CASE("ClassGroupRank<ZZ>: prime divisors beyond trial division", "[ClassGroupRank]") {
+
+    // -4 * 65537 * 1000003, both primes are found by Pollard-Brent rho
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(to_ZZ("-262148786444"));
+    ClassGroupRank<ZZ> rank = ClassGroupRank<ZZ>(quad_order1);
+
+    REQUIRE(rank.get_prime_divisors().size() == 2);
+    REQUIRE(rank.two_rank() == 1);
+}
+
+TEST_CASE("ClassGroupRank<ZZ>: 3-rank of imaginary orders", "[ClassGroupRank]") {
+
+    ReducePlainImag<ZZ> red_plain_imag_object = ReducePlainImag<ZZ>();
+
+    // Cl(-23) = C3, Cl(-3299) = C3 x C9, Cl(-4027) = C3 x C3, Cl(-84) = C2 x C2,
+    // -3321607 is the smallest |Delta| with 3-rank 3
+    long D[5] = {-23, -3299, -4027, -84, -3321607};
+    long r[5] = {1, 2, 2, 0, 3};
+
+    for (long i = 0; i < 5; ++i) {
+        QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(D[i]));
+        red_plain_imag_object.init(quad_order1.getDiscriminant(), quad_order1.getH());
+        quad_order1.set_red_best(red_plain_imag_object);
+
+        ClassGroupRank<ZZ> rank = ClassGroupRank<ZZ>(quad_order1);
+        REQUIRE(rank.three_rank() == r[i]);
+        REQUIRE(rank.p_rank(3) == r[i]);
+        REQUIRE(rank.get_num_discarded() == 0);
+    }
+}
+#endif
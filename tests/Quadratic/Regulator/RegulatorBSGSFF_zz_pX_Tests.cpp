@@ -0,0 +1,152 @@
+#ifndef REGULATORBSGSFF_ZZ_PX_TEST
+#define REGULATORBSGSFF_ZZ_PX_TEST
+
+#include "../../catch.hpp"
+#include <NTL/lzz_pX.h>
+#include <NTL/ZZ_pX.h>
+#include <ANTL/Quadratic/Regulator/RegulatorBSGSFF.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+// random monic squarefree f of degree 2g + 2 (y^2 = f is real)
+template <class T> static void random_real_curve (T & f, long g)
+{
+  do {
+    random(f, 2*g + 2);
+    SetCoeff(f, 2*g + 2);
+  } while (!IsOne(GCD(f, diff(f))));
+}
+
+TEST_CASE("RegulatorBSGSFF<zz_pX>: agrees with the principal cycle", "[RegulatorBSGSFF]") {
+    zz_p::init(31);
+    SetSeed(ZZ(1));
+
+    for (long g = 1; g <= 3; ++g) {
+        for (long i = 0; i < 5; ++i) {
+            zz_pX f;
+            random_real_curve(f, g);
+
+            QuadraticOrder<zz_pX> QO(f);
+            REQUIRE(QO.IsReal());
+            REQUIRE(QO.getGenus() == g);
+
+            // walk the whole principal cycle
+            RegulatorBSGSFF<zz_pX> cycle(QO);
+            cycle.set_baby_steps(1L << 30);
+            long R = cycle.regulator();
+            REQUIRE(R > 0);
+            REQUIRE(cycle.get_num_giant_steps() == 0);
+
+            // force giant steps
+            RegulatorBSGSFF<zz_pX> bsgs(QO);
+            bsgs.set_baby_steps(2);
+            REQUIRE(bsgs.regulator() == R);
+
+            // automatic number of baby steps
+            RegulatorBSGSFF<zz_pX> bsgs2(QO);
+            REQUIRE(bsgs2.regulator() == R);
+        }
+    }
+}
+
+TEST_CASE("RegulatorBSGSFF<zz_pX>: h R is the order of the Jacobian", "[RegulatorBSGSFF]") {
+    zz_p::init(31);
+    SetSeed(ZZ(2));
+
+    for (long g = 1; g <= 3; ++g) {
+        zz_pX f;
+        random_real_curve(f, g);
+
+        QuadraticOrder<zz_pX> QO(f);
+        RegulatorBSGSFF<zz_pX> bsgs(QO);
+        bsgs.set_baby_steps(4);
+
+        ZZ hx, N;
+        REQUIRE(bsgs.class_number(hx));
+        REQUIRE(bsgs.get_Lpolynomial().jacobian_order(N));
+        REQUIRE(hx * bsgs.regulator() == N);
+
+        // independent check by point counting
+        REQUIRE(bsgs.verify(2));
+    }
+}
+
+TEST_CASE("RegulatorBSGSFF<zz_pX>: principal ideal test", "[RegulatorBSGSFF]") {
+    zz_p::init(31);
+    SetSeed(ZZ(3));
+
+    for (long g = 2; g <= 3; ++g) {
+        zz_pX f, a, b, ra, rb, ra2, rb2;
+        zz_p fa;
+        long delta, delta2;
+
+        random_real_curve(f, g);
+
+        QuadraticOrder<zz_pX> QO(f);
+        RegulatorBSGSFF<zz_pX> cycle(QO), bsgs(QO);
+        cycle.set_baby_steps(1L << 30);
+        bsgs.set_baby_steps(3);
+        long R = bsgs.regulator();
+        REQUIRE(cycle.regulator() == R);
+
+        // (b + y) = [b^2 - f, b + y] is principal
+        for (long j = 1; j <= 5; ++j) {
+            random(b, g + 1);
+            SetCoeff(b, g + 1);
+            a = b*b - f;
+            if (IsZero(a))
+                continue;
+            MakeMonic(a);
+            REQUIRE(bsgs.principal_ideal_test(ra, rb, delta, a, b));
+            REQUIRE(delta >= 0);
+            REQUIRE(delta < R);
+        }
+
+        // prime ideals of degree 1:  same answer as the principal cycle
+        for (long alpha = 0; alpha < 31; ++alpha) {
+            eval(fa, f, zz_p(alpha));
+            long s;
+            for (s = 0; s < 31 && sqr(zz_p(s)) != fa; ++s);
+            if (s == 31)
+                continue;
+
+            clear(a);
+            SetCoeff(a, 1);
+            SetCoeff(a, 0, -zz_p(alpha));
+            conv(b, zz_p(s));
+
+            bool p1 = cycle.principal_ideal_test(ra, rb, delta, a, b);
+            bool p2 = bsgs.principal_ideal_test(ra2, rb2, delta2, a, b);
+            REQUIRE(p1 == p2);
+            REQUIRE(ra == ra2);
+            REQUIRE(rb == rb2);
+            if (p1)
+                REQUIRE(delta == delta2);
+        }
+    }
+}
+
+TEST_CASE("RegulatorBSGSFF<ZZ_pX>: elliptic curves", "[RegulatorBSGSFF]") {
+    ZZ_p::init(ZZ(10007));
+    SetSeed(ZZ(4));
+
+    for (long i = 0; i < 3; ++i) {
+        ZZ_pX f;
+        random_real_curve(f, 1);
+
+        QuadraticOrder<ZZ_pX> QO(f);
+        RegulatorBSGSFF<ZZ_pX> cycle(QO), bsgs(QO);
+        cycle.set_baby_steps(1L << 30);
+        long R = cycle.regulator();
+
+        REQUIRE(bsgs.regulator() == R);
+
+        ZZ hx, N;
+        REQUIRE(bsgs.class_number(hx));
+        REQUIRE(bsgs.get_Lpolynomial().jacobian_order(N));
+        REQUIRE(hx * R == N);
+    }
+}
+
+#endif
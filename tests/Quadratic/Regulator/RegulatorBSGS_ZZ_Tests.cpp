@@ -0,0 +1,89 @@
+#ifndef REGULATORBSGS_ZZ_TEST
+#define REGULATORBSGS_ZZ_TEST
+
+#include "../../catch.hpp"
+#include <ANTL/Quadratic/Regulator/RegulatorBSGS.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+TEST_CASE("RegulatorBSGS<ZZ>: agrees with the principal cycle", "[RegulatorBSGS]") {
+
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(1000000036));
+
+    RR R_cycle, R_bsgs;
+    regulator_fp(R_cycle, quad_order1, 80);
+
+    RegulatorBSGS<ZZ> bsgs = RegulatorBSGS<ZZ>(quad_order1, 40);
+    bsgs.regulator(R_bsgs);
+
+    REQUIRE(bsgs.get_num_giant_steps() > 0);
+    REQUIRE(abs(R_bsgs - R_cycle) < to_RR(1e-9));
+    REQUIRE(abs(R_bsgs - to_RR(16529.39221135576)) < to_RR(1e-7));
+}
+
+TEST_CASE("RegulatorBSGS<ZZ>: small regulators are found by baby steps", "[RegulatorBSGS]") {
+
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(13));
+
+    RR R;
+    RegulatorBSGS<ZZ> bsgs = RegulatorBSGS<ZZ>(quad_order1, 40);
+    bsgs.regulator(R);
+
+    REQUIRE(bsgs.get_num_giant_steps() == 0);
+    REQUIRE(abs(R - to_RR(1.19476321728710930)) < to_RR(1e-12));
+    REQUIRE(bsgs.fundamental_unit().IsOne());
+}
+
+TEST_CASE("RegulatorBSGS<ZZ>: larger discriminant", "[RegulatorBSGS]") {
+
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(to_ZZ("4000000000156"));
+
+    REQUIRE(abs(quad_order1.regulator() - to_RR(631893.2308198442)) < to_RR(1e-6));
+}
+
+TEST_CASE("RegulatorBSGS<ZZ>: principal ideal testing", "[RegulatorBSGS]") {
+
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(1000000036));
+    RegulatorBSGS<ZZ> bsgs = RegulatorBSGS<ZZ>(quad_order1, 40);
+
+    FPRepresentation<ZZ> A = FPRepresentation<ZZ>(quad_order1, bsgs.get_precision());
+    FPRepresentation<ZZ> G = FPRepresentation<ZZ>(quad_order1, bsgs.get_precision());
+    QuadraticIdealBase<ZZ> I = QuadraticIdealBase<ZZ>(quad_order1);
+
+    // reduced principal ideal at distance about 10000 log(2)
+    A.wnear(10000);
+    A.get_ideal(I);
+
+    REQUIRE(bsgs.principal_ideal_test(G, I));
+    REQUIRE(G.IsEqual(A));
+    REQUIRE(abs(G.distance() - A.distance()) < to_RR(1e-6));
+
+    // the baby-step table is reused
+    long m = bsgs.get_num_baby_steps();
+    A.assign_one();
+    A.rho();
+    A.get_ideal(I);
+    REQUIRE(bsgs.principal_ideal_test(G, I));
+    REQUIRE(abs(G.distance() - A.distance()) < to_RR(1e-6));
+    REQUIRE(bsgs.get_num_baby_steps() == m);
+}
+
+TEST_CASE("RegulatorBSGS<ZZ>: non-principal ideals", "[RegulatorBSGS]") {
+
+    // Q(sqrt(10)) has class number 2, the primes above 3 are not principal
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(ZZ(40));
+    RegulatorBSGS<ZZ> bsgs = RegulatorBSGS<ZZ>(quad_order1, 40);
+
+    FPRepresentation<ZZ> G = FPRepresentation<ZZ>(quad_order1, bsgs.get_precision());
+    QuadraticIdealBase<ZZ> I = QuadraticIdealBase<ZZ>(quad_order1);
+
+    REQUIRE(I.assign_prime(ZZ(3)));
+    REQUIRE(!bsgs.principal_ideal_test(G, I));
+
+    I.assign_one();
+    REQUIRE(bsgs.principal_ideal_test(G, I));
+    REQUIRE(G.IsOne());
+}
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef SQUARE_EXPLICIT_ZZ_PX_TEST
+#define SQUARE_EXPLICIT_ZZ_PX_TEST
+
+#include "../../catch.hpp"
+#include <NTL/lzz_pX.h>
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/Square/SquareExplicit.hpp>
+#include <ANTL/Quadratic/Square/SquareNudupl.hpp>
+#include <ANTL/Quadratic/Reduce/ReducePlainImag.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+TEST_CASE("SquareExplicit<zz_pX>: genus 2 and 3 squares agree with NUDUPL", "[SquareExplicit]") {
+    zz_p::init(1000003);
+    SetSeed(ZZ(2));
+
+    for (long g = 2; g <= 3; ++g) {
+        zz_pX f, h, p;
+
+        // y^2 = f(x), deg f = 2g + 1, with leading coefficient 3
+        random(f, 2*g + 1);
+        SetCoeff(f, 2*g + 1, 3);
+        clear(h);
+
+        QuadraticOrder<zz_pX> QO(f);
+        REQUIRE(QO.getGenus() == g);
+
+        ReducePlainImag<zz_pX> red;
+        red.init(f, h, g);
+        QO.set_red_best(red);
+
+        SquareNudupl<zz_pX> nudupl;
+        nudupl.init(f, h, g);
+
+        SquareExplicit<zz_pX> sexp;
+        sexp.init(f, h, g);
+        QO.set_sqr_best(sexp);
+
+        QuadraticIdealBase<zz_pX> A(QO), B(QO), C(QO);
+
+        // A = prime ideal over X - alpha (degree 1:  NUDUPL is used)
+        for (long alpha = 1; ; ++alpha) {
+            clear(p);
+            SetCoeff(p, 1);
+            SetCoeff(p, 0, -alpha);
+            if (A.assign_prime(p))
+                break;
+        }
+        A.reduce();
+
+        sexp.reset_fallbacks();
+        for (long i = 0; i < 200; ++i) {
+            QO.get_sqr_best()->square(B, A);
+            nudupl.square(C, A);
+            C.reduce();
+            REQUIRE(B == C);
+            REQUIRE(IsOne(LeadCoeff(B.get_a())));
+            REQUIRE(B.get_b()*B.get_b() - B.get_a()*B.get_c() == f);
+            A.assign(B);
+        }
+
+        // the first squares have degree < g
+        REQUIRE(sexp.get_fallbacks() >= 1);
+        REQUIRE(sexp.get_fallbacks() < 10);
+
+        // sqr_k() through the strategy
+        A.assign(B);
+        for (long i = 0; i < 5; ++i) {
+            nudupl.square(C, C);
+            C.reduce();
+        }
+        sexp.sqr_k(B, A, 5);
+        REQUIRE(B == C);
+    }
+}
+#endif
@@ -0,0 +1,89 @@
+/**
+ * @file SquareNudupl_ZZ_Benchmark.cpp
+ * @brief Benchmark of repeated squaring (A^(2^k)) with NUDUPL: k calls to
+ *        square() followed by reduce(), against the fused sqr_k().
+ *
+ * usage:  sqr_k_bench [k] [bits ...]     (default k = 1000000, 1024 2048)
+ */
+
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include <NTL/ZZ.h>
+
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/Square/SquareNudupl.hpp>
+#include <ANTL/Quadratic/Reduce/ReducePlainImag.hpp>
+
+NTL_CLIENT
+using namespace ANTL;
+
+
+int main (int argc, char **argv)
+{
+  long k = 1000000;
+  std::vector<long> sizes;
+  ZZ D, p;
+  double t, t_step, t_fused;
+
+  if (argc > 1)
+    k = atol(argv[1]);
+  for (long i = 2; i < argc; ++i)
+    sizes.push_back(atol(argv[i]));
+  if (sizes.empty()) {
+    sizes.push_back(1024);
+    sizes.push_back(2048);
+  }
+
+  SetSeed(ZZ(1));
+
+  for (long i = 0; i < (long) sizes.size(); ++i) {
+    // Delta = -q, q = 3 mod 4 prime of the given size
+    do {
+      RandomPrime(p, sizes[i]);
+    } while (rem(p, 4) != 3);
+    NTL::negate(D, p);
+
+    QuadraticOrder<ZZ> QO(D);
+
+    ReducePlainImag<ZZ> red;
+    red.init(D, ZZ(0));
+    QO.set_red_best(red);
+
+    SquareNudupl<ZZ> nudupl;
+    nudupl.init(D, ZZ(0));
+    QO.set_sqr_nudupl(nudupl);
+
+    // base:  prime ideal over the smallest split prime
+    QuadraticIdealBase<ZZ> A(QO), B(QO), C(QO);
+    for (p = 3; !A.assign_prime(p); p = NextPrime(p + 1));
+    A.reduce();
+
+    // k squarings, each reduced
+    t = GetTime();
+    B.assign(A);
+    for (long j = 0; j < k; ++j) {
+      nudupl.square(B, B);
+      B.reduce();
+    }
+    t_step = GetTime() - t;
+
+    // fused
+    t = GetTime();
+    nudupl.sqr_k(C, A, k);
+    t_fused = GetTime() - t;
+
+    cout << "bits = " << sizes[i] << ", k = " << k << endl;
+    cout << "  square + reduce:  " << t_step << " s  (" << k / t_step << " squarings/s)" << endl;
+    cout << "  sqr_k:            " << t_fused << " s  (" << k / t_fused << " squarings/s)" << endl;
+
+    if (B.get_a() != C.get_a() || B.get_b() != C.get_b()) {
+      cout << "ERROR:  results differ" << endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,66 @@
+#ifndef SQUARE_STRATEGY_ZZ_TEST
+#define SQUARE_STRATEGY_ZZ_TEST
+
+#include "../../catch.hpp"
+#include <ANTL/Quadratic/Square/SquareNudupl.hpp>
+#include <ANTL/Quadratic/Square/SquarePlain.hpp>
+#include <ANTL/Quadratic/Reduce/ReducePlainImag.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+TEST_CASE("SquareStrategy<ZZ>: repeated squaring with sqr_k", "[SquareStrategy]") {
+
+    ZZ D = to_ZZ("-1155587265460919309098822660847");
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(D);
+
+    ReducePlainImag<ZZ> red_plain_imag_object = ReducePlainImag<ZZ>();
+    red_plain_imag_object.init(D, ZZ(0));
+    quad_order1.set_red_best(red_plain_imag_object);
+
+    SquareNudupl<ZZ> sqr_nudupl_object = SquareNudupl<ZZ>();
+    sqr_nudupl_object.init(D, ZZ(0));
+    quad_order1.set_sqr_nudupl(sqr_nudupl_object);
+
+    SquarePlain<ZZ> sqr_plain_object = SquarePlain<ZZ>();
+    sqr_plain_object.init(D, ZZ(0));
+    quad_order1.set_sqr_plain(sqr_plain_object);
+
+    QuadraticIdealBase<ZZ> A = QuadraticIdealBase<ZZ>(quad_order1);
+    QuadraticIdealBase<ZZ> B = QuadraticIdealBase<ZZ>(quad_order1);
+    QuadraticIdealBase<ZZ> C = QuadraticIdealBase<ZZ>(quad_order1);
+
+    // prime ideal over 3
+    A.assign(ZZ(3), ZZ(1), to_ZZ("96298938788409942424901888404"));
+
+    // fused NUDUPL steps agree with squaring and reducing k times
+    B.assign(A);
+    for (long i = 0; i < 100; ++i) {
+        quad_order1.get_sqr_nudupl()->square(B, B);
+        B.reduce();
+    }
+    quad_order1.get_sqr_nudupl()->sqr_k(C, A, 100);
+    REQUIRE(C.get_a() == B.get_a());
+    REQUIRE(C.get_b() == B.get_b());
+    REQUIRE(C.get_c() == B.get_c());
+
+    // A^(2^1000), fused and generic
+    quad_order1.get_sqr_nudupl()->sqr_k(C, A, 1000);
+    REQUIRE(C.get_a() == to_ZZ("435857880275542"));
+    REQUIRE(C.get_b() == to_ZZ("127763907766359"));
+    REQUIRE(C.get_c() == to_ZZ("672186356277296"));
+
+    quad_order1.get_sqr_plain()->sqr_k(B, A, 1000);
+    REQUIRE(B.get_a() == C.get_a());
+    REQUIRE(B.get_b() == C.get_b());
+
+    // in place, and k = 0
+    B.assign(A);
+    quad_order1.get_sqr_nudupl()->sqr_k(B, B, 1000);
+    REQUIRE(B.get_a() == C.get_a());
+
+    quad_order1.get_sqr_nudupl()->sqr_k(B, A, 0);
+    REQUIRE(B.get_a() == A.get_a());
+    REQUIRE(B.get_b() == A.get_b());
+}
+#endif
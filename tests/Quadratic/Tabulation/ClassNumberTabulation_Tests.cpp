@@ -0,0 +1,103 @@
+#ifndef CLASSNUMBERTABULATION_TEST
+#define CLASSNUMBERTABULATION_TEST
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "../../catch.hpp"
+#include <ANTL/Quadratic/Tabulation/ClassNumberTabulation.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+static void read_tabulation (const char * file, std::vector<long> & D, std::vector<long> & h, bool exact = false)
+{
+    std::ifstream in(file, std::ios::binary);
+    long d, hlo, hhi;
+    double R;
+
+    REQUIRE(ClassNumberTabulation::read_header(in, d));
+    while (ClassNumberTabulation::read_record(in, d, hlo, hhi, R)) {
+        if (exact)
+            REQUIRE(hlo == hhi);
+        D.push_back(d);
+        h.push_back(hlo);
+    }
+}
+
+TEST_CASE("ClassNumberTabulation: class numbers of small real quadratic fields", "[ClassNumberTabulation]") {
+
+    ClassNumberTabulation tab = ClassNumberTabulation(5, 200);
+    tab.set_block_size(64);
+    REQUIRE(tab.run("ClassNumberTabulation_test.bin"));
+    REQUIRE(tab.get_num_records() == 60);
+
+    std::vector<long> D, h;
+    read_tabulation("ClassNumberTabulation_test.bin", D, h, true);
+
+    REQUIRE(D.size() == 60);
+    REQUIRE(D[0] == 5);
+    REQUIRE(D[1] == 8);
+    REQUIRE(D[2] == 12);
+    REQUIRE(D[11] == 40);
+    REQUIRE(h[11] == 2);
+
+    for (long i = 0; i < (long) D.size(); ++i) {
+        if (D[i] == 145)
+            REQUIRE(h[i] == 4);
+        else if (D[i] == 60 || D[i] == 65 || D[i] == 85 || D[i] == 136)
+            REQUIRE(h[i] == 2);
+        else if (D[i] == 5 || D[i] == 13 || D[i] == 193)
+            REQUIRE(h[i] == 1);
+    }
+
+    std::remove("ClassNumberTabulation_test.bin");
+}
+
+TEST_CASE("ClassNumberTabulation: shards and checkpoints", "[ClassNumberTabulation]") {
+
+    std::vector<long> D, h, D0, h0, D1, h1;
+
+    ClassNumberTabulation full = ClassNumberTabulation(1000, 3000);
+    full.set_block_size(100);
+    REQUIRE(full.run("ClassNumberTabulation_full.bin"));
+    read_tabulation("ClassNumberTabulation_full.bin", D, h);
+
+    ClassNumberTabulation part0 = ClassNumberTabulation(1000, 3000);
+    part0.set_block_size(100);
+    part0.set_shard(0, 2);
+    part0.set_checkpoint("ClassNumberTabulation_shard0.ckpt");
+    REQUIRE(part0.run("ClassNumberTabulation_shard0.bin"));
+
+    // resuming a finished shard does not change the output
+    REQUIRE(part0.run("ClassNumberTabulation_shard0.bin"));
+    read_tabulation("ClassNumberTabulation_shard0.bin", D0, h0);
+
+    ClassNumberTabulation part1 = ClassNumberTabulation(1000, 3000);
+    part1.set_block_size(100);
+    part1.set_shard(1, 2);
+    REQUIRE(part1.run("ClassNumberTabulation_shard1.bin"));
+    read_tabulation("ClassNumberTabulation_shard1.bin", D1, h1);
+
+    D0.insert(D0.end(), D1.begin(), D1.end());
+    h0.insert(h0.end(), h1.begin(), h1.end());
+    REQUIRE(D0 == D);
+    REQUIRE(h0 == h);
+
+    // the checkpoint of shard 0 does not match shard 1 (or another range)
+    part1.set_checkpoint("ClassNumberTabulation_shard0.ckpt");
+    REQUIRE(!part1.run("ClassNumberTabulation_shard1.bin"));
+
+    ClassNumberTabulation other = ClassNumberTabulation(1000, 4000);
+    other.set_block_size(100);
+    other.set_checkpoint("ClassNumberTabulation_shard0.ckpt");
+    REQUIRE(!other.run("ClassNumberTabulation_shard1.bin"));
+
+    std::remove("ClassNumberTabulation_full.bin");
+    std::remove("ClassNumberTabulation_shard0.bin");
+    std::remove("ClassNumberTabulation_shard1.bin");
+    std::remove("ClassNumberTabulation_shard0.ckpt");
+}
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * @file ClassGroupVDF_ZZ_Benchmark.cpp
+ * @brief Benchmark of the class-group VDF:  squarings per second of the
+ *        chain, and prover/verifier times of the Wesolowski and Pietrzak
+ *        proofs.
+ *
+ * usage:  vdf_bench [t] [threads] [bits ...]   (default t = 2^20, 1 thread, 1024 2048)
+ */
+
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include <NTL/ZZ.h>
+
+#include <ANTL/Quadratic/QuadraticOrder.hpp>
+#include <ANTL/Quadratic/QuadraticIdealBase.hpp>
+#include <ANTL/Quadratic/VDF/ClassGroupVDF.hpp>
+#include <ANTL/Quadratic/Reduce/ReducePlainImag.hpp>
+
+NTL_CLIENT
+using namespace ANTL;
+
+
+int main (int argc, char **argv)
+{
+  long t = 1L << 20;
+  long threads = 1;
+  std::vector<long> sizes;
+  ZZ D, p;
+  double start, t_eval, t_prove, t_verify;
+
+  if (argc > 1)
+    t = atol(argv[1]);
+  if (argc > 2)
+    threads = atol(argv[2]);
+  for (long i = 3; i < argc; ++i)
+    sizes.push_back(atol(argv[i]));
+  if (sizes.empty()) {
+    sizes.push_back(1024);
+    sizes.push_back(2048);
+  }
+
+  SetSeed(ZZ(1));
+
+  for (long i = 0; i < (long) sizes.size(); ++i) {
+    // Delta = -q, q = 3 mod 4 prime of the given size
+    do {
+      RandomPrime(p, sizes[i]);
+    } while (rem(p, 4) != 3);
+    NTL::negate(D, p);
+
+    QuadraticOrder<ZZ> QO(D);
+
+    ReducePlainImag<ZZ> red;
+    red.init(D, ZZ(0));
+    QO.set_red_best(red);
+
+    // base:  prime ideal over the smallest split prime
+    QuadraticIdealBase<ZZ> g(QO), y(QO), pi(QO);
+    std::vector< QuadraticIdealBase<ZZ> > proof;
+    for (p = 3; !g.assign_prime(p); p = NextPrime(p + 1));
+    g.reduce();
+
+    ClassGroupVDF<ZZ> vdf(QO);
+    vdf.set_threads(threads);
+
+    start = GetTime();
+    vdf.evaluate(y, g, t);
+    t_eval = GetTime() - start;
+
+    cout << "bits = " << sizes[i] << ", t = " << t << ", threads = " << threads << endl;
+    cout << "  eval:             " << t_eval << " s  (" << t / t_eval << " squarings/s)" << endl;
+
+    start = GetTime();
+    vdf.prove_wesolowski(pi, t);
+    t_prove = GetTime() - start;
+
+    start = GetTime();
+    bool ok = vdf.verify_wesolowski(g, y, pi, t);
+    t_verify = GetTime() - start;
+
+    cout << "  Wesolowski:       prove " << t_prove << " s, verify " << t_verify << " s" << endl;
+    if (!ok) {
+      cout << "ERROR:  Wesolowski proof rejected" << endl;
+      return 1;
+    }
+
+    start = GetTime();
+    vdf.prove_pietrzak(proof, t);
+    t_prove = GetTime() - start;
+
+    start = GetTime();
+    ok = vdf.verify_pietrzak(g, y, proof, t);
+    t_verify = GetTime() - start;
+
+    cout << "  Pietrzak:         prove " << t_prove << " s, verify " << t_verify << " s  ("
+         << proof.size() << " rounds)" << endl;
+    if (!ok) {
+      cout << "ERROR:  Pietrzak proof rejected" << endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
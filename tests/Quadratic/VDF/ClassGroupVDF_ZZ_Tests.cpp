@@ -0,0 +1,126 @@
+#ifndef CLASS_GROUP_VDF_ZZ_TEST
+#define CLASS_GROUP_VDF_ZZ_TEST
+
+#include <thread>
+#include <vector>
+
+#include "../../catch.hpp"
+#include <ANTL/Quadratic/VDF/ClassGroupVDF.hpp>
+#include <ANTL/Quadratic/Reduce/ReducePlainImag.hpp>
+
+using namespace NTL;
+using namespace ANTL;
+
+TEST_CASE("ClassGroupVDF<ZZ>: evaluation and proofs", "[ClassGroupVDF]") {
+
+    ZZ D = to_ZZ("-1155587265460919309098822660847");
+    QuadraticOrder<ZZ> quad_order1 = QuadraticOrder<ZZ>(D);
+
+    ReducePlainImag<ZZ> red_plain_imag_object = ReducePlainImag<ZZ>();
+    red_plain_imag_object.init(D, ZZ(0));
+    quad_order1.set_red_best(red_plain_imag_object);
+
+    SquareNudupl<ZZ> sqr_nudupl_object = SquareNudupl<ZZ>();
+    sqr_nudupl_object.init(D, ZZ(0));
+
+    QuadraticIdealBase<ZZ> g = QuadraticIdealBase<ZZ>(quad_order1);
+    QuadraticIdealBase<ZZ> y = QuadraticIdealBase<ZZ>(quad_order1);
+    QuadraticIdealBase<ZZ> z = QuadraticIdealBase<ZZ>(quad_order1);
+    QuadraticIdealBase<ZZ> pi = QuadraticIdealBase<ZZ>(quad_order1);
+    std::vector< QuadraticIdealBase<ZZ> > proof;
+
+    // prime ideal over 3
+    g.assign(ZZ(3), ZZ(1), to_ZZ("96298938788409942424901888404"));
+
+    ClassGroupVDF<ZZ> vdf(quad_order1, 16);
+
+    SECTION("output agrees with repeated squaring") {
+        vdf.evaluate(y, g, 1000);
+        REQUIRE(y.get_a() == to_ZZ("435857880275542"));
+        REQUIRE(y.get_b() == to_ZZ("127763907766359"));
+        REQUIRE(vdf.get_iterations() == 1000);
+
+        for (long t = 0; t <= 1000; t += 37) {
+            vdf.output(y, t);
+            sqr_nudupl_object.sqr_k(z, g, t);
+            REQUIRE(y.get_a() == z.get_a());
+            REQUIRE(y.get_b() == z.get_b());
+        }
+
+        // beyond the chain
+        vdf.output(y, 1100);
+        sqr_nudupl_object.sqr_k(z, g, 1100);
+        REQUIRE(y.get_a() == z.get_a());
+        REQUIRE(y.get_b() == z.get_b());
+    }
+
+    SECTION("Wesolowski proofs") {
+        vdf.evaluate(y, g, 1000);
+
+        for (long threads = 1; threads <= 3; ++threads) {
+            vdf.set_threads(threads);
+            vdf.prove_wesolowski(pi, 1000);
+            REQUIRE(vdf.verify_wesolowski(g, y, pi, 1000));
+        }
+
+        // t < 128: pi = 1
+        vdf.output(z, 100);
+        vdf.prove_wesolowski(pi, 100);
+        REQUIRE(pi.IsOne());
+        REQUIRE(vdf.verify_wesolowski(g, z, pi, 100));
+
+        // wrong output, wrong t, wrong proof
+        vdf.prove_wesolowski(pi, 1000);
+        vdf.output(z, 999);
+        REQUIRE(!vdf.verify_wesolowski(g, z, pi, 1000));
+        REQUIRE(!vdf.verify_wesolowski(g, y, pi, 999));
+        REQUIRE(!vdf.verify_wesolowski(g, y, z, 1000));
+    }
+
+    SECTION("Pietrzak proofs") {
+        vdf.evaluate(y, g, 1024);
+
+        for (long threads = 1; threads <= 3; ++threads) {
+            vdf.set_threads(threads);
+            vdf.prove_pietrzak(proof, 1024);
+            REQUIRE(proof.size() == 10);
+            REQUIRE(vdf.verify_pietrzak(g, y, proof, 1024));
+        }
+
+        // t = 3 * 2^7 = 384: the last rounds are squared out
+        vdf.output(z, 384);
+        vdf.prove_pietrzak(proof, 384);
+        REQUIRE(proof.size() == 7);
+        REQUIRE(vdf.verify_pietrzak(g, z, proof, 384));
+
+        // wrong output, wrong t, tampered proof
+        REQUIRE(!vdf.verify_pietrzak(g, y, proof, 384));
+        REQUIRE(!vdf.verify_pietrzak(g, z, proof, 768));
+        proof[3].assign(proof[4]);
+        REQUIRE(!vdf.verify_pietrzak(g, z, proof, 384));
+    }
+
+    SECTION("proofs while the chain is extended") {
+        vdf.start(g);
+        vdf.advance(512);
+
+        std::thread worker([&vdf] () { vdf.advance(4096); });
+
+        vdf.output(y, 512);
+        vdf.prove_wesolowski(pi, 512);
+        vdf.prove_pietrzak(proof, 512);
+
+        worker.join();
+
+        REQUIRE(vdf.get_iterations() == 4608);
+        REQUIRE(vdf.verify_wesolowski(g, y, pi, 512));
+        REQUIRE(vdf.verify_pietrzak(g, y, proof, 512));
+
+        vdf.output(z, 4608);
+        sqr_nudupl_object.sqr_k(y, g, 4608);
+        REQUIRE(y.get_a() == z.get_a());
+        REQUIRE(y.get_b() == z.get_b());
+    }
+}
+
+#endif
@@ -28,4 +28,54 @@ TEST_CASE("Common: Kronecker Symbol computes correctly", "[Common]") {
   REQUIRE(Kronecker(ZZ(10), long(12)) == 0);
 }
 
+TEST_CASE("Common: block Jacobi symbols agree with Jacobi_base", "[Common]") {
+
+  long a[] = {17, 16, 11, 0, 10, 1, 24};
+  long n[] = {13, 13, 13, 13, 21, 3, 35};
+  long J[7];
+
+  Jacobi_base(J, a, n, 7);
+  for (long i = 0; i < 7; ++i)
+    REQUIRE(J[i] == Jacobi_base(a[i], n[i]));
+}
+
+TEST_CASE("Common: block remainders agree with rem", "[Common]") {
+
+  long n[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 1000003};
+  long r[12];
+  ZZ a;
+
+  for (long len = 1; len <= 12; ++len) {
+    RandomBits(a, 300);
+    if (len & 1)
+      negate(a, a);
+
+    rem_block(r, a, n, len);
+    for (long i = 0; i < len; ++i)
+      REQUIRE(r[i] == rem(a, n[i]));
+
+    rem_block(r, -123456789L, n, len);
+    for (long i = 0; i < len; ++i)
+      REQUIRE(r[i] == rem(ZZ(-123456789L), n[i]));
+  }
+}
+
+TEST_CASE("Common: word-size modular square roots", "[Common]") {
+
+  long p[] = {3, 5, 13, 17, 41, 97, 65537, 1000003};
+  long x;
+
+  for (long k = 0; k < 8; ++k)
+    for (long a = 0; a < 200; ++a) {
+      long jac = ressol_long(x, a, p[k]);
+      if (a % p[k] == 0)
+        REQUIRE(jac == 0);
+      else {
+        REQUIRE(jac == Jacobi(a, p[k]));
+        if (jac > 0)
+          REQUIRE(MulMod(x, x, p[k]) == a % p[k]);
+      }
+    }
+}
+
 #endif